@@ -0,0 +1,162 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kcharconv.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+#include <yvals.h>
+#include <xcharconv.h>
+#include <string>
+#include <type_traits>
+
+ //
+ // to_chars backed by the runtime: integers two digits per step, floating
+ // point as shortest round-trip (Ryu), exact fixed/scientific/general with a
+ // precision, and hex. No heap, no locks, any IRQL. std::kto_chars takes the
+ // same arguments and gives the same output as std::to_chars, which is inline
+ // in <charconv> and so cannot be supplied by the runtime itself;
+ // std::kto_string does the same for std::to_string.
+ //
+
+// Each writes value to [first, last) and returns the end of the text, or
+// nullptr if it does not fit.
+
+// Integers in base 2 to 36, lowercase; nullptr for any other base.
+extern "C" char* __cdecl __ucxxrt_to_chars_u64(
+    _Out_writes_to_ptr_(last) char* first,
+    _In_ char* last,
+    _In_ unsigned long long value,
+    _In_ int base
+) noexcept;
+
+extern "C" char* __cdecl __ucxxrt_to_chars_i64(
+    _Out_writes_to_ptr_(last) char* first,
+    _In_ char* last,
+    _In_ long long value,
+    _In_ int base
+) noexcept;
+
+// format is a chars_format, or 0 for the plain overload; a negative
+// precision selects the shortest round-trip digits.
+extern "C" char* __cdecl __ucxxrt_to_chars_d(
+    _Out_writes_to_ptr_(last) char* first,
+    _In_ char* last,
+    _In_ double value,
+    _In_ int format,
+    _In_ int precision
+) noexcept;
+
+extern "C" char* __cdecl __ucxxrt_to_chars_f(
+    _Out_writes_to_ptr_(last) char* first,
+    _In_ char* last,
+    _In_ float value,
+    _In_ int format,
+    _In_ int precision
+) noexcept;
+
+_STD_BEGIN
+
+_NODISCARD inline to_chars_result ___kto_chars_result(char* const last, char* const end) noexcept {
+    if (end == nullptr) {
+        return { last, errc::value_too_large };
+    }
+
+    return { end, errc{} };
+}
+
+_NODISCARD inline int ___kto_chars_precision(const chars_format fmt, const int precision) noexcept {
+    // C11 7.21.6.1/5: a negative precision is taken as if it were omitted
+    if (precision >= 0) {
+        return precision;
+    }
+
+    return fmt == chars_format::hex ? -1 : 6;
+}
+
+template <class _Int, enable_if_t<is_integral_v<_Int> && !is_same_v<remove_cv_t<_Int>, bool>, int> = 0>
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const _Int value, const int base = 10) noexcept {
+    _STL_ASSERT(base >= 2 && base <= 36, "invalid base in kto_chars()");
+
+    if constexpr (is_signed_v<_Int>) {
+        return ___kto_chars_result(last, __ucxxrt_to_chars_i64(first, last, value, base));
+    } else {
+        return ___kto_chars_result(last, __ucxxrt_to_chars_u64(first, last, value, base));
+    }
+}
+
+_NODISCARD inline to_chars_result kto_chars(char* const first, char* const last, const float value) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_f(first, last, value, 0, -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(char* const first, char* const last, const double value) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_d(first, last, value, 0, -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(char* const first, char* const last, const long double value) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_d(first, last, static_cast<double>(value), 0, -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const float value, const chars_format fmt) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_f(first, last, value, static_cast<int>(fmt), -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const double value, const chars_format fmt) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_d(first, last, value, static_cast<int>(fmt), -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const long double value, const chars_format fmt) noexcept {
+    return ___kto_chars_result(
+        last, __ucxxrt_to_chars_d(first, last, static_cast<double>(value), static_cast<int>(fmt), -1));
+}
+
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const float value, const chars_format fmt, const int precision) noexcept {
+    return ___kto_chars_result(last,
+        __ucxxrt_to_chars_f(first, last, value, static_cast<int>(fmt), ___kto_chars_precision(fmt, precision)));
+}
+
+_NODISCARD inline to_chars_result kto_chars(
+    char* const first, char* const last, const double value, const chars_format fmt, const int precision) noexcept {
+    return ___kto_chars_result(last,
+        __ucxxrt_to_chars_d(first, last, value, static_cast<int>(fmt), ___kto_chars_precision(fmt, precision)));
+}
+
+_NODISCARD inline to_chars_result kto_chars(char* const first, char* const last, const long double value,
+    const chars_format fmt, const int precision) noexcept {
+    return ___kto_chars_result(last, __ucxxrt_to_chars_d(first, last, static_cast<double>(value),
+        static_cast<int>(fmt), ___kto_chars_precision(fmt, precision)));
+}
+
+template <class _Int, enable_if_t<is_integral_v<_Int> && !is_same_v<remove_cv_t<_Int>, bool>, int> = 0>
+_NODISCARD string kto_string(const _Int value) {
+    char buffer[21]; // -9223372036854775808
+    const auto result = _STD kto_chars(buffer, buffer + sizeof(buffer), value);
+    return string(buffer, result.ptr);
+}
+
+_NODISCARD inline string kto_string(const double value) { // "%f"
+    char buffer[330]; // -1.7976931348623157e+308 with six decimals
+    const auto result = _STD kto_chars(buffer, buffer + sizeof(buffer), value, chars_format::fixed, 6);
+    return string(buffer, result.ptr);
+}
+
+_NODISCARD inline string kto_string(const float value) {
+    return _STD kto_string(static_cast<double>(value));
+}
+
+_NODISCARD inline string kto_string(const long double value) {
+    return _STD kto_string(static_cast<double>(value));
+}
+
+_STD_END
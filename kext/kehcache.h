@@ -0,0 +1,61 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kehcache.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+
+ //
+ // Counters of the per-processor PC -> (image base, RUNTIME_FUNCTION) cache
+ // used by the EH dispatcher, and of the ThrowInfo/locator -> image base memo
+ // used by _CxxThrowException, exception_ptr and RTTI, and of the dynamic_cast
+ // and type name hash memos, on x64/ARM64.
+ //
+ // By default only addresses inside the driver's own image are cached, since
+ // the runtime cannot tell when other images unload. A driver that defines
+ //
+ //     extern "C" bool __cdecl __ucxxrt_eh_cache_track_images()
+ //     {
+ //         return true;
+ //     }
+ //
+ // has every image cached. The runtime then registers a load image notify
+ // routine, one of the few the system allows (eight on Windows 7), and drops
+ // the cache on each system image load; if registration fails, it caches the
+ // driver's own image only.
+ //
+
+struct __ucxxrt_eh_cache_stats
+{
+    unsigned long long function_entry_hits;     // RtlLookupFunctionEntry calls avoided
+    unsigned long long function_entry_misses;   // RtlLookupFunctionEntry calls made
+    unsigned long long image_base_hits;         // RtlPcToFileHeader calls avoided
+    unsigned long long image_base_misses;       // RtlPcToFileHeader calls made
+    unsigned long long flushes;                 // invalidations (system image loads, explicit flushes)
+    unsigned long long cast_hits;               // dynamic_casts answered without walking the hierarchy
+    unsigned long long cast_misses;             // dynamic_casts that walked it
+    unsigned long long type_name_hits;          // decorated name hashes reused
+    unsigned long long type_name_misses;        // decorated name hashes computed
+};
+
+// Sums the per-processor counters. Returns false if the cache is not active
+// (x86, or it could not be set up during CRT initialization).
+extern "C" bool __cdecl __ucxxrt_query_eh_cache_stats(
+    _Out_ __ucxxrt_eh_cache_stats* stats
+);
+
+// Drops every cached entry. With image tracking, the runtime already does
+// this whenever a system image is loaded; call it if code is unmapped by other
+// means.
+extern "C" void __cdecl __ucxxrt_flush_eh_cache();
+
+// Called once, while the CRT initializes. The runtime's default, linked only
+// when the driver has none, returns false.
+extern "C" bool __cdecl __ucxxrt_eh_cache_track_images();
@@ -0,0 +1,60 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kehtelemetry.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+
+ //
+ // Optional C++ exception telemetry: which sites throw, how far each
+ // exception travels and how long the search and unwind phases take.
+ // Disabled by default; while disabled the EH paths pay a single branch.
+ // Up to 64 throws in flight at once are timed; beyond that they are only
+ // counted.
+ //
+
+// Buckets of the frames-unwound histogram: 0, 1, 2, 3-4, 5-8, 9-16, 17-32, 33+
+#define UCXXRT_EH_DEPTH_BUCKETS 8
+
+struct __ucxxrt_eh_throw_site
+{
+    void*               return_address;     // the instruction after the call to _CxxThrowException
+    void const*         throw_info;         // nullptr for 'throw;'
+    unsigned long long  count;
+};
+
+struct __ucxxrt_eh_telemetry
+{
+    unsigned long long  throws;
+    unsigned long long  catches;
+    unsigned long long  frames_unwound;     // C++ frames with unwind actions, summed over all catches
+    unsigned long long  destructors_run;    // unwind actions run, summed over all catches
+    unsigned long long  search_ticks;       // throw -> handler found (first pass)
+    unsigned long long  unwind_ticks;       // handler found -> catch block entered (second pass)
+    unsigned long long  tick_frequency;     // KeQueryPerformanceCounter frequency
+    unsigned long long  dropped_sites;      // throws whose site did not fit in the per-processor table
+    unsigned long long  depth_histogram[UCXXRT_EH_DEPTH_BUCKETS];
+};
+
+// Turns recording on or off. Must be called at PASSIVE_LEVEL the first time
+// it is enabled; returns false if the counters could not be allocated.
+extern "C" bool __cdecl __ucxxrt_eh_telemetry_enable(
+    _In_ bool enable
+);
+
+// Sums the per-processor counters into *telemetry and writes up to capacity
+// distinct throw sites, most frequent first, to sites[]; *count receives the
+// number written. Returns false if telemetry was never enabled.
+extern "C" bool __cdecl __ucxxrt_eh_telemetry_snapshot(
+    _Out_ __ucxxrt_eh_telemetry* telemetry,
+    _Out_writes_to_opt_(capacity, *count) __ucxxrt_eh_throw_site* sites,
+    _In_ size_t capacity,
+    _Out_opt_ size_t* count
+);
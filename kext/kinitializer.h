@@ -0,0 +1,59 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kinitializer.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+
+ //
+ // Initializers that DriverEntry may run concurrently. Ordinary dynamic
+ // initializers keep running one after another on the DriverEntry thread;
+ // once they are done, those registered here are spread over a few system
+ // threads, and DriverMain is called when all of them have returned. Each
+ // runs at PASSIVE_LEVEL, after every initializer it names as a dependency has
+ // returned, and must not throw. A dependency that is not registered, or a
+ // cycle, fails DriverEntry with STATUS_FAILED_DRIVER_ENTRY before any of them
+ // runs.
+ //
+ //     static std::kstatic<Table> Names;
+ //     static std::kstatic<Table> Aliases;
+ //
+ //     UCXXRT_PARALLEL_INITIALIZER(NamesInit,   [] { Names.get(LoadNames()); });
+ //     UCXXRT_PARALLEL_INITIALIZER(AliasesInit, [] { Aliases.get(Names.get()); }, &NamesInit);
+ //
+ // Use extern const __ucxxrt_parallel_initializer Name; to name an initializer
+ // registered in another translation unit. With startup timing on
+ // (kext/kstartup.h), the time each one took is recorded with the other
+ // initializers.
+ //
+
+struct __ucxxrt_parallel_initializer
+{
+    void (__cdecl*                                  function)();
+    char const*                                     name;
+    __ucxxrt_parallel_initializer const* const*     dependencies;
+    unsigned int                                    dependency_count;
+};
+
+#pragma section(".CRT$XCZPU", long, read) // Parallel C++ Initializers
+
+// Registers function, which must convert to void (__cdecl*)(), under name,
+// followed by the addresses of the initializers it depends on, if any.
+#define UCXXRT_PARALLEL_INITIALIZER(name, function, ...)                                            \
+    static __ucxxrt_parallel_initializer const* const __ucxxrt_parallel_dependencies_ ## name[] =  \
+        { nullptr, __VA_ARGS__ };                                                                   \
+    extern __ucxxrt_parallel_initializer const name = {                                             \
+        function,                                                                                   \
+        #name,                                                                                      \
+        __ucxxrt_parallel_dependencies_ ## name + 1,                                                \
+        sizeof(__ucxxrt_parallel_dependencies_ ## name) / sizeof(void*) - 1                         \
+    };                                                                                              \
+    __declspec(allocate(".CRT$XCZPU")) static __ucxxrt_parallel_initializer const*                  \
+        const __ucxxrt_parallel_entry_ ## name = &name
@@ -0,0 +1,77 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      klockit.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+#include <yvals.h>
+
+ //
+ // The STL's internal locks, std::_Lockit(_LOCK_MALLOC), (_LOCK_STREAM),
+ // (_LOCK_DEBUG) and so on, are reader-writer locks, one per kind. The STL
+ // headers only take them exclusive; code that merely reads state guarded by
+ // one of them can take it shared instead:
+ //
+ //     {
+ //         std::kshared_lockit Lock(_LOCK_DEBUG);
+ //         ...
+ //     }
+ //
+ // at IRQL <= APC_LEVEL. A thread that holds the kind exclusive may also take
+ // it shared. Shared acquisitions do not nest, and a shared owner must not ask
+ // for the same kind exclusive. _LOCK_LOCALE is the CRT locale lock, which is
+ // always exclusive and has no statistics.
+ //
+ // __ucxxrt_query_lockit_statistics shows which kinds are contended.
+ //
+
+struct __ucxxrt_lockit_statistics
+{
+    unsigned long long  exclusive;  // acquisitions, recursive ones included
+    unsigned long long  shared;
+    unsigned long long  contended;  // acquisitions that found the lock unavailable
+    unsigned long long  sleeps;     // waits that went past spinning
+};
+
+extern "C" void __cdecl __ucxxrt_lockit_lock_shared(
+    _In_ int kind
+) noexcept;
+
+extern "C" void __cdecl __ucxxrt_lockit_unlock_shared(
+    _In_ int kind
+) noexcept;
+
+// Returns false for _LOCK_LOCALE and for kinds without a lock of their own.
+// The counters are cumulative since the driver was loaded.
+extern "C" bool __cdecl __ucxxrt_query_lockit_statistics(
+    _In_ int kind,
+    _Out_ __ucxxrt_lockit_statistics* statistics
+) noexcept;
+
+_STD_BEGIN
+
+class kshared_lockit {
+public:
+    explicit kshared_lockit(int _Kind) noexcept : _Locktype(_Kind) {
+        __ucxxrt_lockit_lock_shared(_Locktype);
+    }
+
+    ~kshared_lockit() noexcept {
+        __ucxxrt_lockit_unlock_shared(_Locktype);
+    }
+
+    kshared_lockit(const kshared_lockit&)            = delete;
+    kshared_lockit& operator=(const kshared_lockit&) = delete;
+
+private:
+    int _Locktype;
+};
+
+_STD_END
@@ -0,0 +1,40 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kmath.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+
+ //
+ // Element-wise e^x, sinh and cosh over arrays of double, 4 lanes at a time
+ // with AVX2 and 2 with SSE2. Results are bit-identical to the scalar
+ // _Exp(&x, 1.0, 0), _Sinh(x, 1.0) and _Cosh(x, 1.0) helpers the runtime uses
+ // for std::complex. No heap, no locks.
+ //
+
+// Writes f(first[i]) to dest[i] for every element of [first, last).
+// dest may equal first; the ranges must not otherwise overlap.
+extern "C" void __stdcall __std_exp_array(
+    _In_reads_(last - first) const double* first,
+    _In_ const double* last,
+    _Out_writes_(last - first) double* dest
+) noexcept;
+
+extern "C" void __stdcall __std_sinh_array(
+    _In_reads_(last - first) const double* first,
+    _In_ const double* last,
+    _Out_writes_(last - first) double* dest
+) noexcept;
+
+extern "C" void __stdcall __std_cosh_array(
+    _In_reads_(last - first) const double* first,
+    _In_ const double* last,
+    _Out_writes_(last - first) double* dest
+) noexcept;
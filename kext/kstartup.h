@@ -0,0 +1,77 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kstartup.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+
+ //
+ // How long each phase of DriverEntry and of unload took, and each static
+ // initializer, in KeQueryPerformanceCounter ticks. Off unless the driver
+ // defines
+ //
+ //     extern "C" int __cdecl __ucxxrt_startup_timing_mode()
+ //     {
+ //         return UCXXRT_STARTUP_TIMING_PRINT;
+ //     }
+ //
+ // which replaces the runtime's default, linked only when the driver has
+ // none. When off, each phase costs one test of a flag.
+ //
+
+#define UCXXRT_STARTUP_TIMING_OFF    0
+#define UCXXRT_STARTUP_TIMING_ON     1  // record, for the query functions
+#define UCXXRT_STARTUP_TIMING_PRINT  2  // also DbgPrintEx the results at the end
+                                        // of DriverEntry and of unload
+
+enum __ucxxrt_startup_phase
+{
+    __ucxxrt_phase_initialize_crt,          // __scrt_initialize_crt, including:
+    __ucxxrt_phase_initialize_locks,        //   __vcrt_initialize_locks
+    __ucxxrt_phase_initialize_ptd,          //   __vcrt_initialize_ptd
+    __ucxxrt_phase_initialize_acrt,         //   __acrt_initialize
+    __ucxxrt_phase_c_initializers,          // _initterm_e(__xi_a, __xi_z)
+    __ucxxrt_phase_cpp_initializers,        // _initterm(__xc_a, __xc_z)
+    __ucxxrt_phase_parallel_initializers,   // kext/kinitializer.h
+    __ucxxrt_phase_driver_main,             // DriverMain
+    __ucxxrt_phase_driver_unload,           // the DriverUnload DriverMain set
+    __ucxxrt_phase_cexit,                   // _cexit: atexit functions, terminators
+    __ucxxrt_phase_uninitialize_crt,        // __scrt_uninitialize_crt
+    __ucxxrt_phase_count
+};
+
+struct __ucxxrt_startup_timing
+{
+    unsigned long long frequency;                       // ticks per second
+    unsigned long long ticks[__ucxxrt_phase_count];     // zero for a phase that has not run
+    unsigned long long initializers;                    // initializers timed so far
+};
+
+struct __ucxxrt_initializer_timing
+{
+    void const*        function;    // as found in the .CRT section; for a parallel
+                                    // initializer (kext/kinitializer.h), its function
+    unsigned long long ticks;
+};
+
+// Returns UCXXRT_STARTUP_TIMING_*. Called once, first thing in DriverEntry.
+extern "C" int __cdecl __ucxxrt_startup_timing_mode();
+
+// Returns false if timing is off.
+extern "C" bool __cdecl __ucxxrt_query_startup_timing(
+    _Out_ __ucxxrt_startup_timing* timing
+);
+
+// Copies up to capacity records, in the order the initializers returned, and
+// returns the number copied. Available until unload.
+extern "C" size_t __cdecl __ucxxrt_query_initializer_timing(
+    _Out_writes_to_(capacity, return) __ucxxrt_initializer_timing* records,
+    _In_ size_t capacity
+);
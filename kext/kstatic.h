@@ -0,0 +1,90 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      kstatic.h
+ * DATA:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+#pragma once
+#include <yvals.h>
+#include <limits.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+ //
+ // A static constructed on first use, exactly once even when several threads
+ // get there together: what /Zc:threadSafeInit gives function-local statics,
+ // which a driver has to be built without. std::kstatic<T> is constant
+ // initialized, so declare it at namespace or class scope; the first get()
+ // constructs the value from its arguments and later calls are a single
+ // acquire load. Threads that arrive while another is constructing wait for
+ // it, so the first get() must be at IRQL <= APC_LEVEL. If the constructor
+ // throws, the next get() tries again. The value is destroyed at unload if it
+ // was ever constructed.
+ //
+
+// The VCRuntime entry points behind compiler-generated guards; a completed
+// guard holds INT_MIN.
+extern "C" void __cdecl _Init_thread_header(_Inout_ int* once) noexcept;
+extern "C" void __cdecl _Init_thread_footer(_Inout_ int* once) noexcept;
+extern "C" void __cdecl _Init_thread_abort(_Inout_ int* once) noexcept;
+
+_STD_BEGIN
+
+template <class _Ty>
+class kstatic {
+public:
+    constexpr kstatic() noexcept {}
+
+    kstatic(const kstatic&)            = delete;
+    kstatic& operator=(const kstatic&) = delete;
+
+    ~kstatic() {
+        if (_Constructed()) {
+            _Get()->~_Ty();
+        }
+    }
+
+    template <class... _Types>
+    _Ty& get(_Types&&... _Args) {
+        if (!_Constructed()) {
+            _Init_thread_header(&_Guard);
+            if (ReadNoFence(_Guard_word()) == -1) { // other threads may still be trying to claim it
+                _TRY_BEGIN
+                ::new (static_cast<void*>(_Storage)) _Ty(_STD forward<_Types>(_Args)...);
+                _CATCH_ALL
+                _Init_thread_abort(&_Guard);
+                _RERAISE;
+                _CATCH_END
+
+                _Init_thread_footer(&_Guard);
+            }
+        }
+
+        return *_Get();
+    }
+
+private:
+    _NODISCARD bool _Constructed() const noexcept {
+        return ReadAcquire(_Guard_word()) == INT_MIN;
+    }
+
+    _NODISCARD const volatile LONG* _Guard_word() const noexcept {
+        return reinterpret_cast<const volatile LONG*>(&_Guard);
+    }
+
+    _NODISCARD _Ty* _Get() noexcept {
+        return _STD launder(reinterpret_cast<_Ty*>(_Storage));
+    }
+
+    int _Guard = 0;
+    alignas(_Ty) unsigned char _Storage[sizeof(_Ty)]{};
+};
+
+_STD_END
@@ -107,7 +107,7 @@ namespace {
 
 #if _EH_RELATIVE_TYPEINFO
         void* _ThrowImageBase =
-            _PThrow ? RtlPcToFileHeader(const_cast<void*>(static_cast<const void*>(_PThrow)), &_ThrowImageBase)
+            _PThrow ? __vcrt_pc_to_file_header(const_cast<void*>(static_cast<const void*>(_PThrow)), &_ThrowImageBase)
                     : nullptr;
         _Record.ExceptionInformation[3] = reinterpret_cast<ULONG_PTR>(_ThrowImageBase); // params.pThrowImageBase
 #endif // _EH_RELATIVE_TYPEINFO
@@ -207,7 +207,79 @@ static_assert(sizeof(exception_ptr) == sizeof(shared_ptr<const _EXCEPTION_RECORD
                   && alignof(exception_ptr) == alignof(shared_ptr<const _EXCEPTION_RECORD>),
     "std::exception_ptr and std::shared_ptr<const _EXCEPTION_RECORD> must have the same layout.");
 
+#pragma warning(disable : 4074)
+#pragma init_seg(compiler)
+
 namespace {
+    // Control blocks for exception objects up to this size (including the block itself) are recycled through a
+    // lookaside list; exception_ptrs handed from thread to thread on every async completion would otherwise cost a
+    // pool allocation and free per transfer.
+    constexpr size_t _Pooled_block_size = 256;
+
+    class _ExceptionPtr_pool {
+    public:
+        _ExceptionPtr_pool() noexcept {
+            ExInitializeNPagedLookasideList(
+                &_List, nullptr, nullptr, POOL_NX_ALLOCATION, _Pooled_block_size, __ucxxrt_tag, 0);
+            _Outstanding = 1; // the pool's own reference, dropped by the destructor
+            _Ready       = true;
+        }
+
+        ~_ExceptionPtr_pool() noexcept {
+            // an exception_ptr leaked past static destruction keeps the list until it is freed
+            _Ready = false;
+            _Release();
+        }
+
+        _ExceptionPtr_pool(const _ExceptionPtr_pool&)            = delete;
+        _ExceptionPtr_pool& operator=(const _ExceptionPtr_pool&) = delete;
+
+        _NODISCARD void* _Allocate(const size_t _Size, PNPAGED_LOOKASIDE_LIST& _Pool) noexcept {
+            // sets _Pool to the lookaside list the block came from, or nullptr if it came from malloc
+            if (_Ready && _Size <= _Pooled_block_size) {
+                _InterlockedIncrement(&_Outstanding);
+                _Pool              = &_List;
+                void* const _Block = ExAllocateFromNPagedLookasideList(&_List);
+                if (!_Block) {
+                    _Release();
+                }
+
+                return _Block;
+            }
+
+            _Pool = nullptr;
+            return malloc(_Size);
+        }
+
+        void _Free(void* const _Block, const PNPAGED_LOOKASIDE_LIST _Pool) noexcept {
+            if (_Pool) {
+                ExFreeToNPagedLookasideList(_Pool, _Block);
+                _Release();
+            } else {
+                free(_Block);
+            }
+        }
+
+        _NODISCARD static size_t _Capacity(const size_t _Size, const PNPAGED_LOOKASIDE_LIST _Pool) noexcept {
+            return _Pool ? _Pooled_block_size : _Size;
+        }
+
+    private:
+        void _Release() noexcept {
+            // the list is deleted when the pool is gone and every block it handed out is back
+            if (_InterlockedDecrement(&_Outstanding) == 0) {
+                ExDeleteNPagedLookasideList(&_List);
+            }
+        }
+
+        NPAGED_LOOKASIDE_LIST _List;
+        long volatile _Outstanding = 0;
+        bool _Ready                = false;
+    };
+
+    // constructed before and destroyed after any user static that could hold an exception_ptr
+    _ExceptionPtr_pool _Exception_ptr_pool;
+
     template <class _StaticEx>
     class _ExceptionPtr_static final : public _Ref_count_base {
         // reference count control block for special "never allocates" exceptions like the bad_alloc or bad_exception
@@ -290,32 +362,34 @@ namespace {
         }
 
         void _Delete_this() noexcept override {
-            free(this);
+            _Exception_ptr_pool._Free(this, _Pool);
         }
 
     public:
-        explicit _ExceptionPtr_normal(const _EXCEPTION_RECORD& _Record) noexcept : _Ref_count_base() {
+        explicit _ExceptionPtr_normal(const _EXCEPTION_RECORD& _Record, const PNPAGED_LOOKASIDE_LIST _Pool_) noexcept
+            : _Ref_count_base(), _Pool(_Pool_) {
             _CopyExceptionRecord(_ExRecord, _Record);
         }
 
         _EXCEPTION_RECORD _ExRecord;
-        void* _Unused_alignment_padding;
+        PNPAGED_LOOKASIDE_LIST _Pool; // also keeps the trailing exception object aligned
     };
 
     // We aren't using alignas because this file might be compiled with _M_CEE_PURE
     static_assert(sizeof(_ExceptionPtr_normal) % __STDCPP_DEFAULT_NEW_ALIGNMENT__ == 0,
         "Exception in exception_ptr would be constructed with the wrong alignment");
 
-    void _Assign_seh_exception_ptr_from_record(
-        shared_ptr<const _EXCEPTION_RECORD>& _Dest, const _EXCEPTION_RECORD& _Record, void* const _RxRaw) noexcept {
-        // in the memory _RxRaw, constructs a reference count control block for a SEH exception denoted by _Record
+    void _Assign_seh_exception_ptr_from_record(shared_ptr<const _EXCEPTION_RECORD>& _Dest,
+        const _EXCEPTION_RECORD& _Record, void* const _RxRaw, const PNPAGED_LOOKASIDE_LIST _Pool) noexcept {
+        // in the memory _RxRaw (allocated from _Pool), constructs a reference count control block for a SEH exception
+        // denoted by _Record
         // if _RxRaw is nullptr, assigns bad_alloc instead
         if (!_RxRaw) {
             _Dest = _ExceptionPtr_static<bad_alloc>::_Get();
             return;
         }
 
-        const auto _Rx = ::new (_RxRaw) _ExceptionPtr_normal(_Record);
+        const auto _Rx = ::new (_RxRaw) _ExceptionPtr_normal(_Record, _Pool);
         _Exception_ptr_access::_Set_ptr_rep(_Dest, &_Rx->_ExRecord, _Rx);
     }
 
@@ -341,7 +415,8 @@ namespace {
         const auto _ExceptionObjectSize = static_cast<size_t>(_PType->sizeOrOffset);
         const auto _AllocSize           = sizeof(_ExceptionPtr_normal) + _ExceptionObjectSize;
         _Analysis_assume_(_AllocSize >= sizeof(_ExceptionPtr_normal));
-        auto _RxRaw = malloc(_AllocSize);
+        PNPAGED_LOOKASIDE_LIST _Pool;
+        auto _RxRaw = _Exception_ptr_pool._Allocate(_AllocSize, _Pool);
         if (!_RxRaw) {
             _Dest = _ExceptionPtr_static<bad_alloc>::_Get();
             return;
@@ -355,7 +430,8 @@ namespace {
 #endif // _EH_RELATIVE_TYPEINFO
             );
 
-            const auto _Rx = ::new (_RxRaw) _ExceptionPtr_normal(reinterpret_cast<const _EXCEPTION_RECORD&>(_Record));
+            const auto _Rx =
+                ::new (_RxRaw) _ExceptionPtr_normal(reinterpret_cast<const _EXCEPTION_RECORD&>(_Record), _Pool);
             reinterpret_cast<EHExceptionRecord&>(_Rx->_ExRecord).params.pExceptionObject =
                 static_cast<_ExceptionPtr_normal*>(_RxRaw) + 1;
             _Exception_ptr_access::_Set_ptr_rep(_Dest, &_Rx->_ExRecord, _Rx);
@@ -365,14 +441,14 @@ namespace {
                 || _InnerRecord.ExceptionCode == MANAGED_EXCEPTION_CODE_V4) {
                 // we don't support managed exceptions and don't want to say there's no active exception, so give up and
                 // say bad_exception
-                free(_RxRaw);
+                _Exception_ptr_pool._Free(_RxRaw, _Pool);
                 _Dest = _ExceptionPtr_static<bad_exception>::_Get();
                 return;
             }
 
             if (!PER_IS_MSVC_PURE_OR_NATIVE_EH(&_InnerRecord)) { // catching a non-C++ exception depends on /EHa
                 _Assign_seh_exception_ptr_from_record(
-                    _Dest, reinterpret_cast<const _EXCEPTION_RECORD&>(_InnerRecord), _RxRaw);
+                    _Dest, reinterpret_cast<const _EXCEPTION_RECORD&>(_InnerRecord), _RxRaw, _Pool);
                 return;
             }
 
@@ -389,9 +465,9 @@ namespace {
 
             const auto _InnerExceptionSize = static_cast<size_t>(_PInnerType->sizeOrOffset);
             const auto _InnerAllocSize     = sizeof(_ExceptionPtr_normal) + _InnerExceptionSize;
-            if (_InnerAllocSize > _AllocSize) {
-                free(_RxRaw);
-                _RxRaw = malloc(_InnerAllocSize);
+            if (_InnerAllocSize > _ExceptionPtr_pool::_Capacity(_AllocSize, _Pool)) {
+                _Exception_ptr_pool._Free(_RxRaw, _Pool);
+                _RxRaw = _Exception_ptr_pool._Allocate(_InnerAllocSize, _Pool);
                 if (!_RxRaw) {
                     _Dest = _ExceptionPtr_static<bad_alloc>::_Get();
                     return;
@@ -407,7 +483,7 @@ namespace {
 #endif // _EH_RELATIVE_TYPEINFO
                 );
             } catch (...) { // copying the exception emitted while copying the original exception also threw, give up
-                free(_RxRaw);
+                _Exception_ptr_pool._Free(_RxRaw, _Pool);
                 _Dest = _ExceptionPtr_static<bad_exception>::_Get();
                 return;
             }
@@ -415,7 +491,7 @@ namespace {
             // this next block must be duplicated inside the catch (even though it looks identical to the block in the
             // try) so that _InnerRecord is held alive; exiting the catch will destroy it
             const auto _Rx =
-                ::new (_RxRaw) _ExceptionPtr_normal(reinterpret_cast<const _EXCEPTION_RECORD&>(_InnerRecord));
+                ::new (_RxRaw) _ExceptionPtr_normal(reinterpret_cast<const _EXCEPTION_RECORD&>(_InnerRecord), _Pool);
             reinterpret_cast<EHExceptionRecord&>(_Rx->_ExRecord).params.pExceptionObject =
                 static_cast<_ExceptionPtr_normal*>(_RxRaw) + 1;
             _Exception_ptr_access::_Set_ptr_rep(_Dest, &_Rx->_ExRecord, _Rx);
@@ -466,9 +542,10 @@ _CRTIMP2_PURE void __CLRCALL_PURE_OR_CDECL __ExceptionPtrCurrentException(void*
     if (PER_IS_MSVC_PURE_OR_NATIVE_EH(_PRecord)) {
         _Assign_cpp_exception_ptr_from_record(_Dest, *_PRecord);
     } else {
-        // _Assign_seh_exception_ptr_from_record handles failed malloc
-        _Assign_seh_exception_ptr_from_record(
-            _Dest, reinterpret_cast<_EXCEPTION_RECORD&>(*_PRecord), malloc(sizeof(_ExceptionPtr_normal)));
+        // _Assign_seh_exception_ptr_from_record handles failed allocation
+        PNPAGED_LOOKASIDE_LIST _Pool;
+        const auto _RxRaw = _Exception_ptr_pool._Allocate(sizeof(_ExceptionPtr_normal), _Pool);
+        _Assign_seh_exception_ptr_from_record(_Dest, reinterpret_cast<_EXCEPTION_RECORD&>(*_PRecord), _RxRaw, _Pool);
     }
 }
 
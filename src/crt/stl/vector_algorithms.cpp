@@ -25,6 +25,20 @@ extern "C" long __isa_enabled;
 #endif // !_DEBUG
 
 namespace {
+#ifdef _M_X64
+    // Set by __isa_available_init only with AVX-512 F, DQ, CD, BW and VL, and the OS saving the opmask and zmm state
+    bool _Use_avx512() noexcept {
+        return __isa_enabled & (1 << __ISA_AVAILABLE_AVX512);
+    }
+
+    __mmask64 _Low_mask_avx512(const size_t _Count) noexcept { // the lowest _Count bits, all of them from 64 on
+        if (_Count >= 64) {
+            return ~0ULL;
+        }
+        return _bzhi_u64(~0ULL, static_cast<unsigned int>(_Count)); // BMI2 comes with every AVX-512 CPU
+    }
+#endif // _M_X64
+
     bool _Use_avx2() noexcept {
         return __isa_enabled & (1 << __ISA_AVAILABLE_AVX2);
     }
@@ -68,6 +82,29 @@ namespace {
     void _Advance_bytes(const void*& _Target, ptrdiff_t _Offset) noexcept {
         _Target = static_cast<const unsigned char*>(_Target) + _Offset;
     }
+
+#ifdef _M_X64
+    template <size_t _Element_size>
+    __m512i _Reverse_vector_avx512(const __m512i _Val) noexcept {
+        if constexpr (_Element_size == 1) {
+            // vpermb needs AVX-512 VBMI; reverse the chars in the lanes, then the lanes
+            const __m512i _Reverse_char_lanes =
+                _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+            const __m512i _Lanes_reversed = _mm512_shuffle_epi8(_Val, _Reverse_char_lanes);
+            return _mm512_shuffle_i64x2(_Lanes_reversed, _Lanes_reversed, _MM_SHUFFLE(0, 1, 2, 3));
+        } else if constexpr (_Element_size == 2) {
+            alignas(64) static constexpr uint16_t _Reverse_shorts[32] = {31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+                20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+            return _mm512_permutexvar_epi16(_mm512_load_si512(_Reverse_shorts), _Val);
+        } else if constexpr (_Element_size == 4) {
+            return _mm512_permutexvar_epi32(
+                _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _Val);
+        } else {
+            return _mm512_permutexvar_epi64(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), _Val);
+        }
+    }
+
+#endif // _M_X64
 } // unnamed namespace
 
 extern "C" {
@@ -79,6 +116,22 @@ struct _Min_max_element_t {
 
 __declspec(noalias) void __cdecl __std_swap_ranges_trivially_swappable_noalias(
     void* _First1, void* _Last1, void* _First2) noexcept {
+#ifdef _M_X64
+    if (_Byte_length(_First1, _Last1) >= 64 && _Use_avx512()) {
+        const void* _Stop_at = _First1;
+        _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & ~size_t{0x3F});
+        do {
+            const __m512i _Left  = _mm512_loadu_si512(_First1);
+            const __m512i _Right = _mm512_loadu_si512(_First2);
+            _mm512_storeu_si512(_First1, _Right);
+            _mm512_storeu_si512(_First2, _Left);
+            _Advance_bytes(_First1, 64);
+            _Advance_bytes(_First2, 64);
+        } while (_First1 != _Stop_at);
+    }
+#endif // _M_X64
+
+
     constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
     if (_Byte_length(_First1, _Last1) >= 32 && _Use_avx2()) {
         const void* _Stop_at = _First1;
@@ -156,6 +209,21 @@ void* __cdecl __std_swap_ranges_trivially_swappable(void* _First1, void* _Last1,
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _First, void* _Last) noexcept {
+#ifdef _M_X64
+    if (_Byte_length(_First, _Last) >= 128 && _Use_avx512()) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left  = _mm512_loadu_si512(_First);
+            const __m512i _Right = _mm512_loadu_si512(_Last);
+            _mm512_storeu_si512(_First, _Reverse_vector_avx512<1>(_Right));
+            _mm512_storeu_si512(_Last, _Reverse_vector_avx512<1>(_Left));
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+#endif // _M_X64
+
     if (_Byte_length(_First, _Last) >= 64 && _Use_avx2()) {
         const __m256i _Reverse_char_lanes_avx = _mm256_set_epi8( //
             0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
@@ -198,6 +266,21 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _First, void* _Last) noexcept {
+#ifdef _M_X64
+    if (_Byte_length(_First, _Last) >= 128 && _Use_avx512()) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left  = _mm512_loadu_si512(_First);
+            const __m512i _Right = _mm512_loadu_si512(_Last);
+            _mm512_storeu_si512(_First, _Reverse_vector_avx512<2>(_Right));
+            _mm512_storeu_si512(_Last, _Reverse_vector_avx512<2>(_Left));
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+#endif // _M_X64
+
     if (_Byte_length(_First, _Last) >= 64 && _Use_avx2()) {
         const __m256i _Reverse_short_lanes_avx = _mm256_set_epi8( //
             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
@@ -238,6 +321,21 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _First, void* _Last) noexcept {
+#ifdef _M_X64
+    if (_Byte_length(_First, _Last) >= 128 && _Use_avx512()) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left  = _mm512_loadu_si512(_First);
+            const __m512i _Right = _mm512_loadu_si512(_Last);
+            _mm512_storeu_si512(_First, _Reverse_vector_avx512<4>(_Right));
+            _mm512_storeu_si512(_Last, _Reverse_vector_avx512<4>(_Left));
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+#endif // _M_X64
+
     if (_Byte_length(_First, _Last) >= 64 && _Use_avx2()) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -273,6 +371,21 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _First, void* _Last) noexcept {
+#ifdef _M_X64
+    if (_Byte_length(_First, _Last) >= 128 && _Use_avx512()) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left  = _mm512_loadu_si512(_First);
+            const __m512i _Right = _mm512_loadu_si512(_Last);
+            _mm512_storeu_si512(_First, _Reverse_vector_avx512<8>(_Right));
+            _mm512_storeu_si512(_Last, _Reverse_vector_avx512<8>(_Left));
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+#endif // _M_X64
+
     if (_Byte_length(_First, _Last) >= 64 && _Use_avx2()) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -583,6 +696,46 @@ namespace {
             return _mm_cmpgt_epi8(_First, _Second);
         }
 
+        static __m512i _Set_avx512(const _Signed_t _Val) noexcept {
+            return _mm512_set1_epi8(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi8(_Mask, _Src);
+        }
+
+        static __m512i _Inc_avx512(const __m512i _Idx) noexcept {
+            return _mm512_add_epi8(_Idx, _mm512_set1_epi8(1));
+        }
+
+        static __mmask64 _Cmp_gt_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpgt_epi8_mask(_First, _Second);
+        }
+
+        static __mmask64 _Cmp_eq_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpeq_epi8_mask(_First, _Second);
+        }
+
+        static __m512i _Min_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi8(_First, _Second);
+        }
+
+        static __m512i _Max_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi8(_First, _Second);
+        }
+
+        static __m512i _Min_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu8(_First, _Second);
+        }
+
+        static __m512i _Max_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu8(_First, _Second);
+        }
+
+        static __m512i _Blend_avx512(const __m512i _First, const __m512i _Second, const __mmask64 _Mask) noexcept {
+            return _mm512_mask_mov_epi8(_First, _Mask, _Second);
+        }
+
         static __m128i _Min(const __m128i _First, const __m128i _Second, __m128i) noexcept {
             return _mm_min_epi8(_First, _Second);
         }
@@ -658,6 +811,46 @@ namespace {
             return _mm_cmpgt_epi16(_First, _Second);
         }
 
+        static __m512i _Set_avx512(const _Signed_t _Val) noexcept {
+            return _mm512_set1_epi16(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi16(static_cast<__mmask32>(_Mask), _Src);
+        }
+
+        static __m512i _Inc_avx512(const __m512i _Idx) noexcept {
+            return _mm512_add_epi16(_Idx, _mm512_set1_epi16(1));
+        }
+
+        static __mmask64 _Cmp_gt_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpgt_epi16_mask(_First, _Second);
+        }
+
+        static __mmask64 _Cmp_eq_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpeq_epi16_mask(_First, _Second);
+        }
+
+        static __m512i _Min_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi16(_First, _Second);
+        }
+
+        static __m512i _Max_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi16(_First, _Second);
+        }
+
+        static __m512i _Min_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu16(_First, _Second);
+        }
+
+        static __m512i _Max_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu16(_First, _Second);
+        }
+
+        static __m512i _Blend_avx512(const __m512i _First, const __m512i _Second, const __mmask64 _Mask) noexcept {
+            return _mm512_mask_mov_epi16(_First, static_cast<__mmask32>(_Mask), _Second);
+        }
+
         static __m128i _Min(const __m128i _First, const __m128i _Second, __m128i) noexcept {
             return _mm_min_epi16(_First, _Second);
         }
@@ -733,6 +926,46 @@ namespace {
             return _mm_cmpgt_epi32(_First, _Second);
         }
 
+        static __m512i _Set_avx512(const _Signed_t _Val) noexcept {
+            return _mm512_set1_epi32(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(_Mask), _Src);
+        }
+
+        static __m512i _Inc_avx512(const __m512i _Idx) noexcept {
+            return _mm512_add_epi32(_Idx, _mm512_set1_epi32(1));
+        }
+
+        static __mmask64 _Cmp_gt_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpgt_epi32_mask(_First, _Second);
+        }
+
+        static __mmask64 _Cmp_eq_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpeq_epi32_mask(_First, _Second);
+        }
+
+        static __m512i _Min_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi32(_First, _Second);
+        }
+
+        static __m512i _Max_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi32(_First, _Second);
+        }
+
+        static __m512i _Min_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu32(_First, _Second);
+        }
+
+        static __m512i _Max_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu32(_First, _Second);
+        }
+
+        static __m512i _Blend_avx512(const __m512i _First, const __m512i _Second, const __mmask64 _Mask) noexcept {
+            return _mm512_mask_mov_epi32(_First, static_cast<__mmask16>(_Mask), _Second);
+        }
+
         static __m128i _Min(const __m128i _First, const __m128i _Second, __m128i) noexcept {
             return _mm_min_epi32(_First, _Second);
         }
@@ -811,6 +1044,46 @@ namespace {
             return _mm_cmpgt_epi64(_First, _Second);
         }
 
+        static __m512i _Set_avx512(const _Signed_t _Val) noexcept {
+            return _mm512_set1_epi64(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(_Mask), _Src);
+        }
+
+        static __m512i _Inc_avx512(const __m512i _Idx) noexcept {
+            return _mm512_add_epi64(_Idx, _mm512_set1_epi64(1));
+        }
+
+        static __mmask64 _Cmp_gt_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpgt_epi64_mask(_First, _Second);
+        }
+
+        static __mmask64 _Cmp_eq_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_cmpeq_epi64_mask(_First, _Second);
+        }
+
+        static __m512i _Min_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi64(_First, _Second);
+        }
+
+        static __m512i _Max_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi64(_First, _Second);
+        }
+
+        static __m512i _Min_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu64(_First, _Second);
+        }
+
+        static __m512i _Max_u_avx512(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu64(_First, _Second);
+        }
+
+        static __m512i _Blend_avx512(const __m512i _First, const __m512i _Second, const __mmask64 _Mask) noexcept {
+            return _mm512_mask_mov_epi64(_First, static_cast<__mmask8>(_Mask), _Second);
+        }
+
         static __m128i _Min(const __m128i _First, const __m128i _Second, const __m128i _Mask) noexcept {
             return _mm_blendv_epi8(_First, _Second, _Mask);
         }
@@ -820,181 +1093,2842 @@ namespace {
         }
     };
 
-    // _Minmax_element has exactly the same signature as the extern "C" functions
-    // (__std_min_element_N, __std_max_element_N, __std_minmax_element_N), up to calling convention.
-    // This makes sure the template specialization is fused with the extern "C" function.
-    // In optimized builds it avoids an extra call, as this function is too large to inline.
+#ifdef _M_X64
+    // The same vertical search over 64-byte pieces, with the last piece of a portion loaded under a mask and its
+    // masked-off lanes excluded from the updates, so there is no scalar tail. Consumes the whole range.
     template <_Min_max_mode _Mode, class _Traits>
-    auto __stdcall _Minmax_element(const void* _First, const void* const _Last, const bool _Sign) noexcept {
-        _Min_max_element_t _Res = {_First, _First};
-        auto _Base              = static_cast<const char*>(_First);
-        auto _Cur_min_val       = _Traits::_Init_min_val;
-        auto _Cur_max_val       = _Traits::_Init_max_val;
+    void _Minmax_element_avx512(const void*& _First, const void* const _Last, _Min_max_element_t& _Res,
+        const bool _Sign, typename _Traits::_Signed_t& _Cur_min_val,
+        typename _Traits::_Signed_t& _Cur_max_val) noexcept {
+        using _Signed_t   = typename _Traits::_Signed_t;
+        using _Unsigned_t = typename _Traits::_Unsigned_t;
 
-        if (_Byte_length(_First, _Last) >= 16 && _Use_sse42()) {
-            size_t _Portion_byte_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+        constexpr size_t _Lanes = 64 / sizeof(_Signed_t);
+
+        // Flip the sign bits of unsigned values, for signed vector comparisons
+        const __m512i _Sign_correction = _Sign ? _mm512_setzero_si512() : _Traits::_Set_avx512(_Traits::_Init_max_val);
+
+        while (_First != _Last) {
+            size_t _Portion_byte_size = _Byte_length(_First, _Last);
 
             if constexpr (_Traits::_Has_portion_max) {
                 // vector of indices will wrap around at exactly this size
-                constexpr size_t _Max_portion_byte_size = _Traits::_Portion_max * 16;
+                constexpr size_t _Max_portion_byte_size = _Traits::_Portion_max * 64;
                 if (_Portion_byte_size > _Max_portion_byte_size) {
                     _Portion_byte_size = _Max_portion_byte_size;
                 }
             }
 
-            const void* _Stop_at = _First;
-            _Advance_bytes(_Stop_at, _Portion_byte_size);
+            const auto _Base           = static_cast<const char*>(_First);
+            const size_t _Count        = _Portion_byte_size / sizeof(_Signed_t);
+            const size_t _Active_lanes = _Count < _Lanes ? _Count : _Lanes; // lanes that got at least one element
 
-            // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
-            __m128i _Cur_vals =
-                _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
-            __m128i _Cur_vals_min = _Cur_vals; // vector of vertical minimum values
-            __m128i _Cur_idx_min  = _mm_setzero_si128(); // vector of vertical minimum indices
-            __m128i _Cur_vals_max = _Cur_vals; // vector of vertical maximum values
-            __m128i _Cur_idx_max  = _mm_setzero_si128(); // vector of vertical maximum indices
-            __m128i _Cur_idx      = _mm_setzero_si128(); // current vector of indices
+            __m512i _Cur_vals =
+                _mm512_xor_si512(_Traits::_Load_avx512(_Low_mask_avx512(_Active_lanes), _Base), _Sign_correction);
+            __m512i _Cur_vals_min = _Cur_vals; // vector of vertical minimum values
+            __m512i _Cur_idx_min  = _mm512_setzero_si512(); // vector of vertical minimum indices
+            __m512i _Cur_vals_max = _Cur_vals; // vector of vertical maximum values
+            __m512i _Cur_idx_max  = _mm512_setzero_si512(); // vector of vertical maximum indices
+            __m512i _Cur_idx      = _mm512_setzero_si512(); // current vector of indices
 
-            for (;;) {
-                _Advance_bytes(_First, 16);
+            for (size_t _Done = _Lanes; _Done < _Count; _Done += _Lanes) {
+                _Cur_idx = _Traits::_Inc_avx512(_Cur_idx);
 
-                // Increment vertical indices. Will stop at exactly wrap around, if not reach the end before
-                _Cur_idx = _Traits::_Inc(_Cur_idx);
+                const __mmask64 _Mask = _Low_mask_avx512(_Count - _Done);
+                _Cur_vals =
+                    _mm512_xor_si512(_Traits::_Load_avx512(_Mask, _Base + _Done * sizeof(_Signed_t)), _Sign_correction);
 
-                if (_First == _Stop_at) {
-                    // Reached end or indices wrap around point.
-                    // Compute horizontal min and/or max. Determine horizontal and vertical position of it.
+                if constexpr ((_Mode & _Mode_min) != 0) {
+                    // Looking for the first occurrence of minimum, don't overwrite with newly found occurrences
+                    const __mmask64 _Is_less = _Traits::_Cmp_gt_avx512(_Cur_vals_min, _Cur_vals) & _Mask;
+                    _Cur_idx_min             = _Traits::_Blend_avx512(_Cur_idx_min, _Cur_idx, _Is_less);
+                    _Cur_vals_min            = _Traits::_Blend_avx512(_Cur_vals_min, _Cur_vals, _Is_less);
+                }
 
-                    if constexpr ((_Mode & _Mode_min) != 0) {
-                        const __m128i _H_min =
-                            _Traits::_H_min(_Cur_vals_min); // Vector populated by the smallest element
-                        const auto _H_min_val = _Traits::_Get_any(_H_min); // Get any element of it
+                if constexpr (_Mode == _Mode_max) {
+                    // Looking for the first occurrence of maximum, don't overwrite with newly found occurrences
+                    const __mmask64 _Is_greater = _Traits::_Cmp_gt_avx512(_Cur_vals, _Cur_vals_max) & _Mask;
+                    _Cur_idx_max                = _Traits::_Blend_avx512(_Cur_idx_max, _Cur_idx, _Is_greater);
+                    _Cur_vals_max               = _Traits::_Blend_avx512(_Cur_vals_max, _Cur_vals, _Is_greater);
+                } else if constexpr (_Mode == _Mode_both) {
+                    // Looking for the last occurrence of maximum, do overwrite with newly found occurrences
+                    const __mmask64 _Is_not_less = ~_Traits::_Cmp_gt_avx512(_Cur_vals_max, _Cur_vals) & _Mask;
+                    _Cur_idx_max                 = _Traits::_Blend_avx512(_Cur_idx_max, _Cur_idx, _Is_not_less);
+                    _Cur_vals_max                = _Traits::_Blend_avx512(_Cur_vals_max, _Cur_vals, _Is_not_less);
+                }
+            }
 
-                        if (_H_min_val < _Cur_min_val) { // Current horizontal min is less than the old
-                            _Cur_min_val = _H_min_val; // update min
-                            const __m128i _Eq_mask =
-                                _Traits::_Cmp_eq(_H_min, _Cur_vals_min); // Mask of all elems eq to min
-                            int _Mask = _mm_movemask_epi8(_Eq_mask);
-                            // Indices of minimum elements or the greatest index if none
-                            const __m128i _All_max     = _mm_set1_epi8(static_cast<char>(0xFF));
-                            const __m128i _Idx_min_val = _mm_blendv_epi8(_All_max, _Cur_idx_min, _Eq_mask);
-                            __m128i _Idx_min           = _Traits::_H_min_u(_Idx_min_val); // The smallest indices
-                            // Select the smallest vertical indices from the smallest element mask
-                            _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_min, _Idx_min_val));
-                            unsigned long _H_pos;
-                            _BitScanForward(&_H_pos, _Mask); // Find the smallest horizontal index
-                            const auto _V_pos = _Traits::_Get_v_pos(_Cur_idx_min, _H_pos); // Extract its vertical index
-                            _Res._Min         = _Base + _V_pos * 16 + _H_pos; // Finally, compute the pointer
-                        }
-                    }
+            // Fold the halves and then the 128-bit lanes onto each other, then finish as in the SSE4.2 code
+            const auto _H_func = [](__m512i _Cur, const auto _Vertical, const auto _Horizontal) {
+                _Cur = _Vertical(_Cur, _mm512_shuffle_i64x2(_Cur, _Cur, _MM_SHUFFLE(1, 0, 3, 2)));
+                _Cur = _Vertical(_Cur, _mm512_shuffle_i64x2(_Cur, _Cur, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm512_broadcast_i32x4(_Horizontal(_mm512_castsi512_si128(_Cur)));
+            };
+
+            const __mmask64 _Active = _Low_mask_avx512(_Active_lanes);
+            const __m512i _All_max  = _mm512_set1_epi8(static_cast<char>(0xFF));
+
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                // Lanes that got no element hold the greatest value and are left out of the position search
+                const __m512i _Vals =
+                    _Traits::_Blend_avx512(_Traits::_Set_avx512(_Traits::_Init_min_val), _Cur_vals_min, _Active);
+                const __m512i _H_min  = _H_func(_Vals, _Traits::_Min_avx512, _Traits::_H_min);
+                const auto _H_min_val = _Traits::_Get_any(_mm512_castsi512_si128(_H_min));
+
+                if (_H_min_val < _Cur_min_val) { // Current horizontal min is less than the old
+                    _Cur_min_val             = _H_min_val;
+                    const __mmask64 _Eq_mask = _Traits::_Cmp_eq_avx512(_H_min, _Vals) & _Active;
+                    // Indices of minimum elements or the greatest index if none
+                    const __m512i _Idx_min_val = _Traits::_Blend_avx512(_All_max, _Cur_idx_min, _Eq_mask);
+                    const __m512i _Idx_min     = _H_func(_Idx_min_val, _Traits::_Min_u_avx512, _Traits::_H_min_u);
+                    // The smallest horizontal index among the smallest vertical indices
+                    const auto _H_pos =
+                        _tzcnt_u64(_Eq_mask & _Traits::_Cmp_eq_avx512(_Idx_min, _Idx_min_val));
+                    const auto _V_pos = static_cast<_Unsigned_t>(_Traits::_Get_any(_mm512_castsi512_si128(_Idx_min)));
+                    _Res._Min         = _Base + (_V_pos * _Lanes + _H_pos) * sizeof(_Signed_t);
+                }
+            }
 
-                    if constexpr ((_Mode & _Mode_max) != 0) {
-                        const __m128i _H_max =
-                            _Traits::_H_max(_Cur_vals_max); // Vector populated by the largest element
-                        const auto _H_max_val = _Traits::_Get_any(_H_max); // Get any element of it
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                // Lanes that got no element hold the smallest value and are left out of the position search
+                const __m512i _Vals =
+                    _Traits::_Blend_avx512(_Traits::_Set_avx512(_Traits::_Init_max_val), _Cur_vals_max, _Active);
+                const __m512i _H_max  = _H_func(_Vals, _Traits::_Max_avx512, _Traits::_H_max);
+                const auto _H_max_val = _Traits::_Get_any(_mm512_castsi512_si128(_H_max));
+
+                if (_Mode == _Mode_both && _Cur_max_val <= _H_max_val
+                    || _Mode == _Mode_max && _Cur_max_val < _H_max_val) {
+                    // max_element: current horizontal max is greater than the old, update max
+                    // minmax_element: current horizontal max is not less than the old, update max
+                    _Cur_max_val             = _H_max_val;
+                    const __mmask64 _Eq_mask = _Traits::_Cmp_eq_avx512(_H_max, _Vals) & _Active;
+
+                    unsigned long _H_pos;
+                    __m512i _Idx_max;
+                    if constexpr (_Mode == _Mode_both) {
+                        // Looking for the last occurrence of maximum
+                        // Indices of maximum elements or zero if none
+                        const __m512i _Idx_max_val =
+                            _Traits::_Blend_avx512(_mm512_setzero_si512(), _Cur_idx_max, _Eq_mask);
+                        _Idx_max = _H_func(_Idx_max_val, _Traits::_Max_u_avx512, _Traits::_H_max_u);
+                        // The largest horizontal index among the largest vertical indices
+                        _BitScanReverse64(&_H_pos, _Eq_mask & _Traits::_Cmp_eq_avx512(_Idx_max, _Idx_max_val));
+                    } else {
+                        // Looking for the first occurrence of maximum
+                        // Indices of maximum elements or the greatest index if none
+                        const __m512i _Idx_max_val = _Traits::_Blend_avx512(_All_max, _Cur_idx_max, _Eq_mask);
+                        _Idx_max = _H_func(_Idx_max_val, _Traits::_Min_u_avx512, _Traits::_H_min_u);
+                        // The smallest horizontal index among the smallest vertical indices
+                        _BitScanForward64(&_H_pos, _Eq_mask & _Traits::_Cmp_eq_avx512(_Idx_max, _Idx_max_val));
+                    }
 
-                        if (_Mode == _Mode_both && _Cur_max_val <= _H_max_val
-                            || _Mode == _Mode_max && _Cur_max_val < _H_max_val) {
-                            // max_element: current horizontal max is greater than the old, update max
-                            // minmax_element: current horizontal max is not less than the old, update max
-                            _Cur_max_val = _H_max_val;
-                            const __m128i _Eq_mask =
-                                _Traits::_Cmp_eq(_H_max, _Cur_vals_max); // Mask of all elems eq to max
-                            int _Mask = _mm_movemask_epi8(_Eq_mask);
+                    const auto _V_pos = static_cast<_Unsigned_t>(_Traits::_Get_any(_mm512_castsi512_si128(_Idx_max)));
+                    _Res._Max         = _Base + (_V_pos * _Lanes + _H_pos) * sizeof(_Signed_t);
+                }
+            }
 
-                            unsigned long _H_pos;
-                            if constexpr (_Mode == _Mode_both) {
-                                // Looking for the last occurrence of maximum
-                                // Indices of maximum elements or zero if none
-                                const __m128i _Idx_max_val =
-                                    _mm_blendv_epi8(_mm_setzero_si128(), _Cur_idx_max, _Eq_mask);
-                                const __m128i _Idx_max = _Traits::_H_max_u(_Idx_max_val); // The greatest indices
-                                // Select the greatest vertical indices from the largest element mask
-                                _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_max, _Idx_max_val));
-                                _BitScanReverse(&_H_pos, _Mask); // Find the largest horizontal index
-                                _H_pos -= sizeof(_Cur_max_val) - 1; // Correct from highest val bit to lowest
-                            } else {
-                                // Looking for the first occurrence of maximum
-                                // Indices of maximum elements or the greatest index if none
-                                const __m128i _All_max     = _mm_set1_epi8(static_cast<char>(0xFF));
-                                const __m128i _Idx_max_val = _mm_blendv_epi8(_All_max, _Cur_idx_max, _Eq_mask);
-                                const __m128i _Idx_max     = _Traits::_H_min_u(_Idx_max_val); // The smallest indices
-                                // Select the smallest vertical indices from the largest element mask
-                                _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_max, _Idx_max_val));
-                                _BitScanForward(&_H_pos, _Mask); // Find the smallest horizontal index
-                            }
+            _Advance_bytes(_First, static_cast<ptrdiff_t>(_Portion_byte_size));
+        }
+    }
+#endif // _M_X64
+
+    // Vertical search with index tracking over keys: signed integers that order like the elements. Integers are
+    // their own keys, sign corrected when unsigned. Floating-point values map from sign-magnitude to two's
+    // complement, so -0.0 and +0.0 get the same key, and NaNs get the one key that can never win: the greatest
+    // for the minimum, the least for the maximum. Used where compare-and-blend on whole lanes is all there is
+    // (AVX2 for 8 byte integers, SSE4.2 and AVX2 for floating-point); consumes whole vectors only.
+    template <_Min_max_mode _Mode, class _Ops>
+    void _Minmax_element_keys(const void*& _First, const void* const _Last, _Min_max_element_t& _Res,
+        const _Ops& _Op, typename _Ops::_Key_t& _Cur_min_key, typename _Ops::_Key_t& _Cur_max_key) noexcept {
+        using _Key_t = typename _Ops::_Key_t;
+        using _Idx_t = typename _Ops::_Idx_t;
+        using _Vec_t = typename _Ops::_Vec_t;
+
+        constexpr size_t _Lanes = sizeof(_Vec_t) / sizeof(_Key_t);
+
+        size_t _Vec_size = _Byte_length(_First, _Last) & ~(sizeof(_Vec_t) - 1);
+        while (_Vec_size != 0) {
+            size_t _Portion_size = _Vec_size;
+            if constexpr (sizeof(_Idx_t) < sizeof(size_t)) {
+                // Lane indices are as wide as the keys; stop the portion before they wrap
+                constexpr size_t _Max_portion_size = (size_t{1} << (sizeof(_Idx_t) * 8)) * sizeof(_Vec_t);
+                if (_Portion_size > _Max_portion_size) {
+                    _Portion_size = _Max_portion_size;
+                }
+            }
 
-                            const auto _V_pos = _Traits::_Get_v_pos(_Cur_idx_max, _H_pos); // Extract its vertical index
-                            _Res._Max         = _Base + _V_pos * 16 + _H_pos; // Finally, compute the pointer
-                        }
-                    }
-                    // Horizontal part done, results are saved, now need to see if there is another portion to process
+            const auto _Base     = static_cast<const char*>(_First);
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Portion_size);
 
-                    if constexpr (_Traits::_Has_portion_max) {
-                        // Either the last portion or wrapping point reached, need to determine
-                        _Portion_byte_size = _Byte_length(_First, _Last) & ~size_t{0xF};
-                        if (_Portion_byte_size == 0) {
-                            break; // That was the last portion
-                        }
-                        // Start next portion to handle the wrapping indices. Assume _Cur_idx is zero
-                        constexpr size_t _Max_portion_byte_size = _Traits::_Portion_max * 16;
-                        if (_Portion_byte_size > _Max_portion_byte_size) {
-                            _Portion_byte_size = _Max_portion_byte_size;
-                        }
+            _Vec_t _Cur_vals_min = _Op._Load_min(_First);
+            _Vec_t _Cur_vals_max = _Op._Load_max(_First);
+            _Vec_t _Cur_idx_min  = _Op._Zero();
+            _Vec_t _Cur_idx_max  = _Op._Zero();
+            _Vec_t _Cur_idx      = _Op._Zero();
 
-                        _Advance_bytes(_Stop_at, _Portion_byte_size);
-                        // Indices will be relative to the new base
-                        _Base = static_cast<const char*>(_First);
-                        // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
-                        _Cur_vals =
-                            _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
+            for (;;) {
+                _Advance_bytes(_First, sizeof(_Vec_t));
+                if (_First == _Stop_at) {
+                    break;
+                }
 
-                        if constexpr ((_Mode & _Mode_min) != 0) {
-                            _Cur_vals_min = _Cur_vals;
-                            _Cur_idx_min  = _mm_setzero_si128();
-                        }
+                _Cur_idx = _Op._Inc(_Cur_idx);
 
-                        if constexpr ((_Mode & _Mode_max) != 0) {
-                            _Cur_vals_max = _Cur_vals;
-                            _Cur_idx_max  = _mm_setzero_si128();
-                        }
+                if constexpr ((_Mode & _Mode_min) != 0) {
+                    // Take the new lane only if it is strictly less, so the first minimum stays
+                    const _Vec_t _Cur_vals = _Op._Load_min(_First);
+                    const _Vec_t _Is_less  = _Op._Cmp_gt(_Cur_vals_min, _Cur_vals);
+                    _Cur_idx_min           = _Op._Blend(_Cur_idx_min, _Cur_idx, _Is_less);
+                    _Cur_vals_min          = _Op._Blend(_Cur_vals_min, _Cur_vals, _Is_less);
+                }
 
+                if constexpr (_Mode == _Mode_max) {
+                    // Take the new lane only if it is strictly greater, so the first maximum stays
+                    const _Vec_t _Cur_vals   = _Op._Load_max(_First);
+                    const _Vec_t _Is_greater = _Op._Cmp_gt(_Cur_vals, _Cur_vals_max);
+                    _Cur_idx_max             = _Op._Blend(_Cur_idx_max, _Cur_idx, _Is_greater);
+                    _Cur_vals_max            = _Op._Blend(_Cur_vals_max, _Cur_vals, _Is_greater);
+                } else if constexpr (_Mode == _Mode_both) {
+                    // Keep the old lane only if it is strictly greater, so the last maximum is found
+                    const _Vec_t _Cur_vals = _Op._Load_max(_First);
+                    const _Vec_t _Is_less  = _Op._Cmp_gt(_Cur_vals_max, _Cur_vals);
+                    _Cur_idx_max           = _Op._Blend(_Cur_idx, _Cur_idx_max, _Is_less);
+                    _Cur_vals_max          = _Op._Blend(_Cur_vals, _Cur_vals_max, _Is_less);
+                }
+            }
+
+            // A handful of lanes: fold them in scalar code, ordering ties by the element position
+            _Key_t _Keys[_Lanes];
+            _Idx_t _Idx[_Lanes];
+
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                _Op._Store(_Keys, _Cur_vals_min);
+                _Op._Store(_Idx, _Cur_idx_min);
+
+                _Key_t _Best_key = _Keys[0];
+                size_t _Best_pos = static_cast<size_t>(_Idx[0]) * _Lanes;
+                for (size_t _Lane = 1; _Lane != _Lanes; ++_Lane) {
+                    const size_t _Pos = static_cast<size_t>(_Idx[_Lane]) * _Lanes + _Lane;
+                    if (_Keys[_Lane] < _Best_key || (_Keys[_Lane] == _Best_key && _Pos < _Best_pos)) {
+                        _Best_key = _Keys[_Lane];
+                        _Best_pos = _Pos;
+                    }
+                }
+
+                if (_Best_key < _Cur_min_key) {
+                    _Cur_min_key = _Best_key;
+                    _Res._Min    = _Base + _Best_pos * sizeof(_Key_t);
+                }
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                _Op._Store(_Keys, _Cur_vals_max);
+                _Op._Store(_Idx, _Cur_idx_max);
+
+                _Key_t _Best_key = _Keys[0];
+                size_t _Best_pos = static_cast<size_t>(_Idx[0]) * _Lanes;
+                for (size_t _Lane = 1; _Lane != _Lanes; ++_Lane) {
+                    const size_t _Pos = static_cast<size_t>(_Idx[_Lane]) * _Lanes + _Lane;
+                    if (_Keys[_Lane] > _Best_key
+                        || (_Keys[_Lane] == _Best_key && (_Mode == _Mode_both ? _Pos > _Best_pos : _Pos < _Best_pos))) {
+                        _Best_key = _Keys[_Lane];
+                        _Best_pos = _Pos;
+                    }
+                }
+
+                if (_Mode == _Mode_both && _Cur_max_key <= _Best_key || _Mode == _Mode_max && _Cur_max_key < _Best_key) {
+                    _Cur_max_key = _Best_key;
+                    _Res._Max    = _Base + _Best_pos * sizeof(_Key_t);
+                }
+            }
+
+            _Vec_size -= _Portion_size;
+        }
+    }
+
+    struct _Minmax_keys_avx2_8 {
+        using _Key_t = int64_t;
+        using _Idx_t = uint64_t;
+        using _Vec_t = __m256i;
+
+        __m256i _Sign_correction;
+
+        explicit _Minmax_keys_avx2_8(const bool _Sign) noexcept
+            : _Sign_correction(_mm256_set1_epi64x(_Sign ? 0 : static_cast<int64_t>(0x8000'0000'0000'0000ULL))) {}
+
+        __m256i _Load_min(const void* const _Src) const noexcept {
+            return _mm256_xor_si256(_mm256_loadu_si256(static_cast<const __m256i*>(_Src)), _Sign_correction);
+        }
+
+        __m256i _Load_max(const void* const _Src) const noexcept {
+            return _Load_min(_Src);
+        }
+
+        __m256i _Cmp_gt(const __m256i _First, const __m256i _Second) const noexcept {
+            return _mm256_cmpgt_epi64(_First, _Second);
+        }
+
+        __m256i _Blend(const __m256i _First, const __m256i _Second, const __m256i _Mask) const noexcept {
+            return _mm256_blendv_epi8(_First, _Second, _Mask);
+        }
+
+        __m256i _Zero() const noexcept {
+            return _mm256_setzero_si256();
+        }
+
+        __m256i _Inc(const __m256i _Idx) const noexcept {
+            return _mm256_add_epi64(_Idx, _mm256_set1_epi64x(1));
+        }
+
+        template <class _Ty>
+        void _Store(_Ty* const _Dest, const __m256i _Val) const noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    // The scalar side of the floating-point keys, for the tail and the first element
+
+    struct _Minmax_fp_traits_f {
+        using _Key_t = int32_t;
+        using _Idx_t = uint32_t;
+
+        static constexpr _Key_t _Key_min = static_cast<_Key_t>(0x8000'0000UL);
+        static constexpr _Key_t _Key_max = static_cast<_Key_t>(0x7FFF'FFFFUL);
+
+        static bool _Is_nan(const void* const _Src) noexcept {
+            return (*static_cast<const uint32_t*>(_Src) & 0x7FFF'FFFFUL) > 0x7F80'0000UL;
+        }
+
+        static _Key_t _Key(const void* const _Src) noexcept {
+            const uint32_t _Bits = *static_cast<const uint32_t*>(_Src);
+            return (_Bits & 0x8000'0000UL) ? -static_cast<_Key_t>(_Bits & 0x7FFF'FFFFUL) : static_cast<_Key_t>(_Bits);
+        }
+    };
+
+    struct _Minmax_fp_traits_d {
+        using _Key_t = int64_t;
+        using _Idx_t = uint64_t;
+
+        static constexpr _Key_t _Key_min = static_cast<_Key_t>(0x8000'0000'0000'0000ULL);
+        static constexpr _Key_t _Key_max = static_cast<_Key_t>(0x7FFF'FFFF'FFFF'FFFFULL);
+
+        static bool _Is_nan(const void* const _Src) noexcept {
+            return (*static_cast<const uint64_t*>(_Src) & 0x7FFF'FFFF'FFFF'FFFFULL) > 0x7FF0'0000'0000'0000ULL;
+        }
+
+        static _Key_t _Key(const void* const _Src) noexcept {
+            const uint64_t _Bits = *static_cast<const uint64_t*>(_Src);
+            return (_Bits & 0x8000'0000'0000'0000ULL) ? -static_cast<_Key_t>(_Bits & 0x7FFF'FFFF'FFFF'FFFFULL)
+                                                      : static_cast<_Key_t>(_Bits);
+        }
+    };
+
+    template <class _Fp_traits>
+    struct _Minmax_keys_sse_fp : _Fp_traits {
+        using _Vec_t = __m128i;
+
+        static __m128i _Key_vec(const __m128i _Bits, const __m128i _Sentinel) noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                const __m128i _Neg = _mm_srai_epi32(_Bits, 31);
+                const __m128i _Abs = _mm_and_si128(_Bits, _mm_set1_epi32(0x7FFF'FFFF));
+                const __m128i _Nan = _mm_cmpgt_epi32(_Abs, _mm_set1_epi32(0x7F80'0000));
+                // (bits ^ neg) - neg is the negated magnitude for negative values
+                const __m128i _Key = _mm_sub_epi32(_mm_xor_si128(_Abs, _Neg), _Neg);
+                return _mm_blendv_epi8(_Key, _Sentinel, _Nan);
+            } else {
+                const __m128i _Neg = _mm_cmpgt_epi64(_mm_setzero_si128(), _Bits);
+                const __m128i _Abs = _mm_and_si128(_Bits, _mm_set1_epi64x(0x7FFF'FFFF'FFFF'FFFFLL));
+                const __m128i _Nan = _mm_cmpgt_epi64(_Abs, _mm_set1_epi64x(0x7FF0'0000'0000'0000LL));
+                const __m128i _Key = _mm_sub_epi64(_mm_xor_si128(_Abs, _Neg), _Neg);
+                return _mm_blendv_epi8(_Key, _Sentinel, _Nan);
+            }
+        }
+
+        static __m128i _Set(const typename _Fp_traits::_Key_t _Val) noexcept {
+            if constexpr (sizeof(_Val) == 4) {
+                return _mm_set1_epi32(_Val);
+            } else {
+                return _mm_set1_epi64x(_Val);
+            }
+        }
+
+        __m128i _Load_min(const void* const _Src) const noexcept {
+            return _Key_vec(_mm_loadu_si128(static_cast<const __m128i*>(_Src)), _Set(_Fp_traits::_Key_max));
+        }
+
+        __m128i _Load_max(const void* const _Src) const noexcept {
+            return _Key_vec(_mm_loadu_si128(static_cast<const __m128i*>(_Src)), _Set(_Fp_traits::_Key_min));
+        }
+
+        __m128i _Cmp_gt(const __m128i _First, const __m128i _Second) const noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                return _mm_cmpgt_epi32(_First, _Second);
+            } else {
+                return _mm_cmpgt_epi64(_First, _Second);
+            }
+        }
+
+        __m128i _Blend(const __m128i _First, const __m128i _Second, const __m128i _Mask) const noexcept {
+            return _mm_blendv_epi8(_First, _Second, _Mask);
+        }
+
+        __m128i _Zero() const noexcept {
+            return _mm_setzero_si128();
+        }
+
+        __m128i _Inc(const __m128i _Idx) const noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                return _mm_add_epi32(_Idx, _mm_set1_epi32(1));
+            } else {
+                return _mm_add_epi64(_Idx, _mm_set1_epi64x(1));
+            }
+        }
+
+        template <class _Ty>
+        void _Store(_Ty* const _Dest, const __m128i _Val) const noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+    };
+
+    template <class _Fp_traits>
+    struct _Minmax_keys_avx2_fp : _Fp_traits {
+        using _Vec_t = __m256i;
+
+        static __m256i _Key_vec(const __m256i _Bits, const __m256i _Sentinel) noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                const __m256i _Neg = _mm256_srai_epi32(_Bits, 31);
+                const __m256i _Abs = _mm256_and_si256(_Bits, _mm256_set1_epi32(0x7FFF'FFFF));
+                const __m256i _Nan = _mm256_cmpgt_epi32(_Abs, _mm256_set1_epi32(0x7F80'0000));
+                const __m256i _Key = _mm256_sub_epi32(_mm256_xor_si256(_Abs, _Neg), _Neg);
+                return _mm256_blendv_epi8(_Key, _Sentinel, _Nan);
+            } else {
+                const __m256i _Neg = _mm256_cmpgt_epi64(_mm256_setzero_si256(), _Bits);
+                const __m256i _Abs = _mm256_and_si256(_Bits, _mm256_set1_epi64x(0x7FFF'FFFF'FFFF'FFFFLL));
+                const __m256i _Nan = _mm256_cmpgt_epi64(_Abs, _mm256_set1_epi64x(0x7FF0'0000'0000'0000LL));
+                const __m256i _Key = _mm256_sub_epi64(_mm256_xor_si256(_Abs, _Neg), _Neg);
+                return _mm256_blendv_epi8(_Key, _Sentinel, _Nan);
+            }
+        }
+
+        static __m256i _Set(const typename _Fp_traits::_Key_t _Val) noexcept {
+            if constexpr (sizeof(_Val) == 4) {
+                return _mm256_set1_epi32(_Val);
+            } else {
+                return _mm256_set1_epi64x(_Val);
+            }
+        }
+
+        __m256i _Load_min(const void* const _Src) const noexcept {
+            return _Key_vec(_mm256_loadu_si256(static_cast<const __m256i*>(_Src)), _Set(_Fp_traits::_Key_max));
+        }
+
+        __m256i _Load_max(const void* const _Src) const noexcept {
+            return _Key_vec(_mm256_loadu_si256(static_cast<const __m256i*>(_Src)), _Set(_Fp_traits::_Key_min));
+        }
+
+        __m256i _Cmp_gt(const __m256i _First, const __m256i _Second) const noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                return _mm256_cmpgt_epi32(_First, _Second);
+            } else {
+                return _mm256_cmpgt_epi64(_First, _Second);
+            }
+        }
+
+        __m256i _Blend(const __m256i _First, const __m256i _Second, const __m256i _Mask) const noexcept {
+            return _mm256_blendv_epi8(_First, _Second, _Mask);
+        }
+
+        __m256i _Zero() const noexcept {
+            return _mm256_setzero_si256();
+        }
+
+        __m256i _Inc(const __m256i _Idx) const noexcept {
+            if constexpr (sizeof(typename _Fp_traits::_Key_t) == 4) {
+                return _mm256_add_epi32(_Idx, _mm256_set1_epi32(1));
+            } else {
+                return _mm256_add_epi64(_Idx, _mm256_set1_epi64x(1));
+            }
+        }
+
+        template <class _Ty>
+        void _Store(_Ty* const _Dest, const __m256i _Val) const noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    // min_element and max_element compare with <, so nothing replaces a leading NaN and a later NaN replaces
+    // nothing; minmax_element is given the same meaning. Equal keys make -0.0 and +0.0 ties.
+    template <_Min_max_mode _Mode, class _Fp_traits>
+    auto _Minmax_element_fp(const void* _First, const void* const _Last) noexcept {
+        using _Key_t = typename _Fp_traits::_Key_t;
+
+        _Min_max_element_t _Res = {_First, _First};
+        _Key_t _Cur_min_key     = _Fp_traits::_Key_max;
+        _Key_t _Cur_max_key     = _Fp_traits::_Key_min;
+
+        if (_First != _Last && !_Fp_traits::_Is_nan(_First)) {
+            if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
+                _Minmax_element_keys<_Mode>(
+                    _First, _Last, _Res, _Minmax_keys_avx2_fp<_Fp_traits>{}, _Cur_min_key, _Cur_max_key);
+            }
+
+            if (_Byte_length(_First, _Last) >= 16 && _Use_sse42()) {
+                _Minmax_element_keys<_Mode>(
+                    _First, _Last, _Res, _Minmax_keys_sse_fp<_Fp_traits>{}, _Cur_min_key, _Cur_max_key);
+            }
+
+            for (; _First != _Last; _Advance_bytes(_First, sizeof(_Key_t))) {
+                if (_Fp_traits::_Is_nan(_First)) {
+                    continue;
+                }
+
+                const _Key_t _Key = _Fp_traits::_Key(_First);
+                if constexpr ((_Mode & _Mode_min) != 0) {
+                    if (_Key < _Cur_min_key) {
+                        _Cur_min_key = _Key;
+                        _Res._Min    = _First;
+                    }
+                }
+
+                if constexpr (_Mode == _Mode_max) {
+                    if (_Cur_max_key < _Key) {
+                        _Cur_max_key = _Key;
+                        _Res._Max    = _First;
+                    }
+                } else if constexpr (_Mode == _Mode_both) {
+                    if (_Cur_max_key <= _Key) {
+                        _Cur_max_key = _Key;
+                        _Res._Max    = _First;
+                    }
+                }
+            }
+        }
+
+        if constexpr (_Mode == _Mode_min) {
+            return _Res._Min;
+        } else if constexpr (_Mode == _Mode_max) {
+            return _Res._Max;
+        } else {
+            return _Res;
+        }
+    }
+
+    // _Minmax_element has exactly the same signature as the extern "C" functions
+    // (__std_min_element_N, __std_max_element_N, __std_minmax_element_N), up to calling convention.
+    // This makes sure the template specialization is fused with the extern "C" function.
+    // In optimized builds it avoids an extra call, as this function is too large to inline.
+    template <_Min_max_mode _Mode, class _Traits>
+    auto __stdcall _Minmax_element(const void* _First, const void* const _Last, const bool _Sign) noexcept {
+        _Min_max_element_t _Res = {_First, _First};
+        auto _Cur_min_val       = _Traits::_Init_min_val;
+        auto _Cur_max_val       = _Traits::_Init_max_val;
+
+#ifdef _M_X64
+        // Below a single piece the horizontal part would cost more than the search
+        if (_Byte_length(_First, _Last) >= 64 && _Use_avx512()) {
+            _Minmax_element_avx512<_Mode, _Traits>(_First, _Last, _Res, _Sign, _Cur_min_val, _Cur_max_val);
+        }
+#endif // _M_X64
+
+        if constexpr (sizeof(_Cur_min_val) == 8) {
+            // pcmpgtq compares two lanes at a time; four are worth the scalar horizontal part of the key search
+            if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
+                _Minmax_element_keys<_Mode>(
+                    _First, _Last, _Res, _Minmax_keys_avx2_8{_Sign}, _Cur_min_val, _Cur_max_val);
+            }
+        }
+
+        if (_Byte_length(_First, _Last) >= 16 && _Use_sse42()) {
+            auto _Base                = static_cast<const char*>(_First);
+            size_t _Portion_byte_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+
+            if constexpr (_Traits::_Has_portion_max) {
+                // vector of indices will wrap around at exactly this size
+                constexpr size_t _Max_portion_byte_size = _Traits::_Portion_max * 16;
+                if (_Portion_byte_size > _Max_portion_byte_size) {
+                    _Portion_byte_size = _Max_portion_byte_size;
+                }
+            }
+
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Portion_byte_size);
+
+            // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
+            __m128i _Cur_vals =
+                _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
+            __m128i _Cur_vals_min = _Cur_vals; // vector of vertical minimum values
+            __m128i _Cur_idx_min  = _mm_setzero_si128(); // vector of vertical minimum indices
+            __m128i _Cur_vals_max = _Cur_vals; // vector of vertical maximum values
+            __m128i _Cur_idx_max  = _mm_setzero_si128(); // vector of vertical maximum indices
+            __m128i _Cur_idx      = _mm_setzero_si128(); // current vector of indices
+
+            for (;;) {
+                _Advance_bytes(_First, 16);
+
+                // Increment vertical indices. Will stop at exactly wrap around, if not reach the end before
+                _Cur_idx = _Traits::_Inc(_Cur_idx);
+
+                if (_First == _Stop_at) {
+                    // Reached end or indices wrap around point.
+                    // Compute horizontal min and/or max. Determine horizontal and vertical position of it.
+
+                    if constexpr ((_Mode & _Mode_min) != 0) {
+                        const __m128i _H_min =
+                            _Traits::_H_min(_Cur_vals_min); // Vector populated by the smallest element
+                        const auto _H_min_val = _Traits::_Get_any(_H_min); // Get any element of it
+
+                        if (_H_min_val < _Cur_min_val) { // Current horizontal min is less than the old
+                            _Cur_min_val = _H_min_val; // update min
+                            const __m128i _Eq_mask =
+                                _Traits::_Cmp_eq(_H_min, _Cur_vals_min); // Mask of all elems eq to min
+                            int _Mask = _mm_movemask_epi8(_Eq_mask);
+                            // Indices of minimum elements or the greatest index if none
+                            const __m128i _All_max     = _mm_set1_epi8(static_cast<char>(0xFF));
+                            const __m128i _Idx_min_val = _mm_blendv_epi8(_All_max, _Cur_idx_min, _Eq_mask);
+                            __m128i _Idx_min           = _Traits::_H_min_u(_Idx_min_val); // The smallest indices
+                            // Select the smallest vertical indices from the smallest element mask
+                            _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_min, _Idx_min_val));
+                            unsigned long _H_pos;
+                            _BitScanForward(&_H_pos, _Mask); // Find the smallest horizontal index
+                            const auto _V_pos = _Traits::_Get_v_pos(_Cur_idx_min, _H_pos); // Extract its vertical index
+                            _Res._Min         = _Base + _V_pos * 16 + _H_pos; // Finally, compute the pointer
+                        }
+                    }
+
+                    if constexpr ((_Mode & _Mode_max) != 0) {
+                        const __m128i _H_max =
+                            _Traits::_H_max(_Cur_vals_max); // Vector populated by the largest element
+                        const auto _H_max_val = _Traits::_Get_any(_H_max); // Get any element of it
+
+                        if (_Mode == _Mode_both && _Cur_max_val <= _H_max_val
+                            || _Mode == _Mode_max && _Cur_max_val < _H_max_val) {
+                            // max_element: current horizontal max is greater than the old, update max
+                            // minmax_element: current horizontal max is not less than the old, update max
+                            _Cur_max_val = _H_max_val;
+                            const __m128i _Eq_mask =
+                                _Traits::_Cmp_eq(_H_max, _Cur_vals_max); // Mask of all elems eq to max
+                            int _Mask = _mm_movemask_epi8(_Eq_mask);
+
+                            unsigned long _H_pos;
+                            if constexpr (_Mode == _Mode_both) {
+                                // Looking for the last occurrence of maximum
+                                // Indices of maximum elements or zero if none
+                                const __m128i _Idx_max_val =
+                                    _mm_blendv_epi8(_mm_setzero_si128(), _Cur_idx_max, _Eq_mask);
+                                const __m128i _Idx_max = _Traits::_H_max_u(_Idx_max_val); // The greatest indices
+                                // Select the greatest vertical indices from the largest element mask
+                                _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_max, _Idx_max_val));
+                                _BitScanReverse(&_H_pos, _Mask); // Find the largest horizontal index
+                                _H_pos -= sizeof(_Cur_max_val) - 1; // Correct from highest val bit to lowest
+                            } else {
+                                // Looking for the first occurrence of maximum
+                                // Indices of maximum elements or the greatest index if none
+                                const __m128i _All_max     = _mm_set1_epi8(static_cast<char>(0xFF));
+                                const __m128i _Idx_max_val = _mm_blendv_epi8(_All_max, _Cur_idx_max, _Eq_mask);
+                                const __m128i _Idx_max     = _Traits::_H_min_u(_Idx_max_val); // The smallest indices
+                                // Select the smallest vertical indices from the largest element mask
+                                _Mask &= _mm_movemask_epi8(_Traits::_Cmp_eq(_Idx_max, _Idx_max_val));
+                                _BitScanForward(&_H_pos, _Mask); // Find the smallest horizontal index
+                            }
+
+                            const auto _V_pos = _Traits::_Get_v_pos(_Cur_idx_max, _H_pos); // Extract its vertical index
+                            _Res._Max         = _Base + _V_pos * 16 + _H_pos; // Finally, compute the pointer
+                        }
+                    }
+                    // Horizontal part done, results are saved, now need to see if there is another portion to process
+
+                    if constexpr (_Traits::_Has_portion_max) {
+                        // Either the last portion or wrapping point reached, need to determine
+                        _Portion_byte_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+                        if (_Portion_byte_size == 0) {
+                            break; // That was the last portion
+                        }
+                        // Start next portion to handle the wrapping indices. Assume _Cur_idx is zero
+                        constexpr size_t _Max_portion_byte_size = _Traits::_Portion_max * 16;
+                        if (_Portion_byte_size > _Max_portion_byte_size) {
+                            _Portion_byte_size = _Max_portion_byte_size;
+                        }
+
+                        _Advance_bytes(_Stop_at, _Portion_byte_size);
+                        // Indices will be relative to the new base
+                        _Base = static_cast<const char*>(_First);
+                        // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
+                        _Cur_vals =
+                            _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
+
+                        if constexpr ((_Mode & _Mode_min) != 0) {
+                            _Cur_vals_min = _Cur_vals;
+                            _Cur_idx_min  = _mm_setzero_si128();
+                        }
+
+                        if constexpr ((_Mode & _Mode_max) != 0) {
+                            _Cur_vals_max = _Cur_vals;
+                            _Cur_idx_max  = _mm_setzero_si128();
+                        }
+
+                        continue;
+                    } else {
+                        break; // No wrapping, so it was the only portion
+                    }
+                }
+                // This is the main part, finding vertical minimum/maximum
+
+                // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
+                _Cur_vals = _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
+
+                if constexpr ((_Mode & _Mode_min) != 0) {
+                    // Looking for the first occurrence of minimum, don't overwrite with newly found occurrences
+                    const __m128i _Is_less = _Traits::_Cmp_gt(_Cur_vals_min, _Cur_vals); // _Cur_vals < _Cur_vals_min
+                    _Cur_idx_min = _mm_blendv_epi8(_Cur_idx_min, _Cur_idx, _Is_less); // Remember their vertical indices
+                    _Cur_vals_min = _Traits::_Min(_Cur_vals_min, _Cur_vals, _Is_less); // Update the current minimum
+                }
+
+                if constexpr (_Mode == _Mode_max) {
+                    // Looking for the first occurrence of maximum, don't overwrite with newly found occurrences
+                    const __m128i _Is_greater = _Traits::_Cmp_gt(_Cur_vals, _Cur_vals_max); // _Cur_vals > _Cur_vals_max
+                    _Cur_idx_max =
+                        _mm_blendv_epi8(_Cur_idx_max, _Cur_idx, _Is_greater); // Remember their vertical indices
+                    _Cur_vals_max = _Traits::_Max(_Cur_vals_max, _Cur_vals, _Is_greater); // Update the current maximum
+                } else if constexpr (_Mode == _Mode_both) {
+                    // Looking for the last occurrence of maximum, do overwrite with newly found occurrences
+                    const __m128i _Is_less =
+                        _Traits::_Cmp_gt(_Cur_vals_max, _Cur_vals); // !(_Cur_vals >= _Cur_vals_max)
+                    _Cur_idx_max = _mm_blendv_epi8(_Cur_idx, _Cur_idx_max, _Is_less); // Remember their vertical indices
+                    _Cur_vals_max = _Traits::_Max(_Cur_vals, _Cur_vals_max, _Is_less); // Update the current maximum
+                }
+            }
+        }
+
+        return _Minmax_tail<_Mode, typename _Traits::_Signed_t, typename _Traits::_Unsigned_t>(
+            _First, _Last, _Res, _Sign, _Cur_min_val, _Cur_max_val);
+    }
+
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_min_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_1>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_min_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_2>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_min_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_4>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_min_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_8>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_max_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_1>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_max_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_2>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_max_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_4>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_max_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_8>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_1>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_2>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_4>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_8>(_First, _Last, _Signed);
+}
+
+const void* __stdcall __std_min_element_f(const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_min, _Minmax_fp_traits_f>(_First, _Last);
+}
+
+const void* __stdcall __std_min_element_d(const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_min, _Minmax_fp_traits_d>(_First, _Last);
+}
+
+const void* __stdcall __std_max_element_f(const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_max, _Minmax_fp_traits_f>(_First, _Last);
+}
+
+const void* __stdcall __std_max_element_d(const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_max, _Minmax_fp_traits_d>(_First, _Last);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_f(
+    const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_both, _Minmax_fp_traits_f>(_First, _Last);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_d(
+    const void* const _First, const void* const _Last, bool) noexcept {
+    return _Minmax_element_fp<_Mode_both, _Minmax_fp_traits_d>(_First, _Last);
+}
+
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    const void* _Find_trivial_unsized_fallback(const void* _First, _Ty _Val) {
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        while (*_Ptr != _Val) {
+            ++_Ptr;
+        }
+        return _Ptr;
+    }
+
+    template <class _Ty>
+    const void* _Find_trivial_tail(const void* _First, const void* _Last, _Ty _Val) {
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        while (_Ptr != _Last && *_Ptr != _Val) {
+            ++_Ptr;
+        }
+        return _Ptr;
+    }
+
+    template <class _Ty>
+    __declspec(noalias) size_t _Count_trivial_tail(const void* _First, const void* _Last, size_t _Current, _Ty _Val) {
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        for (; _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Val) {
+                ++_Current;
+            }
+        }
+        return _Current;
+    }
+
+    struct _Find_traits_1 {
+        static constexpr size_t _Shift = 0;
+
+        static __m256i _Set_avx(const uint8_t _Val) noexcept {
+            return _mm256_set1_epi8(_Val);
+        }
+
+        static __m128i _Set_sse(const uint8_t _Val) noexcept {
+            return _mm_set1_epi8(_Val);
+        }
+
+        static __m512i _Set_avx512(const uint8_t _Val) noexcept {
+            return _mm512_set1_epi8(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi8(_Mask, _Src);
+        }
+
+        static __mmask64 _Cmp_avx512(const __mmask64 _Mask, const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_mask_cmpeq_epi8_mask(_Mask, _Lhs, _Rhs);
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Use_sse2();
+        }
+    };
+
+    struct _Find_traits_2 {
+        static constexpr size_t _Shift = 1;
+
+        static __m256i _Set_avx(const uint16_t _Val) noexcept {
+            return _mm256_set1_epi16(_Val);
+        }
+
+        static __m128i _Set_sse(const uint16_t _Val) noexcept {
+            return _mm_set1_epi16(_Val);
+        }
+
+        static __m512i _Set_avx512(const uint16_t _Val) noexcept {
+            return _mm512_set1_epi16(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi16(static_cast<__mmask32>(_Mask), _Src);
+        }
+
+        static __mmask64 _Cmp_avx512(const __mmask64 _Mask, const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_mask_cmpeq_epi16_mask(static_cast<__mmask32>(_Mask), _Lhs, _Rhs);
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Use_sse2();
+        }
+    };
+
+    struct _Find_traits_4 {
+        static constexpr size_t _Shift = 2;
+
+        static __m256i _Set_avx(const uint32_t _Val) noexcept {
+            return _mm256_set1_epi32(_Val);
+        }
+
+        static __m128i _Set_sse(const uint32_t _Val) noexcept {
+            return _mm_set1_epi32(_Val);
+        }
+
+        static __m512i _Set_avx512(const uint32_t _Val) noexcept {
+            return _mm512_set1_epi32(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(_Mask), _Src);
+        }
+
+        static __mmask64 _Cmp_avx512(const __mmask64 _Mask, const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_mask_cmpeq_epi32_mask(static_cast<__mmask16>(_Mask), _Lhs, _Rhs);
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Use_sse2();
+        }
+    };
+
+    struct _Find_traits_8 {
+        static constexpr size_t _Shift = 3;
+
+        static __m256i _Set_avx(const uint64_t _Val) noexcept {
+            return _mm256_set1_epi64x(_Val);
+        }
+
+        static __m128i _Set_sse(const uint64_t _Val) noexcept {
+            return _mm_set1_epi64x(_Val);
+        }
+
+        static __m512i _Set_avx512(const uint64_t _Val) noexcept {
+            return _mm512_set1_epi64(_Val);
+        }
+
+        static __m512i _Load_avx512(const __mmask64 _Mask, const void* const _Src) noexcept {
+            return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(_Mask), _Src);
+        }
+
+        static __mmask64 _Cmp_avx512(const __mmask64 _Mask, const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_mask_cmpeq_epi64_mask(static_cast<__mmask8>(_Mask), _Lhs, _Rhs);
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi64(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Use_sse42(); // for pcmpeqq on _Cmp_sse
+        }
+    };
+
+    // The below functions have exactly the same signature as the extern "C" functions, up to calling convention.
+    // This makes sure the template specialization is fused with the extern "C" function.
+    // In optimized builds it avoids an extra call, as this function is too large to inline.
+
+    template <class _Traits, class _Ty>
+    const void* __stdcall __std_find_trivial_unsized(const void* _First, const _Ty _Val) noexcept {
+#ifdef _M_X64
+        if (_Use_avx512()) {
+            // Aligned pieces as below, with the lanes before _First masked off the first compare
+            constexpr size_t _Vector_pad_mask = 0x3F;
+
+            const __m512i _Comparand  = _Traits::_Set_avx512(_Val);
+            const intptr_t _Pad_start = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
+            _Advance_bytes(_First, -_Pad_start);
+
+            __mmask64 _Bingo = _Traits::_Cmp_avx512(~_Low_mask_avx512(static_cast<size_t>(_Pad_start) >> _Traits::_Shift),
+                _mm512_load_si512(_First), _Comparand);
+
+            while (_Bingo == 0) {
+                _Advance_bytes(_First, 64);
+                _Bingo = _Traits::_Cmp_avx512(~0ULL, _mm512_load_si512(_First), _Comparand);
+            }
+
+            _Advance_bytes(_First, static_cast<ptrdiff_t>(_tzcnt_u64(_Bingo) << _Traits::_Shift));
+            return _First;
+        }
+#endif // _M_X64
+
+        if (_Use_avx2()) {
+            // We read by vector-sized pieces, and we align pointers to vector-sized boundary.
+            // From start partial piece we mask out matches that don't belong to the range.
+            // This makes sure we never cross page boundary, thus we read 'as if' sequentially.
+            constexpr size_t _Vector_pad_mask = 0x1F;
+            constexpr unsigned int _Full_mask = 0xFFFF'FFFF;
+
+            const __m256i _Comparand  = _Traits::_Set_avx(_Val);
+            const intptr_t _Pad_start = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
+            const unsigned int _Mask  = _Full_mask << _Pad_start;
+            _Advance_bytes(_First, -_Pad_start);
+
+            __m256i _Data       = _mm256_load_si256(static_cast<const __m256i*>(_First));
+            unsigned int _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand)));
+
+            if ((_Bingo &= _Mask) != 0) {
+                unsigned long _Offset = _tzcnt_u32(_Bingo);
+                _Advance_bytes(_First, _Offset);
+                return _First;
+            }
+
+            _Advance_bytes(_First, 32);
+
+            for (;;) {
+                _Data  = _mm256_load_si256(static_cast<const __m256i*>(_First));
+                _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand)));
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset = _tzcnt_u32(_Bingo);
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 32);
+            }
+        }
+
+        if (_Traits::_Sse_available()) {
+            // We read by vector-sized pieces, and we align pointers to vector-sized boundary.
+            // From start partial piece we mask out matches that don't belong to the range.
+            // This makes sure we never cross page boundary, thus we read 'as if' sequentially.
+            constexpr size_t _Vector_pad_mask = 0xF;
+            constexpr unsigned int _Full_mask = 0xFFFF;
+
+            const __m128i _Comparand  = _Traits::_Set_sse(_Val);
+            const intptr_t _Pad_start = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
+            const unsigned int _Mask  = _Full_mask << _Pad_start;
+            _Advance_bytes(_First, -_Pad_start);
+
+            __m128i _Data       = _mm_load_si128(static_cast<const __m128i*>(_First));
+            unsigned int _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand)));
+
+            if ((_Bingo &= _Mask) != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Bingo);
+                _Advance_bytes(_First, _Offset);
+                return _First;
+            }
+
+            _Advance_bytes(_First, 16);
+
+            for (;;) {
+                _Data  = _mm_load_si128(static_cast<const __m128i*>(_First));
+                _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand)));
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 16);
+            }
+        }
+
+        return _Find_trivial_unsized_fallback(_First, _Val);
+    }
+
+
+    template <class _Traits, class _Ty>
+    const void* __stdcall __std_find_trivial(const void* _First, const void* _Last, _Ty _Val) noexcept {
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+#ifdef _M_X64
+        if (_Use_avx512()) {
+            // Whole pieces, then one masked piece instead of the scalar tail
+            constexpr size_t _Lanes = 64 >> _Traits::_Shift;
+
+            const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+            for (size_t _Left = _Size_bytes >> _Traits::_Shift;; _Left -= _Lanes) {
+                const __mmask64 _Mask  = _Low_mask_avx512(_Left);
+                const __mmask64 _Bingo = _Traits::_Cmp_avx512(_Mask, _Traits::_Load_avx512(_Mask, _First), _Comparand);
+
+                if (_Bingo != 0) {
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_tzcnt_u64(_Bingo) << _Traits::_Shift));
+                    return _First;
+                }
+
+                if (_Left <= _Lanes) {
+                    return _Last;
+                }
+
+                _Advance_bytes(_First, 64);
+            }
+        }
+#endif // _M_X64
+
+        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
+        if (_Avx_size != 0 && _Use_avx2()) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+
+                if (_Bingo != 0) {
+                    const unsigned long _Offset = _tzcnt_u32(_Bingo);
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+            _Size_bytes &= 0x1F;
+        }
+
+        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+        if (_Sse_size != 0 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        return _Find_trivial_tail(_First, _Last, _Val);
+    }
+
+    template <class _Traits, class _Ty>
+    __declspec(noalias) size_t
+        __stdcall __std_count_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+        size_t _Result     = 0;
+
+#ifdef _M_X64
+        if (_Use_avx512()) {
+            // Whole pieces, then one masked piece instead of the scalar tail; one mask bit per element
+            constexpr size_t _Lanes = 64 >> _Traits::_Shift;
+
+            const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+            for (size_t _Left = _Size_bytes >> _Traits::_Shift;; _Left -= _Lanes) {
+                const __mmask64 _Mask = _Low_mask_avx512(_Left);
+                _Result += __popcnt64(_Traits::_Cmp_avx512(_Mask, _Traits::_Load_avx512(_Mask, _First), _Comparand));
+
+                if (_Left <= _Lanes) {
+                    return _Result;
+                }
+
+                _Advance_bytes(_First, 64);
+            }
+        }
+#endif // _M_X64
+
+        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
+        if (_Avx_size != 0 && _Use_avx2()) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                _Result += __popcnt(_Bingo); // Assume available with SSE4.2
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+            _Size_bytes &= 0x1F;
+        }
+
+        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+        if (_Sse_size != 0 && _Use_sse42()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                _Result += __popcnt(_Bingo); // Assume available with SSE4.2
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        return _Count_trivial_tail(_First, _Last, _Result >> _Traits::_Shift, _Val);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_find_trivial_unsized_1(const void* const _First, const uint8_t _Val) noexcept {
+    return __std_find_trivial_unsized<_Find_traits_1>(_First, _Val);
+}
+
+const void* __stdcall __std_find_trivial_unsized_2(const void* const _First, const uint16_t _Val) noexcept {
+    return __std_find_trivial_unsized<_Find_traits_2>(_First, _Val);
+}
+
+const void* __stdcall __std_find_trivial_unsized_4(const void* const _First, const uint32_t _Val) noexcept {
+    return __std_find_trivial_unsized<_Find_traits_4>(_First, _Val);
+}
+
+const void* __stdcall __std_find_trivial_unsized_8(const void* const _First, const uint64_t _Val) noexcept {
+    return __std_find_trivial_unsized<_Find_traits_8>(_First, _Val);
+}
+
+const void* __stdcall __std_find_trivial_1(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_find_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_find_trivial_2(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_find_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_find_trivial_4(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_find_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_find_trivial_8(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_find_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_count_trivial_1(const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_count_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_count_trivial_2(const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_count_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_count_trivial_4(const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_count_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_count_trivial_8(const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_count_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+} // extern "C"
+
+
+namespace {
+    template <class _Ty>
+    bool _Equal_elements(const _Ty* _First1, const _Ty* _First2, size_t _Count) noexcept {
+        for (; _Count != 0; --_Count, ++_First1, ++_First2) {
+            if (*_First1 != *_First2) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class _Ty>
+    __m128i _Load_partial_sse(const _Ty* const _Src, const size_t _Count) noexcept {
+        // Reads exactly _Count elements, so the last piece of a range never touches memory past its end
+        alignas(16) _Ty _Tmp[16 / sizeof(_Ty)] = {};
+        for (size_t _Idx = 0; _Idx != _Count; ++_Idx) {
+            _Tmp[_Idx] = _Src[_Idx];
+        }
+        return _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp));
+    }
+
+    template <class _Ty>
+    const void* _Search_tail(
+        const void* const _First1, const void* const _Last1, const _Ty* const _Needle, const size_t _Count2) noexcept {
+        auto _Ptr                 = static_cast<const _Ty*>(_First1);
+        const size_t _Count1      = static_cast<const _Ty*>(_Last1) - _Ptr;
+        if (_Count1 < _Count2) {
+            return _Last1;
+        }
+
+        const auto _Stop_at = _Ptr + (_Count1 - _Count2 + 1);
+        for (; _Ptr != _Stop_at; ++_Ptr) {
+            if (*_Ptr == *_Needle && _Equal_elements(_Ptr + 1, _Needle + 1, _Count2 - 1)) {
+                return _Ptr;
+            }
+        }
+        return _Last1;
+    }
+
+    template <class _Ty>
+    const void* _Find_end_tail(const void* const _First1, const void* const _Candidates_end, const _Ty* const _Needle,
+        const size_t _Count2, const void* const _Last1) noexcept {
+        // Candidate positions are [_First1, _Candidates_end), tried from the back
+        const auto _Begin = static_cast<const _Ty*>(_First1);
+        for (auto _Ptr = static_cast<const _Ty*>(_Candidates_end); _Ptr != _Begin;) {
+            --_Ptr;
+            if (*_Ptr == *_Needle && _Equal_elements(_Ptr + 1, _Needle + 1, _Count2 - 1)) {
+                return _Ptr;
+            }
+        }
+        return _Last1;
+    }
+
+    template <class _Ty>
+    const void* _Find_first_of_tail(const void* const _First1, const void* const _Last1, const _Ty* const _Needle,
+        const size_t _Count2) noexcept {
+        auto _Ptr = static_cast<const _Ty*>(_First1);
+        for (; _Ptr != _Last1; ++_Ptr) {
+            for (size_t _Idx = 0; _Idx != _Count2; ++_Idx) {
+                if (*_Ptr == _Needle[_Idx]) {
+                    return _Ptr;
+                }
+            }
+        }
+        return _Ptr;
+    }
+
+    const void* _Find_first_of_bitmap(const void* const _First1, const void* const _Last1,
+        const uint8_t* const _Needle, const size_t _Count2) noexcept {
+        uint32_t _Table[256 / 32] = {};
+        for (size_t _Idx = 0; _Idx != _Count2; ++_Idx) {
+            _Table[_Needle[_Idx] >> 5] |= uint32_t{1} << (_Needle[_Idx] & 0x1F);
+        }
+
+        auto _Ptr = static_cast<const uint8_t*>(_First1);
+        for (; _Ptr != _Last1; ++_Ptr) {
+            if ((_Table[*_Ptr >> 5] & (uint32_t{1} << (*_Ptr & 0x1F))) != 0) {
+                break;
+            }
+        }
+        return _Ptr;
+    }
+
+    struct _Search_traits_1 : _Find_traits_1 {
+        using _Ty = uint8_t;
+
+        static constexpr int _Str_ops = _SIDD_UBYTE_OPS;
+
+        // One movemask bit per element
+        static constexpr unsigned int _Lanes_mask = 0xFFFF'FFFF;
+    };
+
+    struct _Search_traits_2 : _Find_traits_2 {
+        using _Ty = uint16_t;
+
+        static constexpr int _Str_ops = _SIDD_UWORD_OPS;
+
+        // Two movemask bits per element, keep the lower one
+        static constexpr unsigned int _Lanes_mask = 0x5555'5555;
+    };
+
+    template <class _Traits>
+    const void* __stdcall __std_search(const void* _First1, const void* const _Last1, const void* const _First2,
+        const size_t _Count2) noexcept {
+        using _Ty          = typename _Traits::_Ty;
+        const auto _Needle = static_cast<const _Ty*>(_First2);
+
+        if (_Count2 == 0) {
+            return _First1;
+        }
+
+        if (_Count2 == 1) {
+            return __std_find_trivial<_Traits>(_First1, _Last1, *_Needle);
+        }
+
+        const size_t _Needle_bytes = _Count2 << _Traits::_Shift;
+        if (_Byte_length(_First1, _Last1) < _Needle_bytes) {
+            return _Last1;
+        }
+
+        if (_Use_avx2()) {
+            // Candidates are filtered by the first and the last needle elements at once, then the middle is
+            // compared element-wise. The piece for the last element ends exactly where the range ends, at worst.
+            const size_t _Last_offset   = _Needle_bytes - sizeof(_Ty);
+            const __m256i _First_needle = _Traits::_Set_avx(_Needle[0]);
+            const __m256i _Last_needle  = _Traits::_Set_avx(_Needle[_Count2 - 1]);
+
+            while (_Byte_length(_First1, _Last1) >= _Last_offset + 32) {
+                const __m256i _Data_first = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                const void* _Last_at      = _First1;
+                _Advance_bytes(_Last_at, _Last_offset);
+                const __m256i _Data_last = _mm256_loadu_si256(static_cast<const __m256i*>(_Last_at));
+                const __m256i _Eq        = _mm256_and_si256(
+                    _Traits::_Cmp_avx(_Data_first, _First_needle), _Traits::_Cmp_avx(_Data_last, _Last_needle));
+                unsigned int _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Eq)) & _Traits::_Lanes_mask;
+
+                while (_Bingo != 0) {
+                    const unsigned long _Offset = _tzcnt_u32(_Bingo);
+                    const auto _Candidate =
+                        reinterpret_cast<const _Ty*>(static_cast<const unsigned char*>(_First1) + _Offset);
+                    if (_Equal_elements(_Candidate + 1, _Needle + 1, _Count2 - 2)) {
+                        return _Candidate;
+                    }
+                    _Bingo &= _Bingo - 1;
+                }
+
+                _Advance_bytes(_First1, 32);
+            }
+        }
+
+        if (_Use_sse42()) {
+            // pcmpestri in equal ordered mode gives the first position where the needle prefix starts, including
+            // one that only partially fits before the end of the piece; the next piece then starts there.
+            constexpr int _Op          = _Traits::_Str_ops | _SIDD_CMP_EQUAL_ORDERED | _SIDD_LEAST_SIGNIFICANT;
+            constexpr size_t _Part     = 16 >> _Traits::_Shift;
+            const size_t _Needle_part  = _Count2 < _Part ? _Count2 : _Part;
+            const __m128i _Needle_head = _Load_partial_sse(_Needle, _Needle_part);
+
+            for (;;) {
+                const size_t _Left = _Byte_length(_First1, _Last1) >> _Traits::_Shift;
+                if (_Left < _Count2) {
+                    return _Last1;
+                }
+
+                const size_t _Data_part = _Left < _Part ? _Left : _Part;
+                const __m128i _Data     = _Left < _Part ? _Load_partial_sse(static_cast<const _Ty*>(_First1), _Left)
+                                                        : _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+                const size_t _Pos       = static_cast<size_t>(_mm_cmpestri(_Needle_head,
+                    static_cast<int>(_Needle_part), _Data, static_cast<int>(_Data_part), _Op));
+
+                if (_Pos >= _Data_part) {
+                    if (_Data_part != _Part) {
+                        return _Last1;
+                    }
+
+                    _Advance_bytes(_First1, 16);
+                    continue;
+                }
+
+                if (_Left - _Pos < _Count2) {
+                    return _Last1;
+                }
+
+                const auto _Candidate = static_cast<const _Ty*>(_First1) + _Pos;
+                if (_Pos + _Count2 <= _Data_part // whole needle already matched inside the piece
+                    || _Equal_elements(_Candidate + 1, _Needle + 1, _Count2 - 1)) {
+                    return _Candidate;
+                }
+
+                _First1 = _Candidate + 1;
+            }
+        }
+
+        return _Search_tail(_First1, _Last1, _Needle, _Count2);
+    }
+
+    template <class _Traits>
+    const void* __stdcall __std_find_end(const void* const _First1, const void* const _Last1,
+        const void* const _First2, const size_t _Count2) noexcept {
+        using _Ty          = typename _Traits::_Ty;
+        const auto _Needle = static_cast<const _Ty*>(_First2);
+
+        const size_t _Needle_bytes = _Count2 << _Traits::_Shift;
+        if (_Count2 == 0 || _Byte_length(_First1, _Last1) < _Needle_bytes) {
+            return _Last1;
+        }
+
+        // Candidate positions are [_First1, _Candidates_end); pieces are taken from the back, so the piece for
+        // the last element of the first one tried ends exactly at _Last1.
+        const size_t _Last_offset   = _Needle_bytes - sizeof(_Ty);
+        const void* _Candidates_end = _Last1;
+        _Advance_bytes(_Candidates_end, -static_cast<ptrdiff_t>(_Last_offset));
+
+        if (_Byte_length(_First1, _Candidates_end) >= 32 && _Use_avx2()) {
+            const __m256i _First_needle = _Traits::_Set_avx(_Needle[0]);
+            const __m256i _Last_needle  = _Traits::_Set_avx(_Needle[_Count2 - 1]);
+
+            do {
+                _Advance_bytes(_Candidates_end, -32);
+                const __m256i _Data_first = _mm256_loadu_si256(static_cast<const __m256i*>(_Candidates_end));
+                const void* _Last_at      = _Candidates_end;
+                _Advance_bytes(_Last_at, _Last_offset);
+                const __m256i _Data_last = _mm256_loadu_si256(static_cast<const __m256i*>(_Last_at));
+                const __m256i _Eq        = _mm256_and_si256(
+                    _Traits::_Cmp_avx(_Data_first, _First_needle), _Traits::_Cmp_avx(_Data_last, _Last_needle));
+                unsigned int _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Eq)) & _Traits::_Lanes_mask;
+
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, _Bingo);
+                    const auto _Candidate =
+                        reinterpret_cast<const _Ty*>(static_cast<const unsigned char*>(_Candidates_end) + _Offset);
+                    if (_Equal_elements(_Candidate + 1, _Needle + 1, _Count2 - 1)) {
+                        return _Candidate;
+                    }
+                    _Bingo ^= 1U << _Offset;
+                }
+            } while (_Byte_length(_First1, _Candidates_end) >= 32);
+        }
+
+        if (_Byte_length(_First1, _Candidates_end) >= 16 && _Traits::_Sse_available()) {
+            const __m128i _First_needle = _Traits::_Set_sse(_Needle[0]);
+            const __m128i _Last_needle  = _Traits::_Set_sse(_Needle[_Count2 - 1]);
+
+            do {
+                _Advance_bytes(_Candidates_end, -16);
+                const __m128i _Data_first = _mm_loadu_si128(static_cast<const __m128i*>(_Candidates_end));
+                const void* _Last_at      = _Candidates_end;
+                _Advance_bytes(_Last_at, _Last_offset);
+                const __m128i _Data_last = _mm_loadu_si128(static_cast<const __m128i*>(_Last_at));
+                const __m128i _Eq        = _mm_and_si128(
+                    _Traits::_Cmp_sse(_Data_first, _First_needle), _Traits::_Cmp_sse(_Data_last, _Last_needle));
+                unsigned int _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Eq)) & _Traits::_Lanes_mask;
+
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, _Bingo);
+                    const auto _Candidate =
+                        reinterpret_cast<const _Ty*>(static_cast<const unsigned char*>(_Candidates_end) + _Offset);
+                    if (_Equal_elements(_Candidate + 1, _Needle + 1, _Count2 - 1)) {
+                        return _Candidate;
+                    }
+                    _Bingo ^= 1U << _Offset;
+                }
+            } while (_Byte_length(_First1, _Candidates_end) >= 16);
+        }
+
+        return _Find_end_tail(_First1, _Candidates_end, _Needle, _Count2, _Last1);
+    }
+
+    template <class _Traits>
+    const void* __stdcall __std_find_first_of_trivial(const void* _First1, const void* const _Last1,
+        const void* const _First2, const void* const _Last2) noexcept {
+        using _Ty            = typename _Traits::_Ty;
+        const auto _Needle   = static_cast<const _Ty*>(_First2);
+        const size_t _Count2 = _Byte_length(_First2, _Last2) >> _Traits::_Shift;
+
+        if (_Count2 == 0) {
+            return _Last1;
+        }
+
+        if (_Count2 == 1) {
+            return __std_find_trivial<_Traits>(_First1, _Last1, *_Needle);
+        }
+
+        // Few needles: compare against each of them broadcast, 32 bytes at a time
+        constexpr size_t _Max_broadcast = 8;
+        const size_t _Avx_size          = _Byte_length(_First1, _Last1) & ~size_t{0x1F};
+        if (_Count2 <= _Max_broadcast && _Avx_size != 0 && _Use_avx2()) {
+            __m256i _Comparands[_Max_broadcast];
+            for (size_t _Idx = 0; _Idx != _Count2; ++_Idx) {
+                _Comparands[_Idx] = _Traits::_Set_avx(_Needle[_Idx]);
+            }
+
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                __m256i _Eq         = _Traits::_Cmp_avx(_Data, _Comparands[0]);
+                for (size_t _Idx = 1; _Idx != _Count2; ++_Idx) {
+                    _Eq = _mm256_or_si256(_Eq, _Traits::_Cmp_avx(_Data, _Comparands[_Idx]));
+                }
+
+                const int _Bingo = _mm256_movemask_epi8(_Eq);
+                if (_Bingo != 0) {
+                    const unsigned long _Offset = _tzcnt_u32(_Bingo);
+                    _Advance_bytes(_First1, _Offset);
+                    return _First1;
+                }
+
+                _Advance_bytes(_First1, 32);
+            } while (_First1 != _Stop_at);
+        }
+
+        // Up to this many needle pieces are matched per piece of the range with pcmpestrm;
+        // past that a lookup per element is cheaper
+        constexpr size_t _Max_needle_parts = 4;
+        constexpr size_t _Part             = 16 >> _Traits::_Shift;
+        if (_Count2 <= _Max_needle_parts * _Part && _First1 != _Last1 && _Use_sse42()) {
+            constexpr int _Op = _Traits::_Str_ops | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+
+            const size_t _Full_parts   = _Count2 / _Part;
+            const size_t _Last_part    = _Count2 % _Part;
+            const __m128i _Needle_tail = _Load_partial_sse(_Needle + _Full_parts * _Part, _Last_part);
+
+            for (;;) {
+                const size_t _Left      = _Byte_length(_First1, _Last1) >> _Traits::_Shift;
+                const size_t _Data_part = _Left < _Part ? _Left : _Part;
+                const __m128i _Data     = _Left < _Part ? _Load_partial_sse(static_cast<const _Ty*>(_First1), _Left)
+                                                        : _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+
+                unsigned int _Bingo = 0;
+                for (size_t _Idx = 0; _Idx != _Full_parts; ++_Idx) {
+                    const __m128i _Needle_part =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Needle + _Idx * _Part));
+                    _Bingo |= static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_cmpestrm(
+                        _Needle_part, static_cast<int>(_Part), _Data, static_cast<int>(_Data_part), _Op)));
+                }
+
+                if (_Last_part != 0) {
+                    _Bingo |= static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_cmpestrm(
+                        _Needle_tail, static_cast<int>(_Last_part), _Data, static_cast<int>(_Data_part), _Op)));
+                }
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return static_cast<const _Ty*>(_First1) + _Offset;
+                }
+
+                if (_Data_part != _Part) {
+                    return _Last1;
+                }
+
+                _Advance_bytes(_First1, 16);
+            }
+        }
+
+        if constexpr (sizeof(_Ty) == 1) {
+            return _Find_first_of_bitmap(_First1, _Last1, _Needle, _Count2);
+        } else {
+            return _Find_first_of_tail(_First1, _Last1, _Needle, _Count2);
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_search_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search<_Search_traits_1>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_search_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search<_Search_traits_2>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_find_end_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_find_end<_Search_traits_1>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_find_end_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_find_end<_Search_traits_2>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_find_first_of_trivial_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return __std_find_first_of_trivial<_Search_traits_1>(_First1, _Last1, _First2, _Last2);
+}
+
+const void* __stdcall __std_find_first_of_trivial_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return __std_find_first_of_trivial<_Search_traits_2>(_First1, _Last1, _First2, _Last2);
+}
+
+} // extern "C"
+
+
+namespace {
+    template <class _Traits>
+    __declspec(noalias) size_t __stdcall __std_mismatch(
+        const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+        // Elements are compared by their bytes, so the first different byte belongs to the first different element.
+        // A partial last piece is not read past the end; the last full-width piece is moved back to overlap the
+        // previous one instead, whose bytes are already known to be equal.
+        const auto _Bytes1       = static_cast<const unsigned char*>(_First1);
+        const auto _Bytes2       = static_cast<const unsigned char*>(_First2);
+        const size_t _Size_bytes = _Count << _Traits::_Shift;
+        size_t _Result           = 0;
+
+        if (_Size_bytes >= 32 && _Use_avx2()) {
+            const size_t _Last_piece = _Size_bytes - 32;
+            for (;;) {
+                const __m256i _Data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Bytes1 + _Result));
+                const __m256i _Data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Bytes2 + _Result));
+                const unsigned int _Bingo =
+                    ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Data1, _Data2)));
+
+                if (_Bingo != 0) {
+                    return (_Result + _tzcnt_u32(_Bingo)) >> _Traits::_Shift;
+                }
+
+                if (_Result == _Last_piece) {
+                    return _Count;
+                }
+
+                _Result += 32;
+                if (_Result > _Last_piece) {
+                    _Result = _Last_piece;
+                }
+            }
+        }
+
+        if (_Size_bytes >= 16 && _Use_sse2()) {
+            const size_t _Last_piece = _Size_bytes - 16;
+            for (;;) {
+                const __m128i _Data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Bytes1 + _Result));
+                const __m128i _Data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Bytes2 + _Result));
+                const unsigned int _Bingo =
+                    static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data1, _Data2))) ^ 0xFFFF;
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Result + _Offset) >> _Traits::_Shift;
+                }
+
+                if (_Result == _Last_piece) {
+                    return _Count;
+                }
+
+                _Result += 16;
+                if (_Result > _Last_piece) {
+                    _Result = _Last_piece;
+                }
+            }
+        }
+
+#if defined(_M_X64) // NOTE: UNALIGNED MEMORY ACCESSES
+        for (; _Size_bytes - _Result >= 8; _Result += 8) {
+            const unsigned long long _Diff = *reinterpret_cast<const unsigned long long*>(_Bytes1 + _Result)
+                                           ^ *reinterpret_cast<const unsigned long long*>(_Bytes2 + _Result);
+            if (_Diff != 0) {
+                unsigned long _Offset;
+                _BitScanForward64(&_Offset, _Diff);
+                return (_Result + (_Offset >> 3)) >> _Traits::_Shift;
+            }
+        }
+#elif defined(_M_IX86) // NOTE: UNALIGNED MEMORY ACCESSES
+        for (; _Size_bytes - _Result >= 4; _Result += 4) {
+            const unsigned long _Diff = *reinterpret_cast<const unsigned long*>(_Bytes1 + _Result)
+                                      ^ *reinterpret_cast<const unsigned long*>(_Bytes2 + _Result);
+            if (_Diff != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Diff);
+                return (_Result + (_Offset >> 3)) >> _Traits::_Shift;
+            }
+        }
+#else
+#error Unsupported architecture
+#endif
+
+        for (; _Result != _Size_bytes; ++_Result) {
+            if (_Bytes1[_Result] != _Bytes2[_Result]) {
+                break;
+            }
+        }
+
+        return _Result >> _Traits::_Shift;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) size_t
+    __stdcall __std_mismatch_1(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch<_Find_traits_1>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_mismatch_2(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch<_Find_traits_2>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_mismatch_4(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch<_Find_traits_4>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t
+    __stdcall __std_mismatch_8(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch<_Find_traits_8>(_First1, _First2, _Count);
+}
+
+} // extern "C"
+
+namespace {
+    // For each mask of up to 8 removed elements, the indices of the kept ones in order; the compress shuffles
+    // of every element size are derived from it
+    struct _Remove_patterns_t {
+        uint8_t _Data[256][8];
+    };
+
+    constexpr _Remove_patterns_t _Make_remove_patterns() noexcept {
+        _Remove_patterns_t _Result = {};
+        for (unsigned int _Mask = 0; _Mask != 256; ++_Mask) {
+            unsigned int _Kept = 0;
+            for (unsigned int _Idx = 0; _Idx != 8; ++_Idx) {
+                if ((_Mask & (1u << _Idx)) == 0) {
+                    _Result._Data[_Mask][_Kept++] = static_cast<uint8_t>(_Idx);
+                }
+            }
+        }
+        return _Result;
+    }
+
+    constexpr _Remove_patterns_t _Remove_patterns = _Make_remove_patterns();
+
+    __m128i _Load_remove_pattern(const unsigned int _Mask) noexcept {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Remove_patterns._Data[_Mask]));
+    }
+
+    // Each traits processes one step of _Step_sse or 32 bytes: _Mask_* gives one bit per removed element,
+    // _Compress_* moves the rest to the front, and _Prev_* gives each lane the element before it, the first
+    // lane taking the last one of the previous step.
+
+    struct _Remove_traits_1 : _Find_traits_1 {
+        static constexpr size_t _Step_sse = 8;
+        static constexpr bool _Has_avx    = false;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadl_epi64(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storel_epi64(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static unsigned int _Mask_sse(const __m128i _Eq) noexcept {
+            return _mm_movemask_epi8(_Eq) & 0xFF;
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            return _mm_shuffle_epi8(_Val, _Load_remove_pattern(_Mask));
+        }
+
+        static __m128i _Prev_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_srli_si128(_mm_unpacklo_epi64(_Prev, _Cur), 7);
+        }
+
+#ifdef _M_X64
+        static void _Store_avx512(void* const _Dest, const __mmask64 _Mask, const __m512i _Val) noexcept {
+            _mm512_mask_storeu_epi8(_Dest, _Mask, _Val);
+        }
+#endif // _M_X64
+    };
+
+    struct _Remove_traits_2 : _Find_traits_2 {
+        static constexpr size_t _Step_sse = 16;
+        static constexpr bool _Has_avx    = false;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static unsigned int _Mask_sse(const __m128i _Eq) noexcept {
+            return _mm_movemask_epi8(_mm_packs_epi16(_Eq, _mm_setzero_si128()));
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            // Element index i becomes byte indices 2i and 2i + 1
+            const __m128i _Idx = _mm_unpacklo_epi8(_Load_remove_pattern(_Mask), _Load_remove_pattern(_Mask));
+            return _mm_shuffle_epi8(_Val, _mm_add_epi8(_mm_add_epi8(_Idx, _Idx), _mm_set1_epi16(0x0100)));
+        }
+
+        static __m128i _Prev_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 14);
+        }
+
+#ifdef _M_X64
+        static void _Store_avx512(void* const _Dest, const __mmask64 _Mask, const __m512i _Val) noexcept {
+            _mm512_mask_storeu_epi16(_Dest, static_cast<__mmask32>(_Mask), _Val);
+        }
+#endif // _M_X64
+    };
+
+    struct _Remove_traits_4 : _Find_traits_4 {
+        static constexpr size_t _Step_sse = 16;
+        static constexpr bool _Has_avx    = true;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static unsigned int _Mask_sse(const __m128i _Eq) noexcept {
+            return _mm_movemask_ps(_mm_castsi128_ps(_Eq));
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            // Element index i becomes byte indices 4i to 4i + 3
+            const __m128i _Idx = _mm_shuffle_epi8(
+                _Load_remove_pattern(_Mask), _mm_set_epi8(3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0));
+            return _mm_shuffle_epi8(_Val, _mm_add_epi8(_mm_slli_epi32(_Idx, 2), _mm_set1_epi32(0x03020100)));
+        }
+
+        static __m128i _Prev_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 12);
+        }
+
+        static unsigned int _Mask_avx(const __m256i _Eq) noexcept {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_Eq));
+        }
+
+        static __m256i _Compress_avx(const __m256i _Val, const unsigned int _Mask) noexcept {
+            return _mm256_permutevar8x32_epi32(_Val, _mm256_cvtepu8_epi32(_Load_remove_pattern(_Mask)));
+        }
+
+        static __m256i _Prev_avx(const __m256i _Prev, const __m256i _Cur) noexcept {
+            const __m256i _Rotate = _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 7);
+            return _mm256_blend_epi32(_mm256_permutevar8x32_epi32(_Cur, _Rotate),
+                _mm256_permutevar8x32_epi32(_Prev, _Rotate), 0b0000'0001);
+        }
+
+        static void _Maskstore_avx(void* const _Dest, const __m256i _Mask, const __m256i _Val) noexcept {
+            _mm256_maskstore_epi32(static_cast<int*>(_Dest), _Mask, _Val);
+        }
+
+#ifdef _M_X64
+        static void _Store_avx512(void* const _Dest, const __mmask64 _Mask, const __m512i _Val) noexcept {
+            _mm512_mask_storeu_epi32(_Dest, static_cast<__mmask16>(_Mask), _Val);
+        }
+#endif // _M_X64
+    };
+
+    struct _Remove_traits_8 : _Find_traits_8 {
+        static constexpr size_t _Step_sse = 16;
+        static constexpr bool _Has_avx    = true;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static unsigned int _Mask_sse(const __m128i _Eq) noexcept {
+            return _mm_movemask_pd(_mm_castsi128_pd(_Eq));
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            // Element index i becomes byte indices 8i to 8i + 7
+            const __m128i _Idx = _mm_shuffle_epi8(
+                _Load_remove_pattern(_Mask), _mm_set_epi8(1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+            return _mm_shuffle_epi8(
+                _Val, _mm_add_epi8(_mm_slli_epi64(_Idx, 3), _mm_set1_epi64x(0x0706050403020100)));
+        }
+
+        static __m128i _Prev_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 8);
+        }
+
+        static unsigned int _Mask_avx(const __m256i _Eq) noexcept {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_Eq));
+        }
+
+        static __m256i _Compress_avx(const __m256i _Val, const unsigned int _Mask) noexcept {
+            // Element index i becomes dword indices 2i and 2i + 1
+            const __m256i _Idx = _mm256_slli_epi64(_mm256_cvtepu8_epi64(_Load_remove_pattern(_Mask)), 1);
+            return _mm256_permutevar8x32_epi32(_Val, _mm256_add_epi32(_mm256_shuffle_epi32(_Idx, _MM_SHUFFLE(2, 2, 0, 0)),
+                                                         _mm256_set_epi32(1, 0, 1, 0, 1, 0, 1, 0)));
+        }
+
+        static __m256i _Prev_avx(const __m256i _Prev, const __m256i _Cur) noexcept {
+            return _mm256_blend_epi32(_mm256_permute4x64_epi64(_Cur, _MM_SHUFFLE(2, 1, 0, 3)),
+                _mm256_permute4x64_epi64(_Prev, _MM_SHUFFLE(2, 1, 0, 3)), 0b0000'0011);
+        }
+
+        static void _Maskstore_avx(void* const _Dest, const __m256i _Mask, const __m256i _Val) noexcept {
+            _mm256_maskstore_epi64(static_cast<long long*>(_Dest), _Mask, _Val);
+        }
+
+#ifdef _M_X64
+        static void _Store_avx512(void* const _Dest, const __mmask64 _Mask, const __m512i _Val) noexcept {
+            _mm512_mask_storeu_epi64(_Dest, static_cast<__mmask8>(_Mask), _Val);
+        }
+#endif // _M_X64
+    };
+
+    template <class _Ty>
+    void* _Remove_tail(const _Ty* _First, const _Ty* const _Last, _Ty* _Out, const _Ty _Val) noexcept {
+        for (; _First != _Last; ++_First) {
+            if (*_First != _Val) {
+                *_Out = *_First;
+                ++_Out;
+            }
+        }
+        return _Out;
+    }
+
+    template <class _Ty>
+    void* _Unique_tail(const _Ty* _First, const _Ty* const _Last, _Ty* _Out) noexcept {
+        for (; _First != _Last; ++_First) {
+            if (*_First != _Out[-1]) {
+                *_Out = *_First;
+                ++_Out;
+            }
+        }
+        return _Out;
+    }
+
+    // Both compact in place: every step is stored whole at _Out, which never passes the step just loaded,
+    // so the stores only overwrite elements already read. The lanes past the kept ones are overwritten
+    // by the next step or left past the new end.
+
+    template <class _Traits, class _Ty>
+    void* __stdcall __std_remove(void* _First, void* const _Last, const _Ty _Val) noexcept {
+        void* _Out = _First;
+
+        if constexpr (_Traits::_Has_avx) {
+            if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
+                constexpr unsigned int _Lanes = 32 >> _Traits::_Shift;
+
+                const __m256i _Comparand = _Traits::_Set_avx(_Val);
+                const void* _Stop_at     = _First;
+                _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~size_t{0x1F});
+                do {
+                    const __m256i _Data      = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                    const unsigned int _Mask = _Traits::_Mask_avx(_Traits::_Cmp_avx(_Data, _Comparand));
+                    _mm256_storeu_si256(static_cast<__m256i*>(_Out), _Traits::_Compress_avx(_Data, _Mask));
+                    _Advance_bytes(_Out, (_Lanes - __popcnt(_Mask)) << _Traits::_Shift); // Assume available with SSE4.2
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+            }
+        }
+
+        if (_Byte_length(_First, _Last) >= _Traits::_Step_sse && _Use_sse42()) {
+            constexpr unsigned int _Lanes = _Traits::_Step_sse >> _Traits::_Shift;
+
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~(_Traits::_Step_sse - 1));
+            do {
+                const __m128i _Data      = _Traits::_Load_sse(_First);
+                const unsigned int _Mask = _Traits::_Mask_sse(_Traits::_Cmp_sse(_Data, _Comparand));
+                _Traits::_Store_sse(_Out, _Traits::_Compress_sse(_Data, _Mask));
+                _Advance_bytes(_Out, (_Lanes - __popcnt(_Mask)) << _Traits::_Shift);
+                _Advance_bytes(_First, _Traits::_Step_sse);
+            } while (_First != _Stop_at);
+        }
+
+        return _Remove_tail(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last), static_cast<_Ty*>(_Out), _Val);
+    }
+
+    template <class _Traits, class _Ty>
+    void* __stdcall __std_unique(void* _First, void* const _Last) noexcept {
+        if (_First == _Last) {
+            return _First;
+        }
+
+        // The first element is always kept. An element equal to the one before it in the input is also equal to
+        // the last kept one, so the lanes compare with their input neighbors, and each tier starts from _Out[-1].
+        _Advance_bytes(_First, sizeof(_Ty));
+        void* _Out = _First;
+
+        if constexpr (_Traits::_Has_avx) {
+            if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
+                constexpr unsigned int _Lanes = 32 >> _Traits::_Shift;
+
+                __m256i _Prev        = _Traits::_Set_avx(static_cast<const _Ty*>(_Out)[-1]);
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~size_t{0x1F});
+                do {
+                    const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                    const unsigned int _Mask =
+                        _Traits::_Mask_avx(_Traits::_Cmp_avx(_Data, _Traits::_Prev_avx(_Prev, _Data)));
+                    _mm256_storeu_si256(static_cast<__m256i*>(_Out), _Traits::_Compress_avx(_Data, _Mask));
+                    _Advance_bytes(_Out, (_Lanes - __popcnt(_Mask)) << _Traits::_Shift);
+                    _Advance_bytes(_First, 32);
+                    _Prev = _Data;
+                } while (_First != _Stop_at);
+            }
+        }
+
+        if (_Byte_length(_First, _Last) >= _Traits::_Step_sse && _Use_sse42()) {
+            constexpr unsigned int _Lanes = _Traits::_Step_sse >> _Traits::_Shift;
+
+            __m128i _Prev        = _Traits::_Set_sse(static_cast<const _Ty*>(_Out)[-1]);
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~(_Traits::_Step_sse - 1));
+            do {
+                const __m128i _Data = _Traits::_Load_sse(_First);
+                const unsigned int _Mask =
+                    _Traits::_Mask_sse(_Traits::_Cmp_sse(_Data, _Traits::_Prev_sse(_Prev, _Data)));
+                _Traits::_Store_sse(_Out, _Traits::_Compress_sse(_Data, _Mask));
+                _Advance_bytes(_Out, (_Lanes - __popcnt(_Mask)) << _Traits::_Shift);
+                _Advance_bytes(_First, _Traits::_Step_sse);
+                _Prev = _Data;
+            } while (_First != _Stop_at);
+        }
+
+        return _Unique_tail(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last), static_cast<_Ty*>(_Out));
+    }
+
+    // Only the matching elements may be written, as std::replace does not touch the others: masked stores where
+    // there are any, otherwise the matches of each SSE piece are written one by one.
+
+    template <class _Traits, class _Ty>
+    void __stdcall __std_replace(void* _First, void* const _Last, const _Ty _Old_val, const _Ty _New_val) noexcept {
+#ifdef _M_X64
+        if (_Use_avx512()) {
+            constexpr size_t _Lanes = 64 >> _Traits::_Shift;
+
+            const __m512i _Comparand   = _Traits::_Set_avx512(_Old_val);
+            const __m512i _Replacement = _Traits::_Set_avx512(_New_val);
+            for (size_t _Left = _Byte_length(_First, _Last) >> _Traits::_Shift; _Left != 0;) {
+                const __mmask64 _Mask = _Low_mask_avx512(_Left);
+                _Traits::_Store_avx512(
+                    _First, _Traits::_Cmp_avx512(_Mask, _Traits::_Load_avx512(_Mask, _First), _Comparand), _Replacement);
+
+                if (_Left <= _Lanes) {
+                    return;
+                }
+
+                _Left -= _Lanes;
+                _Advance_bytes(_First, 64);
+            }
+            return;
+        }
+#endif // _M_X64
+
+        if constexpr (_Traits::_Has_avx) {
+            if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
+                const __m256i _Comparand   = _Traits::_Set_avx(_Old_val);
+                const __m256i _Replacement = _Traits::_Set_avx(_New_val);
+                const void* _Stop_at       = _First;
+                _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~size_t{0x1F});
+                do {
+                    const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                    const __m256i _Eq   = _Traits::_Cmp_avx(_Data, _Comparand);
+                    if (!_mm256_testz_si256(_Eq, _Eq)) {
+                        _Traits::_Maskstore_avx(_First, _Eq, _Replacement);
+                    }
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+            }
+        }
+
+        if (_Byte_length(_First, _Last) >= 16 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Old_val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~size_t{0xF});
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                unsigned long _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand)));
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    _Ty* const _Match = reinterpret_cast<_Ty*>(static_cast<unsigned char*>(_First) + _Offset);
+                    *_Match           = _New_val;
+                    _Bingo &= ~(((1ul << sizeof(_Ty)) - 1) << _Offset);
+                }
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Old_val) {
+                *_Ptr = _New_val;
+            }
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+
+void* __stdcall __std_remove_1(void* const _First, void* const _Last, const uint8_t _Val) noexcept {
+    return __std_remove<_Remove_traits_1>(_First, _Last, _Val);
+}
+
+void* __stdcall __std_remove_2(void* const _First, void* const _Last, const uint16_t _Val) noexcept {
+    return __std_remove<_Remove_traits_2>(_First, _Last, _Val);
+}
+
+void* __stdcall __std_remove_4(void* const _First, void* const _Last, const uint32_t _Val) noexcept {
+    return __std_remove<_Remove_traits_4>(_First, _Last, _Val);
+}
+
+void* __stdcall __std_remove_8(void* const _First, void* const _Last, const uint64_t _Val) noexcept {
+    return __std_remove<_Remove_traits_8>(_First, _Last, _Val);
+}
+
+void* __stdcall __std_unique_1(void* const _First, void* const _Last) noexcept {
+    return __std_unique<_Remove_traits_1, uint8_t>(_First, _Last);
+}
+
+void* __stdcall __std_unique_2(void* const _First, void* const _Last) noexcept {
+    return __std_unique<_Remove_traits_2, uint16_t>(_First, _Last);
+}
+
+void* __stdcall __std_unique_4(void* const _First, void* const _Last) noexcept {
+    return __std_unique<_Remove_traits_4, uint32_t>(_First, _Last);
+}
+
+void* __stdcall __std_unique_8(void* const _First, void* const _Last) noexcept {
+    return __std_unique<_Remove_traits_8, uint64_t>(_First, _Last);
+}
+
+void __stdcall __std_replace_1(
+    void* const _First, void* const _Last, const uint8_t _Old_val, const uint8_t _New_val) noexcept {
+    __std_replace<_Remove_traits_1>(_First, _Last, _Old_val, _New_val);
+}
+
+void __stdcall __std_replace_2(
+    void* const _First, void* const _Last, const uint16_t _Old_val, const uint16_t _New_val) noexcept {
+    __std_replace<_Remove_traits_2>(_First, _Last, _Old_val, _New_val);
+}
+
+void __stdcall __std_replace_4(
+    void* const _First, void* const _Last, const uint32_t _Old_val, const uint32_t _New_val) noexcept {
+    __std_replace<_Remove_traits_4>(_First, _Last, _Old_val, _New_val);
+}
+
+void __stdcall __std_replace_8(
+    void* const _First, void* const _Last, const uint64_t _Old_val, const uint64_t _New_val) noexcept {
+    __std_replace<_Remove_traits_8>(_First, _Last, _Old_val, _New_val);
+}
+
+} // extern "C"
+
+#elif defined(_M_ARM64) // ^^^ x86 and x64 ^^^ / vvv ARM64 vvv
+
+#include <arm_neon.h>
+#include <cstdint>
+#include <intrin0.h>
+
+#ifndef _DEBUG
+#pragma optimize("t", on) // Override /Os with /Ot for this TU
+#endif // !_DEBUG
+
+// Advanced SIMD is part of the ARMv8-A base architecture, so unlike x86 there is no dispatch here
+
+namespace {
+    template <class _BidIt>
+    void _Reverse_tail(_BidIt _First, _BidIt _Last) noexcept {
+        for (; _First != _Last && _First != --_Last; ++_First) {
+            const auto _Temp = *_First;
+            *_First          = *_Last;
+            *_Last           = _Temp;
+        }
+    }
+
+    size_t _Byte_length(const void* _First, const void* _Last) noexcept {
+        return static_cast<const unsigned char*>(_Last) - static_cast<const unsigned char*>(_First);
+    }
+
+    void _Advance_bytes(void*& _Target, ptrdiff_t _Offset) noexcept {
+        _Target = static_cast<unsigned char*>(_Target) + _Offset;
+    }
+
+    void _Advance_bytes(const void*& _Target, ptrdiff_t _Offset) noexcept {
+        _Target = static_cast<const unsigned char*>(_Target) + _Offset;
+    }
+
+    // NEON has no movemask; narrowing each 16-bit half by 4 leaves 4 bits per byte of a comparison result
+    uint64_t _Mask_nibbles(const uint8x16_t _Cmp) noexcept {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(_Cmp), 4)), 0);
+    }
+
+    template <size_t _Element_size>
+    uint8x16_t _Reverse_vector_neon(const uint8x16_t _Val) noexcept {
+        // Reverse the elements in each half, then swap the halves
+        uint8x16_t _Halves_reversed;
+        if constexpr (_Element_size == 1) {
+            _Halves_reversed = vrev64q_u8(_Val);
+        } else if constexpr (_Element_size == 2) {
+            _Halves_reversed = vreinterpretq_u8_u16(vrev64q_u16(vreinterpretq_u16_u8(_Val)));
+        } else if constexpr (_Element_size == 4) {
+            _Halves_reversed = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(_Val)));
+        } else {
+            _Halves_reversed = _Val;
+        }
+        return vextq_u8(_Halves_reversed, _Halves_reversed, 8);
+    }
+
+    template <class _Ty>
+    void _Reverse_neon(void* _First, void* _Last) noexcept {
+        if (_Byte_length(_First, _Last) >= 32) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 4);
+            do {
+                _Advance_bytes(_Last, -16);
+                const uint8x16_t _Left  = vld1q_u8(static_cast<uint8_t*>(_First));
+                const uint8x16_t _Right = vld1q_u8(static_cast<uint8_t*>(_Last));
+                vst1q_u8(static_cast<uint8_t*>(_First), _Reverse_vector_neon<sizeof(_Ty)>(_Right));
+                vst1q_u8(static_cast<uint8_t*>(_Last), _Reverse_vector_neon<sizeof(_Ty)>(_Left));
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        _Reverse_tail(static_cast<_Ty*>(_First), static_cast<_Ty*>(_Last));
+    }
+} // unnamed namespace
+
+extern "C" {
+// Must be in sync with _Min_max_element_t in <algorithm>
+struct _Min_max_element_t {
+    const void* _Min;
+    const void* _Max;
+};
+
+__declspec(noalias) void __cdecl __std_swap_ranges_trivially_swappable_noalias(
+    void* _First1, void* _Last1, void* _First2) noexcept {
+    if (_Byte_length(_First1, _Last1) >= 16) {
+        const void* _Stop_at = _First1;
+        _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & ~size_t{0xF});
+        do {
+            const uint8x16_t _Left  = vld1q_u8(static_cast<uint8_t*>(_First1));
+            const uint8x16_t _Right = vld1q_u8(static_cast<uint8_t*>(_First2));
+            vst1q_u8(static_cast<uint8_t*>(_First1), _Right);
+            vst1q_u8(static_cast<uint8_t*>(_First2), _Left);
+            _Advance_bytes(_First1, 16);
+            _Advance_bytes(_First2, 16);
+        } while (_First1 != _Stop_at);
+    }
+
+    auto _First1c = static_cast<unsigned char*>(_First1);
+    auto _Last1c  = static_cast<unsigned char*>(_Last1);
+    auto _First2c = static_cast<unsigned char*>(_First2);
+    for (; _First1c != _Last1c; ++_First1c, ++_First2c) {
+        const unsigned char _Ch = *_First1c;
+        *_First1c               = *_First2c;
+        *_First2c               = _Ch;
+    }
+}
+
+__declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _First, void* _Last) noexcept {
+    _Reverse_neon<uint8_t>(_First, _Last);
+}
+
+__declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _First, void* _Last) noexcept {
+    _Reverse_neon<uint16_t>(_First, _Last);
+}
+
+__declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _First, void* _Last) noexcept {
+    _Reverse_neon<uint32_t>(_First, _Last);
+}
+
+__declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _First, void* _Last) noexcept {
+    _Reverse_neon<uint64_t>(_First, _Last);
+}
+
+} // extern "C"
+
+namespace {
+
+    template <class _Ty>
+    const void* _Min_tail(const void* const _First, const void* const _Last, const void* _Res, _Ty _Cur) noexcept {
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr < _Cur) {
+                _Res = _Ptr;
+                _Cur = *_Ptr;
+            }
+        }
+
+        return _Res;
+    }
+
+    template <class _Ty>
+    const void* _Max_tail(const void* const _First, const void* const _Last, const void* _Res, _Ty _Cur) noexcept {
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (_Cur < *_Ptr) {
+                _Res = _Ptr;
+                _Cur = *_Ptr;
+            }
+        }
+
+        return _Res;
+    }
+
+    template <class _Ty>
+    _Min_max_element_t _Both_tail(const void* const _First, const void* const _Last, _Min_max_element_t& _Res,
+        _Ty _Cur_min, _Ty _Cur_max) noexcept {
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr < _Cur_min) {
+                _Res._Min = _Ptr;
+                _Cur_min  = *_Ptr;
+            }
+            // Not else! See the x86 version.
+            if (_Cur_max <= *_Ptr) {
+                _Res._Max = _Ptr;
+                _Cur_max  = *_Ptr;
+            }
+        }
+
+        return _Res;
+    }
+
+    enum _Min_max_mode {
+        _Mode_min  = 1 << 0,
+        _Mode_max  = 1 << 1,
+        _Mode_both = _Mode_min | _Mode_max,
+    };
+
+    template <_Min_max_mode _Mode, class _Ty>
+    auto _Minmax_tail(const void* const _First, const void* const _Last, _Min_max_element_t& _Res, const _Ty _Cur_min,
+        const _Ty _Cur_max) noexcept {
+        if constexpr (_Mode == _Mode_min) {
+            return _Min_tail(_First, _Last, _Res._Min, _Cur_min);
+        } else if constexpr (_Mode == _Mode_max) {
+            return _Max_tail(_First, _Last, _Res._Max, _Cur_max);
+        } else {
+            return _Both_tail(_First, _Last, _Res, _Cur_min, _Cur_max);
+        }
+    }
+
+    // NEON compares signed and unsigned lanes directly, so values are kept in unsigned vectors without the
+    // sign correction the SSE traits need, and the signedness is a template parameter of the comparisons.
+    struct _Minmax_traits_1 {
+        using _Signed_t   = int8_t;
+        using _Unsigned_t = uint8_t;
+        using _Vec_t      = uint8x16_t;
+
+        static constexpr bool _Has_portion_max = true;
+        static constexpr size_t _Portion_max   = 256;
+
+        static _Vec_t _Load(const void* const _Src) noexcept {
+            return vld1q_u8(static_cast<const uint8_t*>(_Src));
+        }
+
+        static _Vec_t _Set(const _Unsigned_t _Val) noexcept {
+            return vdupq_n_u8(_Val);
+        }
+
+        static _Vec_t _Inc(const _Vec_t _Idx) noexcept {
+            return vaddq_u8(_Idx, vdupq_n_u8(1));
+        }
+
+        static _Vec_t _Cmp_eq(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            return vceqq_u8(_First, _Second);
+        }
+
+        template <bool _Sign>
+        static _Vec_t _Cmp_gt(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            if constexpr (_Sign) {
+                return vcgtq_s8(vreinterpretq_s8_u8(_First), vreinterpretq_s8_u8(_Second));
+            } else {
+                return vcgtq_u8(_First, _Second);
+            }
+        }
+
+        static _Vec_t _Blend(const _Vec_t _Mask, const _Vec_t _If_set, const _Vec_t _If_clear) noexcept {
+            return vbslq_u8(_Mask, _If_set, _If_clear);
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_min(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vminvq_s8(vreinterpretq_s8_u8(_Cur)));
+            } else {
+                return vminvq_u8(_Cur);
+            }
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_max(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vmaxvq_s8(vreinterpretq_s8_u8(_Cur)));
+            } else {
+                return vmaxvq_u8(_Cur);
+            }
+        }
+
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(_Cmp);
+        }
+    };
+
+    struct _Minmax_traits_2 {
+        using _Signed_t   = int16_t;
+        using _Unsigned_t = uint16_t;
+        using _Vec_t      = uint16x8_t;
+
+        static constexpr bool _Has_portion_max = true;
+        static constexpr size_t _Portion_max   = 65536;
+
+        static _Vec_t _Load(const void* const _Src) noexcept {
+            return vld1q_u16(static_cast<const uint16_t*>(_Src));
+        }
+
+        static _Vec_t _Set(const _Unsigned_t _Val) noexcept {
+            return vdupq_n_u16(_Val);
+        }
+
+        static _Vec_t _Inc(const _Vec_t _Idx) noexcept {
+            return vaddq_u16(_Idx, vdupq_n_u16(1));
+        }
+
+        static _Vec_t _Cmp_eq(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            return vceqq_u16(_First, _Second);
+        }
+
+        template <bool _Sign>
+        static _Vec_t _Cmp_gt(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            if constexpr (_Sign) {
+                return vcgtq_s16(vreinterpretq_s16_u16(_First), vreinterpretq_s16_u16(_Second));
+            } else {
+                return vcgtq_u16(_First, _Second);
+            }
+        }
+
+        static _Vec_t _Blend(const _Vec_t _Mask, const _Vec_t _If_set, const _Vec_t _If_clear) noexcept {
+            return vbslq_u16(_Mask, _If_set, _If_clear);
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_min(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vminvq_s16(vreinterpretq_s16_u16(_Cur)));
+            } else {
+                return vminvq_u16(_Cur);
+            }
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_max(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vmaxvq_s16(vreinterpretq_s16_u16(_Cur)));
+            } else {
+                return vmaxvq_u16(_Cur);
+            }
+        }
+
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u16(_Cmp));
+        }
+    };
+
+    struct _Minmax_traits_4 {
+        using _Signed_t   = int32_t;
+        using _Unsigned_t = uint32_t;
+        using _Vec_t      = uint32x4_t;
+
+        static constexpr bool _Has_portion_max = false;
+
+        static _Vec_t _Load(const void* const _Src) noexcept {
+            return vld1q_u32(static_cast<const uint32_t*>(_Src));
+        }
+
+        static _Vec_t _Set(const _Unsigned_t _Val) noexcept {
+            return vdupq_n_u32(_Val);
+        }
+
+        static _Vec_t _Inc(const _Vec_t _Idx) noexcept {
+            return vaddq_u32(_Idx, vdupq_n_u32(1));
+        }
+
+        static _Vec_t _Cmp_eq(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            return vceqq_u32(_First, _Second);
+        }
+
+        template <bool _Sign>
+        static _Vec_t _Cmp_gt(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            if constexpr (_Sign) {
+                return vcgtq_s32(vreinterpretq_s32_u32(_First), vreinterpretq_s32_u32(_Second));
+            } else {
+                return vcgtq_u32(_First, _Second);
+            }
+        }
+
+        static _Vec_t _Blend(const _Vec_t _Mask, const _Vec_t _If_set, const _Vec_t _If_clear) noexcept {
+            return vbslq_u32(_Mask, _If_set, _If_clear);
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_min(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vminvq_s32(vreinterpretq_s32_u32(_Cur)));
+            } else {
+                return vminvq_u32(_Cur);
+            }
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_max(const _Vec_t _Cur) noexcept {
+            if constexpr (_Sign) {
+                return static_cast<_Unsigned_t>(vmaxvq_s32(vreinterpretq_s32_u32(_Cur)));
+            } else {
+                return vmaxvq_u32(_Cur);
+            }
+        }
+
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u32(_Cmp));
+        }
+    };
+
+    struct _Minmax_traits_8 {
+        using _Signed_t   = int64_t;
+        using _Unsigned_t = uint64_t;
+        using _Vec_t      = uint64x2_t;
+
+        static constexpr bool _Has_portion_max = false;
+
+        static _Vec_t _Load(const void* const _Src) noexcept {
+            return vld1q_u64(static_cast<const uint64_t*>(_Src));
+        }
+
+        static _Vec_t _Set(const _Unsigned_t _Val) noexcept {
+            return vdupq_n_u64(_Val);
+        }
+
+        static _Vec_t _Inc(const _Vec_t _Idx) noexcept {
+            return vaddq_u64(_Idx, vdupq_n_u64(1));
+        }
+
+        static _Vec_t _Cmp_eq(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            return vceqq_u64(_First, _Second);
+        }
+
+        template <bool _Sign>
+        static _Vec_t _Cmp_gt(const _Vec_t _First, const _Vec_t _Second) noexcept {
+            if constexpr (_Sign) {
+                return vcgtq_s64(vreinterpretq_s64_u64(_First), vreinterpretq_s64_u64(_Second));
+            } else {
+                return vcgtq_u64(_First, _Second);
+            }
+        }
+
+        static _Vec_t _Blend(const _Vec_t _Mask, const _Vec_t _If_set, const _Vec_t _If_clear) noexcept {
+            return vbslq_u64(_Mask, _If_set, _If_clear);
+        }
+
+        // There are no across-vector min and max of 64-bit lanes; there are only two of them
+
+        template <bool _Sign>
+        static _Unsigned_t _H_min(const _Vec_t _Cur) noexcept {
+            const _Unsigned_t _Lo = vgetq_lane_u64(_Cur, 0);
+            const _Unsigned_t _Hi = vgetq_lane_u64(_Cur, 1);
+            if constexpr (_Sign) {
+                return static_cast<_Signed_t>(_Hi) < static_cast<_Signed_t>(_Lo) ? _Hi : _Lo;
+            } else {
+                return _Hi < _Lo ? _Hi : _Lo;
+            }
+        }
+
+        template <bool _Sign>
+        static _Unsigned_t _H_max(const _Vec_t _Cur) noexcept {
+            const _Unsigned_t _Lo = vgetq_lane_u64(_Cur, 0);
+            const _Unsigned_t _Hi = vgetq_lane_u64(_Cur, 1);
+            if constexpr (_Sign) {
+                return static_cast<_Signed_t>(_Lo) < static_cast<_Signed_t>(_Hi) ? _Hi : _Lo;
+            } else {
+                return _Lo < _Hi ? _Hi : _Lo;
+            }
+        }
+
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u64(_Cmp));
+        }
+    };
+
+    template <class _Traits, bool _Sign>
+    bool _Less_than(const typename _Traits::_Unsigned_t _First, const typename _Traits::_Unsigned_t _Second) noexcept {
+        if constexpr (_Sign) {
+            return static_cast<typename _Traits::_Signed_t>(_First) < static_cast<typename _Traits::_Signed_t>(_Second);
+        } else {
+            return _First < _Second;
+        }
+    }
+
+    template <_Min_max_mode _Mode, class _Traits, bool _Sign>
+    auto _Minmax_element_neon(const void* _First, const void* const _Last) noexcept {
+        using _Ty  = typename _Traits::_Unsigned_t;
+        using _STy = typename _Traits::_Signed_t;
+        using _Vty = typename _Traits::_Vec_t;
+
+        _Min_max_element_t _Res = {_First, _First};
+        _Ty _Cur_min_val; // initialized in both of the branches below
+        _Ty _Cur_max_val; // initialized in both of the branches below
+
+        if constexpr (_Sign) {
+            _Cur_min_val = static_cast<_Ty>(static_cast<_Ty>(~_Ty{0}) >> 1); // the signed maximum
+            _Cur_max_val = static_cast<_Ty>(_Cur_min_val + 1); // the signed minimum
+        } else {
+            _Cur_min_val = static_cast<_Ty>(~_Ty{0});
+            _Cur_max_val = 0;
+        }
+
+        const size_t _Vec_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+        if (_Vec_size != 0) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Vec_size);
+
+            const void* _Base = _First;
+            if constexpr (_Traits::_Has_portion_max) {
+                // The indices are kept in lanes of the element width; limit the portion so they do not wrap
+                if (_Byte_length(_First, _Stop_at) > _Traits::_Portion_max * 16) {
+                    _Stop_at = _First;
+                    _Advance_bytes(_Stop_at, _Traits::_Portion_max * 16);
+                }
+            }
+
+            _Vty _Cur_vals     = _Traits::_Load(_First);
+            _Vty _Cur_vals_min = _Cur_vals;
+            _Vty _Cur_idx_min  = _Traits::_Set(0);
+            _Vty _Cur_vals_max = _Cur_vals;
+            _Vty _Cur_idx_max  = _Traits::_Set(0);
+            _Vty _Cur_idx      = _Traits::_Set(0);
+
+            for (;;) {
+                _Advance_bytes(_First, 16);
+                _Cur_idx = _Traits::_Inc(_Cur_idx);
+
+                if (_First == _Stop_at) {
+                    // Reached the end of the portion; fold the lanes into the current result
+                    if constexpr ((_Mode & _Mode_min) != 0) {
+                        const _Ty _H_min = _Traits::template _H_min<_Sign>(_Cur_vals_min);
+                        if (_Less_than<_Traits, _Sign>(_H_min, _Cur_min_val)) {
+                            _Cur_min_val = _H_min;
+                            // The leftmost lane holding the minimum with the lowest index
+                            const _Vty _Eq_mask   = _Traits::_Cmp_eq(_Cur_vals_min, _Traits::_Set(_H_min));
+                            const _Vty _Idx_min   = _Traits::_Blend(_Eq_mask, _Cur_idx_min, _Traits::_Set(_Ty(~_Ty{0})));
+                            const _Ty _H_idx      = _Traits::template _H_min<false>(_Idx_min);
+                            const uint64_t _Lanes = _Traits::_Mask(_Eq_mask)
+                                                  & _Traits::_Mask(_Traits::_Cmp_eq(_Cur_idx_min, _Traits::_Set(_H_idx)));
+                            unsigned long _H_pos;
+                            _BitScanForward64(&_H_pos, _Lanes);
+                            _Res._Min = _Base;
+                            _Advance_bytes(_Res._Min, static_cast<size_t>(_H_idx) * 16 + (_H_pos >> 2));
+                        }
+                    }
+
+                    if constexpr ((_Mode & _Mode_max) != 0) {
+                        const _Ty _H_max = _Traits::template _H_max<_Sign>(_Cur_vals_max);
+                        if constexpr (_Mode == _Mode_both) {
+                            if (!_Less_than<_Traits, _Sign>(_H_max, _Cur_max_val)) {
+                                _Cur_max_val = _H_max;
+                                // The rightmost lane holding the maximum with the highest index
+                                const _Vty _Eq_mask = _Traits::_Cmp_eq(_Cur_vals_max, _Traits::_Set(_H_max));
+                                const _Vty _Idx_max = _Traits::_Blend(_Eq_mask, _Cur_idx_max, _Traits::_Set(0));
+                                const _Ty _H_idx    = _Traits::template _H_max<false>(_Idx_max);
+                                const uint64_t _Lanes =
+                                    _Traits::_Mask(_Eq_mask)
+                                    & _Traits::_Mask(_Traits::_Cmp_eq(_Cur_idx_max, _Traits::_Set(_H_idx)));
+                                unsigned long _H_pos;
+                                _BitScanReverse64(&_H_pos, _Lanes);
+                                _Res._Max = _Base;
+                                _Advance_bytes(_Res._Max,
+                                    static_cast<size_t>(_H_idx) * 16 + (_H_pos >> 2) - (sizeof(_Ty) - 1));
+                            }
+                        } else {
+                            if (_Less_than<_Traits, _Sign>(_Cur_max_val, _H_max)) {
+                                _Cur_max_val = _H_max;
+                                // The leftmost lane holding the maximum with the lowest index
+                                const _Vty _Eq_mask = _Traits::_Cmp_eq(_Cur_vals_max, _Traits::_Set(_H_max));
+                                const _Vty _Idx_max = _Traits::_Blend(_Eq_mask, _Cur_idx_max, _Traits::_Set(_Ty(~_Ty{0})));
+                                const _Ty _H_idx    = _Traits::template _H_min<false>(_Idx_max);
+                                const uint64_t _Lanes =
+                                    _Traits::_Mask(_Eq_mask)
+                                    & _Traits::_Mask(_Traits::_Cmp_eq(_Cur_idx_max, _Traits::_Set(_H_idx)));
+                                unsigned long _H_pos;
+                                _BitScanForward64(&_H_pos, _Lanes);
+                                _Res._Max = _Base;
+                                _Advance_bytes(_Res._Max, static_cast<size_t>(_H_idx) * 16 + (_H_pos >> 2));
+                            }
+                        }
+                    }
+
+                    if constexpr (_Traits::_Has_portion_max) {
+                        // Start the next portion, if the vectorized part is not over
+                        if (_First == _Last || _Byte_length(_First, _Last) < 16) {
+                            break;
+                        }
+
+                        _Base    = _First;
+                        _Stop_at = _First;
+                        const size_t _Remaining = _Byte_length(_First, _Last) & ~size_t{0xF};
+                        _Advance_bytes(_Stop_at,
+                            _Remaining > _Traits::_Portion_max * 16 ? _Traits::_Portion_max * 16 : _Remaining);
+
+                        _Cur_vals     = _Traits::_Load(_First);
+                        _Cur_vals_min = _Cur_vals;
+                        _Cur_idx_min  = _Traits::_Set(0);
+                        _Cur_vals_max = _Cur_vals;
+                        _Cur_idx_max  = _Traits::_Set(0);
+                        _Cur_idx      = _Traits::_Set(0);
                         continue;
                     } else {
-                        break; // No wrapping, so it was the only portion
+                        break;
                     }
                 }
-                // This is the main part, finding vertical minimum/maximum
 
-                // Load values and if unsigned adjust them to be signed (for signed vector comparisons)
-                _Cur_vals = _Traits::_Sign_correction(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_First)), _Sign);
+                _Cur_vals = _Traits::_Load(_First);
 
                 if constexpr ((_Mode & _Mode_min) != 0) {
-                    // Looking for the first occurrence of minimum, don't overwrite with newly found occurrences
-                    const __m128i _Is_less = _Traits::_Cmp_gt(_Cur_vals_min, _Cur_vals); // _Cur_vals < _Cur_vals_min
-                    _Cur_idx_min = _mm_blendv_epi8(_Cur_idx_min, _Cur_idx, _Is_less); // Remember their vertical indices
-                    _Cur_vals_min = _Traits::_Min(_Cur_vals_min, _Cur_vals, _Is_less); // Update the current minimum
+                    // Take the new lane only if it is strictly less, so the first minimum stays
+                    const _Vty _Is_less = _Traits::template _Cmp_gt<_Sign>(_Cur_vals_min, _Cur_vals);
+                    _Cur_idx_min        = _Traits::_Blend(_Is_less, _Cur_idx, _Cur_idx_min);
+                    _Cur_vals_min       = _Traits::_Blend(_Is_less, _Cur_vals, _Cur_vals_min);
                 }
 
                 if constexpr (_Mode == _Mode_max) {
-                    // Looking for the first occurrence of maximum, don't overwrite with newly found occurrences
-                    const __m128i _Is_greater = _Traits::_Cmp_gt(_Cur_vals, _Cur_vals_max); // _Cur_vals > _Cur_vals_max
-                    _Cur_idx_max =
-                        _mm_blendv_epi8(_Cur_idx_max, _Cur_idx, _Is_greater); // Remember their vertical indices
-                    _Cur_vals_max = _Traits::_Max(_Cur_vals_max, _Cur_vals, _Is_greater); // Update the current maximum
+                    // Take the new lane only if it is strictly greater, so the first maximum stays
+                    const _Vty _Is_greater = _Traits::template _Cmp_gt<_Sign>(_Cur_vals, _Cur_vals_max);
+                    _Cur_idx_max           = _Traits::_Blend(_Is_greater, _Cur_idx, _Cur_idx_max);
+                    _Cur_vals_max          = _Traits::_Blend(_Is_greater, _Cur_vals, _Cur_vals_max);
                 } else if constexpr (_Mode == _Mode_both) {
-                    // Looking for the last occurrence of maximum, do overwrite with newly found occurrences
-                    const __m128i _Is_less =
-                        _Traits::_Cmp_gt(_Cur_vals_max, _Cur_vals); // !(_Cur_vals >= _Cur_vals_max)
-                    _Cur_idx_max = _mm_blendv_epi8(_Cur_idx, _Cur_idx_max, _Is_less); // Remember their vertical indices
-                    _Cur_vals_max = _Traits::_Max(_Cur_vals, _Cur_vals_max, _Is_less); // Update the current maximum
+                    // Keep the old lane only if it is strictly greater, so the last maximum is found
+                    const _Vty _Is_less = _Traits::template _Cmp_gt<_Sign>(_Cur_vals_max, _Cur_vals);
+                    _Cur_idx_max        = _Traits::_Blend(_Is_less, _Cur_idx_max, _Cur_idx);
+                    _Cur_vals_max       = _Traits::_Blend(_Is_less, _Cur_vals_max, _Cur_vals);
                 }
             }
         }
 
-        return _Minmax_tail<_Mode, typename _Traits::_Signed_t, typename _Traits::_Unsigned_t>(
-            _First, _Last, _Res, _Sign, _Cur_min_val, _Cur_max_val);
+        if constexpr (_Sign) {
+            return _Minmax_tail<_Mode>(
+                _First, _Last, _Res, static_cast<_STy>(_Cur_min_val), static_cast<_STy>(_Cur_max_val));
+        } else {
+            return _Minmax_tail<_Mode>(_First, _Last, _Res, _Cur_min_val, _Cur_max_val);
+        }
     }
 
+    template <_Min_max_mode _Mode, class _Traits>
+    auto _Minmax_element(const void* const _First, const void* const _Last, const bool _Sign) noexcept {
+        if (_Sign) {
+            return _Minmax_element_neon<_Mode, _Traits, true>(_First, _Last);
+        } else {
+            return _Minmax_element_neon<_Mode, _Traits, false>(_First, _Last);
+        }
+    }
 } // unnamed namespace
 
 extern "C" {
@@ -1062,15 +3996,6 @@ _Min_max_element_t __stdcall __std_minmax_element_8(
 } // extern "C"
 
 namespace {
-    template <class _Ty>
-    const void* _Find_trivial_unsized_fallback(const void* _First, _Ty _Val) {
-        auto _Ptr = static_cast<const _Ty*>(_First);
-        while (*_Ptr != _Val) {
-            ++_Ptr;
-        }
-        return _Ptr;
-    }
-
     template <class _Ty>
     const void* _Find_trivial_tail(const void* _First, const void* _Last, _Ty _Val) {
         auto _Ptr = static_cast<const _Ty*>(_First);
@@ -1091,221 +4016,150 @@ namespace {
         return _Current;
     }
 
+    // Equal lanes are all ones, that is -1, so subtracting the comparison results counts the matches in each lane
+
     struct _Find_traits_1 {
-        static constexpr size_t _Shift = 0;
+        using _Vec_t = uint8x16_t;
 
-        static __m256i _Set_avx(const uint8_t _Val) noexcept {
-            return _mm256_set1_epi8(_Val);
+        static constexpr size_t _Portion_max = 255; // before the lane counters wrap
+
+        static _Vec_t _Set(const uint8_t _Val) noexcept {
+            return vdupq_n_u8(_Val);
         }
 
-        static __m128i _Set_sse(const uint8_t _Val) noexcept {
-            return _mm_set1_epi8(_Val);
+        static _Vec_t _Cmp(const void* const _Src, const _Vec_t _Comparand) noexcept {
+            return vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(_Src)), _Comparand);
         }
 
-        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
-            return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(_Cmp);
         }
 
-        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
-            return _mm_cmpeq_epi8(_Lhs, _Rhs);
+        static _Vec_t _Sub(const _Vec_t _Counters, const _Vec_t _Cmp) noexcept {
+            return vsubq_u8(_Counters, _Cmp);
         }
 
-        static bool _Sse_available() noexcept {
-            return _Use_sse2();
+        static size_t _Sum(const _Vec_t _Counters) noexcept {
+            return vaddlvq_u8(_Counters);
         }
     };
 
     struct _Find_traits_2 {
-        static constexpr size_t _Shift = 1;
+        using _Vec_t = uint16x8_t;
 
-        static __m256i _Set_avx(const uint16_t _Val) noexcept {
-            return _mm256_set1_epi16(_Val);
+        static constexpr size_t _Portion_max = 65535;
+
+        static _Vec_t _Set(const uint16_t _Val) noexcept {
+            return vdupq_n_u16(_Val);
         }
 
-        static __m128i _Set_sse(const uint16_t _Val) noexcept {
-            return _mm_set1_epi16(_Val);
+        static _Vec_t _Cmp(const void* const _Src, const _Vec_t _Comparand) noexcept {
+            return vceqq_u16(vld1q_u16(static_cast<const uint16_t*>(_Src)), _Comparand);
         }
 
-        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
-            return _mm256_cmpeq_epi16(_Lhs, _Rhs);
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u16(_Cmp));
         }
 
-        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
-            return _mm_cmpeq_epi16(_Lhs, _Rhs);
+        static _Vec_t _Sub(const _Vec_t _Counters, const _Vec_t _Cmp) noexcept {
+            return vsubq_u16(_Counters, _Cmp);
         }
 
-        static bool _Sse_available() noexcept {
-            return _Use_sse2();
+        static size_t _Sum(const _Vec_t _Counters) noexcept {
+            return vaddlvq_u16(_Counters);
         }
     };
 
     struct _Find_traits_4 {
-        static constexpr size_t _Shift = 2;
+        using _Vec_t = uint32x4_t;
 
-        static __m256i _Set_avx(const uint32_t _Val) noexcept {
-            return _mm256_set1_epi32(_Val);
+        static constexpr size_t _Portion_max = 0xFFFF'FFFF;
+
+        static _Vec_t _Set(const uint32_t _Val) noexcept {
+            return vdupq_n_u32(_Val);
         }
 
-        static __m128i _Set_sse(const uint32_t _Val) noexcept {
-            return _mm_set1_epi32(_Val);
+        static _Vec_t _Cmp(const void* const _Src, const _Vec_t _Comparand) noexcept {
+            return vceqq_u32(vld1q_u32(static_cast<const uint32_t*>(_Src)), _Comparand);
         }
 
-        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
-            return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u32(_Cmp));
         }
 
-        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
-            return _mm_cmpeq_epi32(_Lhs, _Rhs);
+        static _Vec_t _Sub(const _Vec_t _Counters, const _Vec_t _Cmp) noexcept {
+            return vsubq_u32(_Counters, _Cmp);
         }
 
-        static bool _Sse_available() noexcept {
-            return _Use_sse2();
+        static size_t _Sum(const _Vec_t _Counters) noexcept {
+            return vaddlvq_u32(_Counters);
         }
     };
 
     struct _Find_traits_8 {
-        static constexpr size_t _Shift = 3;
+        using _Vec_t = uint64x2_t;
 
-        static __m256i _Set_avx(const uint64_t _Val) noexcept {
-            return _mm256_set1_epi64x(_Val);
+        static constexpr size_t _Portion_max = ~size_t{0} >> 4; // no wrap within the address space
+
+        static _Vec_t _Set(const uint64_t _Val) noexcept {
+            return vdupq_n_u64(_Val);
         }
 
-        static __m128i _Set_sse(const uint64_t _Val) noexcept {
-            return _mm_set1_epi64x(_Val);
+        static _Vec_t _Cmp(const void* const _Src, const _Vec_t _Comparand) noexcept {
+            return vceqq_u64(vld1q_u64(static_cast<const uint64_t*>(_Src)), _Comparand);
         }
 
-        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
-            return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+        static uint64_t _Mask(const _Vec_t _Cmp) noexcept {
+            return _Mask_nibbles(vreinterpretq_u8_u64(_Cmp));
         }
 
-        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
-            return _mm_cmpeq_epi64(_Lhs, _Rhs); // SSE4.1
+        static _Vec_t _Sub(const _Vec_t _Counters, const _Vec_t _Cmp) noexcept {
+            return vsubq_u64(_Counters, _Cmp);
         }
 
-        static bool _Sse_available() noexcept {
-            return _Use_sse42(); // for pcmpeqq on _Cmp_sse
+        static size_t _Sum(const _Vec_t _Counters) noexcept {
+            return vaddvq_u64(_Counters);
         }
     };
 
-    // The below functions have exactly the same signature as the extern "C" functions, up to calling convention.
-    // This makes sure the template specialization is fused with the extern "C" function.
-    // In optimized builds it avoids an extra call, as this function is too large to inline.
-
     template <class _Traits, class _Ty>
     const void* __stdcall __std_find_trivial_unsized(const void* _First, const _Ty _Val) noexcept {
-        if (_Use_avx2()) {
-            // We read by vector-sized pieces, and we align pointers to vector-sized boundary.
-            // From start partial piece we mask out matches that don't belong to the range.
-            // This makes sure we never cross page boundary, thus we read 'as if' sequentially.
-            constexpr size_t _Vector_pad_mask = 0x1F;
-            constexpr unsigned int _Full_mask = 0xFFFF'FFFF;
-
-            const __m256i _Comparand  = _Traits::_Set_avx(_Val);
-            const intptr_t _Pad_start = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
-            const unsigned int _Mask  = _Full_mask << _Pad_start;
-            _Advance_bytes(_First, -_Pad_start);
-
-            __m256i _Data       = _mm256_load_si256(static_cast<const __m256i*>(_First));
-            unsigned int _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand)));
-
-            if ((_Bingo &= _Mask) != 0) {
-                unsigned long _Offset = _tzcnt_u32(_Bingo);
-                _Advance_bytes(_First, _Offset);
-                return _First;
-            }
-
-            for (;;) {
-                _Data  = _mm256_load_si256(static_cast<const __m256i*>(_First));
-                _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand)));
-
-                if (_Bingo != 0) {
-                    unsigned long _Offset = _tzcnt_u32(_Bingo);
-                    _Advance_bytes(_First, _Offset);
-                    return _First;
-                }
-
-                _Advance_bytes(_First, 32);
-            }
-        }
-
-        if (_Traits::_Sse_available()) {
-            // We read by vector-sized pieces, and we align pointers to vector-sized boundary.
-            // From start partial piece we mask out matches that don't belong to the range.
-            // This makes sure we never cross page boundary, thus we read 'as if' sequentially.
-            constexpr size_t _Vector_pad_mask = 0xF;
-            constexpr unsigned int _Full_mask = 0xFFFF;
-
-            const __m128i _Comparand  = _Traits::_Set_sse(_Val);
-            const intptr_t _Pad_start = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
-            const unsigned int _Mask  = _Full_mask << _Pad_start;
-            _Advance_bytes(_First, -_Pad_start);
-
-            __m128i _Data       = _mm_load_si128(static_cast<const __m128i*>(_First));
-            unsigned int _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand)));
-
-            if ((_Bingo &= _Mask) != 0) {
-                unsigned long _Offset;
-                _BitScanForward(&_Offset, _Bingo);
-                _Advance_bytes(_First, _Offset);
-                return _First;
-            }
-
-            for (;;) {
-                _Data  = _mm_load_si128(static_cast<const __m128i*>(_First));
-                _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand)));
-
-                if (_Bingo != 0) {
-                    unsigned long _Offset;
-                    _BitScanForward(&_Offset, _Bingo);
-                    _Advance_bytes(_First, _Offset);
-                    return _First;
-                }
-
-                _Advance_bytes(_First, 16);
-            }
+        // We read by vector-sized pieces, and we align pointers to vector-sized boundary.
+        // From start partial piece we mask out matches that don't belong to the range.
+        // This makes sure we never cross page boundary, thus we read 'as if' sequentially.
+        constexpr size_t _Vector_pad_mask = 0xF;
+
+        const auto _Comparand   = _Traits::_Set(_Val);
+        const intptr_t _Pad     = reinterpret_cast<intptr_t>(_First) & _Vector_pad_mask;
+        const void* _Aligned    = static_cast<const unsigned char*>(_First) - _Pad;
+        const uint64_t _Inclusion = ~uint64_t{0} << (_Pad * 4); // four bits per byte
+
+        uint64_t _Bingo = _Traits::_Mask(_Traits::_Cmp(_Aligned, _Comparand)) & _Inclusion;
+        while (_Bingo == 0) {
+            _Advance_bytes(_Aligned, 16);
+            _Bingo = _Traits::_Mask(_Traits::_Cmp(_Aligned, _Comparand));
         }
 
-        return _Find_trivial_unsized_fallback(_First, _Val);
+        unsigned long _Offset;
+        _BitScanForward64(&_Offset, _Bingo);
+        _Advance_bytes(_Aligned, _Offset >> 2);
+        return _Aligned;
     }
 
-
     template <class _Traits, class _Ty>
-    const void* __stdcall __std_find_trivial(const void* _First, const void* _Last, _Ty _Val) noexcept {
-        size_t _Size_bytes = _Byte_length(_First, _Last);
-
-        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
-        if (_Avx_size != 0 && _Use_avx2()) {
-            const __m256i _Comparand = _Traits::_Set_avx(_Val);
-            const void* _Stop_at     = _First;
-            _Advance_bytes(_Stop_at, _Avx_size);
-            do {
-                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
-                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+    const void* __stdcall __std_find_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        const size_t _Vec_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+        if (_Vec_size != 0) {
+            const auto _Comparand = _Traits::_Set(_Val);
+            const void* _Stop_at  = _First;
+            _Advance_bytes(_Stop_at, _Vec_size);
 
-                if (_Bingo != 0) {
-                    const unsigned long _Offset = _tzcnt_u32(_Bingo);
-                    _Advance_bytes(_First, _Offset);
-                    return _First;
-                }
-
-                _Advance_bytes(_First, 32);
-            } while (_First != _Stop_at);
-            _Size_bytes &= 0x1F;
-        }
-
-        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
-        if (_Sse_size != 0 && _Traits::_Sse_available()) {
-            const __m128i _Comparand = _Traits::_Set_sse(_Val);
-            const void* _Stop_at     = _First;
-            _Advance_bytes(_Stop_at, _Sse_size);
             do {
-                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
-                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
-
+                const uint64_t _Bingo = _Traits::_Mask(_Traits::_Cmp(_First, _Comparand));
                 if (_Bingo != 0) {
                     unsigned long _Offset;
-                    _BitScanForward(&_Offset, _Bingo);
-                    _Advance_bytes(_First, _Offset);
+                    _BitScanForward64(&_Offset, _Bingo);
+                    _Advance_bytes(_First, _Offset >> 2);
                     return _First;
                 }
 
@@ -1319,37 +4173,29 @@ namespace {
     template <class _Traits, class _Ty>
     __declspec(noalias) size_t
         __stdcall __std_count_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
-        size_t _Size_bytes = _Byte_length(_First, _Last);
-        size_t _Result     = 0;
-
-        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
-        if (_Avx_size != 0 && _Use_avx2()) {
-            const __m256i _Comparand = _Traits::_Set_avx(_Val);
-            const void* _Stop_at     = _First;
-            _Advance_bytes(_Stop_at, _Avx_size);
-            do {
-                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
-                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
-                _Result += __popcnt(_Bingo); // Assume available with SSE4.2
-                _Advance_bytes(_First, 32);
-            } while (_First != _Stop_at);
-            _Size_bytes &= 0x1F;
-        }
+        size_t _Result = 0;
 
-        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
-        if (_Sse_size != 0 && _Use_sse42()) {
-            const __m128i _Comparand = _Traits::_Set_sse(_Val);
-            const void* _Stop_at     = _First;
-            _Advance_bytes(_Stop_at, _Sse_size);
+        size_t _Vec_size = _Byte_length(_First, _Last) & ~size_t{0xF};
+        if (_Vec_size != 0) {
+            const auto _Comparand = _Traits::_Set(_Val);
             do {
-                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
-                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
-                _Result += __popcnt(_Bingo); // Assume available with SSE4.2
-                _Advance_bytes(_First, 16);
-            } while (_First != _Stop_at);
+                const size_t _Portion_size =
+                    _Vec_size > _Traits::_Portion_max * 16 ? _Traits::_Portion_max * 16 : _Vec_size;
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Portion_size);
+
+                auto _Counters = _Traits::_Set(0);
+                do {
+                    _Counters = _Traits::_Sub(_Counters, _Traits::_Cmp(_First, _Comparand));
+                    _Advance_bytes(_First, 16);
+                } while (_First != _Stop_at);
+
+                _Result += _Traits::_Sum(_Counters);
+                _Vec_size -= _Portion_size;
+            } while (_Vec_size != 0);
         }
 
-        return _Count_trivial_tail(_First, _Last, _Result >> _Traits::_Shift, _Val);
+        return _Count_trivial_tail(_First, _Last, _Result, _Val);
     }
 } // unnamed namespace
 
@@ -1413,4 +4259,4 @@ __declspec(noalias) size_t
 
 } // extern "C"
 
-#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#endif // ^^^ ARM64 ^^^
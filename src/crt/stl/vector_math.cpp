@@ -0,0 +1,371 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// __std_exp_array, __std_sinh_array and __std_cosh_array functions
+
+// Each lane repeats the scalar _Exp/_Sinh/_Cosh operation sequence, so the
+// results are bit-identical to the scalar helpers; a block with any lane
+// outside the range where that holds without rescaling (non-finite, near
+// overflow or underflow) is handed to the scalar helpers instead.
+
+#include "xmath.hpp"
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#include <emmintrin.h>
+#include <immintrin.h>
+#include <isa_availability.h>
+
+extern "C" long __isa_enabled;
+
+#ifndef _DEBUG
+#pragma optimize("t", on) // Override /Os with /Ot for this TU
+#endif // !_DEBUG
+#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+
+namespace {
+    // same coefficients as _Exp (xexp.cpp) and _Sinh (xsinh.cpp)
+    constexpr double _Exp_p[]   = {1.0, 420.30235984910635, 15132.70094680474802};
+    constexpr double _Exp_q[]   = {30.01511290683317, 3362.72154416553028, 30265.40189360949691};
+    constexpr double _Exp_c1    = 22713.0 / 32768.0;
+    constexpr double _Exp_c2    = 1.4286068203094172321214581765680755e-6;
+    constexpr double _Invln2    = 1.4426950408889634073599246810018921;
+    constexpr double _Exp_limit = 700.0; // |x| for which e^x and its 2^k scale stay normal
+
+    constexpr double _Sinh_p[] = {0.0000000001632881, 0.0000000250483893, 0.0000027557344615, 0.0001984126975233,
+        0.0083333333334816, 0.1666666666666574};
+
+    double _Exp_scalar(double _Val) noexcept {
+        switch (_Dtest(&_Val)) {
+        case _NANCODE:
+            return _Val;
+        case _INFCODE:
+            return DSIGN(_Val) ? 0.0 : _Val;
+        case 0:
+            return 1.0;
+        default:
+            _Exp(&_Val, 1.0, 0);
+            return _Val;
+        }
+    }
+
+    double _Sinh_scalar(const double _Val) noexcept {
+        return _Sinh(_Val, 1.0);
+    }
+
+    double _Cosh_scalar(const double _Val) noexcept {
+        return _Cosh(_Val, 1.0);
+    }
+
+    template <class _Traits>
+    struct _Exp_kernel;
+    template <class _Traits>
+    struct _Sinh_kernel;
+    template <class _Traits>
+    struct _Cosh_kernel;
+
+    template <class _Fn>
+    void _Transform_scalar(const double* _First, const double* const _Last, double* _Dest, _Fn _Scalar) noexcept {
+        for (; _First != _Last; ++_First, ++_Dest) {
+            *_Dest = _Scalar(*_First);
+        }
+    }
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    bool _Use_avx2() noexcept {
+        return __isa_enabled & (1 << __ISA_AVAILABLE_AVX2);
+    }
+
+    bool _Use_sse2() noexcept {
+#ifdef _M_IX86
+        return __isa_enabled & (1 << __ISA_AVAILABLE_SSE2);
+#else
+        return true;
+#endif // _M_IX86
+    }
+
+    struct _Traits_sse2 {
+        using _Vec                     = __m128d;
+        static constexpr size_t _Lanes = 2;
+        static constexpr int _All      = 0x3;
+
+        static _Vec _Load(const double* const _Src) noexcept {
+            return _mm_loadu_pd(_Src);
+        }
+
+        static void _Store(double* const _Dest, const _Vec _Val) noexcept {
+            _mm_storeu_pd(_Dest, _Val);
+        }
+
+        static _Vec _Set(const double _Val) noexcept {
+            return _mm_set1_pd(_Val);
+        }
+
+        static _Vec _Add(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_add_pd(_Left, _Right);
+        }
+
+        static _Vec _Sub(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_sub_pd(_Left, _Right);
+        }
+
+        static _Vec _Mul(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_mul_pd(_Left, _Right);
+        }
+
+        static _Vec _Div(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_div_pd(_Left, _Right);
+        }
+
+        static _Vec _And(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_and_pd(_Left, _Right);
+        }
+
+        static _Vec _Or(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm_or_pd(_Left, _Right);
+        }
+
+        static _Vec _Andnot(const _Vec _Left, const _Vec _Right) noexcept { // ~_Left & _Right
+            return _mm_andnot_pd(_Left, _Right);
+        }
+
+        static _Vec _Less(const _Vec _Left, const _Vec _Right) noexcept { // false for NaN
+            return _mm_cmplt_pd(_Left, _Right);
+        }
+
+        static _Vec _Less_equal(const _Vec _Left, const _Vec _Right) noexcept { // false for NaN
+            return _mm_cmple_pd(_Left, _Right);
+        }
+
+        static int _Mask(const _Vec _Val) noexcept {
+            return _mm_movemask_pd(_Val);
+        }
+
+        static _Vec _Select(const _Vec _Mask, const _Vec _If, const _Vec _Else) noexcept {
+            return _mm_or_pd(_mm_and_pd(_Mask, _If), _mm_andnot_pd(_Mask, _Else));
+        }
+
+        static __m128i _Truncate(const _Vec _Val) noexcept {
+            return _mm_cvttpd_epi32(_Val);
+        }
+
+        static _Vec _To_double(const __m128i _Val) noexcept {
+            return _mm_cvtepi32_pd(_Val);
+        }
+
+        static _Vec _Pow2(const __m128i _Exponent, const int _Offset) noexcept { // 2^(_Exponent + _Offset), normal
+            const __m128i _Biased = _mm_add_epi32(_Exponent, _mm_set1_epi32(_Offset + 1023));
+            return _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(_Biased, _mm_setzero_si128()), 52));
+        }
+    };
+
+    struct _Traits_avx2 {
+        using _Vec                     = __m256d;
+        static constexpr size_t _Lanes = 4;
+        static constexpr int _All      = 0xF;
+
+        static _Vec _Load(const double* const _Src) noexcept {
+            return _mm256_loadu_pd(_Src);
+        }
+
+        static void _Store(double* const _Dest, const _Vec _Val) noexcept {
+            _mm256_storeu_pd(_Dest, _Val);
+        }
+
+        static _Vec _Set(const double _Val) noexcept {
+            return _mm256_set1_pd(_Val);
+        }
+
+        static _Vec _Add(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_add_pd(_Left, _Right);
+        }
+
+        static _Vec _Sub(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_sub_pd(_Left, _Right);
+        }
+
+        static _Vec _Mul(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_mul_pd(_Left, _Right);
+        }
+
+        static _Vec _Div(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_div_pd(_Left, _Right);
+        }
+
+        static _Vec _And(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_and_pd(_Left, _Right);
+        }
+
+        static _Vec _Or(const _Vec _Left, const _Vec _Right) noexcept {
+            return _mm256_or_pd(_Left, _Right);
+        }
+
+        static _Vec _Andnot(const _Vec _Left, const _Vec _Right) noexcept { // ~_Left & _Right
+            return _mm256_andnot_pd(_Left, _Right);
+        }
+
+        static _Vec _Less(const _Vec _Left, const _Vec _Right) noexcept { // false for NaN
+            return _mm256_cmp_pd(_Left, _Right, _CMP_LT_OQ);
+        }
+
+        static _Vec _Less_equal(const _Vec _Left, const _Vec _Right) noexcept { // false for NaN
+            return _mm256_cmp_pd(_Left, _Right, _CMP_LE_OQ);
+        }
+
+        static int _Mask(const _Vec _Val) noexcept {
+            return _mm256_movemask_pd(_Val);
+        }
+
+        static _Vec _Select(const _Vec _Mask, const _Vec _If, const _Vec _Else) noexcept {
+            return _mm256_blendv_pd(_Else, _If, _Mask);
+        }
+
+        static __m128i _Truncate(const _Vec _Val) noexcept {
+            return _mm256_cvttpd_epi32(_Val);
+        }
+
+        static _Vec _To_double(const __m128i _Val) noexcept {
+            return _mm256_cvtepi32_pd(_Val);
+        }
+
+        static _Vec _Pow2(const __m128i _Exponent, const int _Offset) noexcept { // 2^(_Exponent + _Offset), normal
+            const __m128i _Biased = _mm_add_epi32(_Exponent, _mm_set1_epi32(_Offset + 1023));
+            return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(_Biased), 52));
+        }
+    };
+
+    template <class _Traits>
+    typename _Traits::_Vec _Exp_vector(const typename _Traits::_Vec _Val, const int _Eoff) noexcept {
+        // e^_Val * 2^_Eoff for |_Val| <= _Exp_limit, as _Exp(&_Val, 1.0, _Eoff) computes it
+        using _Tr        = _Traits;
+        const auto _Sign = _Tr::_Set(-0.0);
+
+        // xexp = g rounded half away from zero, g = x - xexp * ln2 in two parts
+        auto _Gx            = _Tr::_Mul(_Val, _Tr::_Set(_Invln2));
+        const __m128i _Xexp = _Tr::_Truncate(_Tr::_Add(_Gx, _Tr::_Or(_Tr::_And(_Gx, _Sign), _Tr::_Set(0.5))));
+        _Gx                 = _Tr::_To_double(_Xexp);
+        _Gx = _Tr::_Sub(_Tr::_Sub(_Val, _Tr::_Mul(_Gx, _Tr::_Set(_Exp_c1))), _Tr::_Mul(_Gx, _Tr::_Set(_Exp_c2)));
+        const auto _Tiny = _Tr::_Less(_Tr::_Andnot(_Sign, _Gx), _Tr::_Set(_Eps._Double));
+
+        // (w + g * p(z)) / (w - g * p(z)) * 2, z = g * g
+        const auto _Zx = _Tr::_Mul(_Gx, _Gx);
+        const auto _Wx = _Tr::_Add(
+            _Tr::_Mul(_Tr::_Add(_Tr::_Mul(_Tr::_Set(_Exp_q[0]), _Zx), _Tr::_Set(_Exp_q[1])), _Zx), _Tr::_Set(_Exp_q[2]));
+        _Gx = _Tr::_Mul(_Gx, _Tr::_Add(_Tr::_Mul(_Tr::_Add(_Zx, _Tr::_Set(_Exp_p[1])), _Zx), _Tr::_Set(_Exp_p[2])));
+        auto _Result = _Tr::_Mul(_Tr::_Div(_Tr::_Add(_Wx, _Gx), _Tr::_Sub(_Wx, _Gx)), _Tr::_Set(2.0));
+
+        // _Exp scales 1.0 by 2^xexp for a tiny remainder; 2.0 by 2^(xexp - 1) is the same value
+        _Result = _Tr::_Select(_Tiny, _Tr::_Set(2.0), _Result);
+        return _Tr::_Mul(_Result, _Tr::_Pow2(_Xexp, _Eoff - 1));
+    }
+
+    template <class _Traits>
+    struct _Exp_kernel {
+        using _Vec = typename _Traits::_Vec;
+
+        static bool _Apply(const _Vec _Val, _Vec& _Result) noexcept {
+            const auto _Abs = _Traits::_Andnot(_Traits::_Set(-0.0), _Val);
+            if (_Traits::_Mask(_Traits::_Less_equal(_Abs, _Traits::_Set(_Exp_limit))) != _Traits::_All) {
+                return false;
+            }
+
+            _Result = _Exp_vector<_Traits>(_Val, 0);
+            return true;
+        }
+    };
+
+    template <class _Traits>
+    struct _Sinh_kernel {
+        using _Vec = typename _Traits::_Vec;
+
+        static bool _Apply(const _Vec _Val, _Vec& _Result) noexcept {
+            using _Tr        = _Traits;
+            const auto _Sign = _Tr::_Set(-0.0);
+            const auto _Abs  = _Tr::_Andnot(_Sign, _Val);
+            if (_Tr::_Mask(_Tr::_Less(_Abs, _Tr::_Set(_Xbig))) != _Tr::_All) {
+                return false;
+            }
+
+            // |x| < 1: x + x * w * _Poly(w, p, 5), w = x * x, in _Poly's Estrin order
+            const auto _Wx    = _Tr::_Mul(_Abs, _Abs);
+            const auto _W2    = _Tr::_Mul(_Wx, _Wx);
+            const auto _W4    = _Tr::_Mul(_W2, _W2);
+            const auto _Poly0 = _Tr::_Add(_Tr::_Mul(_Tr::_Set(_Sinh_p[0]), _Wx), _Tr::_Set(_Sinh_p[1]));
+            const auto _Poly2 = _Tr::_Add(_Tr::_Mul(_Tr::_Set(_Sinh_p[2]), _Wx), _Tr::_Set(_Sinh_p[3]));
+            const auto _Poly4 = _Tr::_Add(_Tr::_Mul(_Tr::_Set(_Sinh_p[4]), _Wx), _Tr::_Set(_Sinh_p[5]));
+            const auto _Poly  = _Tr::_Add(_Tr::_Mul(_Poly0, _W4), _Tr::_Add(_Tr::_Mul(_Poly2, _W2), _Poly4));
+            const auto _Small = _Tr::_Add(_Abs, _Tr::_Mul(_Tr::_Mul(_Abs, _Wx), _Poly));
+
+            // otherwise e - 0.25 / e, e = e^|x| / 2
+            const auto _Ex    = _Exp_vector<_Tr>(_Abs, -1);
+            const auto _Large = _Tr::_Sub(_Ex, _Tr::_Div(_Tr::_Set(0.25), _Ex));
+
+            auto _Magnitude = _Tr::_Select(_Tr::_Less(_Abs, _Tr::_Set(1.0)), _Small, _Large);
+            _Magnitude      = _Tr::_Select(_Tr::_Less(_Abs, _Tr::_Set(_Rteps._Double)), _Abs, _Magnitude);
+            _Result         = _Tr::_Or(_Magnitude, _Tr::_And(_Val, _Sign));
+            return true;
+        }
+    };
+
+    template <class _Traits>
+    struct _Cosh_kernel {
+        using _Vec = typename _Traits::_Vec;
+
+        static bool _Apply(const _Vec _Val, _Vec& _Result) noexcept {
+            const auto _Abs = _Traits::_Andnot(_Traits::_Set(-0.0), _Val);
+            if (_Traits::_Mask(_Traits::_Less(_Abs, _Traits::_Set(_Xbig))) != _Traits::_All) {
+                return false;
+            }
+
+            // e + 0.25 / e, e = e^|x| / 2
+            const auto _Ex = _Exp_vector<_Traits>(_Abs, -1);
+            _Result        = _Traits::_Add(_Ex, _Traits::_Div(_Traits::_Set(0.25), _Ex));
+            return true;
+        }
+    };
+
+    template <class _Traits, template <class> class _Kernel, class _Fn>
+    void _Transform_vector(const double*& _First, const double* const _Last, double*& _Dest, _Fn _Scalar) noexcept {
+        // whole vectors only; _Dest may equal _First
+        for (; static_cast<size_t>(_Last - _First) >= _Traits::_Lanes;
+             _First += _Traits::_Lanes, _Dest += _Traits::_Lanes) {
+            typename _Traits::_Vec _Result;
+            if (_Kernel<_Traits>::_Apply(_Traits::_Load(_First), _Result)) {
+                _Traits::_Store(_Dest, _Result);
+            } else {
+                _Transform_scalar(_First, _First + _Traits::_Lanes, _Dest, _Scalar);
+            }
+        }
+    }
+#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+
+    template <template <class> class _Kernel, class _Fn>
+    void _Transform(const double* _First, const double* const _Last, double* _Dest, _Fn _Scalar) noexcept {
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+        if (_Use_avx2()) {
+            _Transform_vector<_Traits_avx2, _Kernel>(_First, _Last, _Dest, _Scalar);
+        }
+
+        if (_Use_sse2()) {
+            _Transform_vector<_Traits_sse2, _Kernel>(_First, _Last, _Dest, _Scalar);
+        }
+#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+
+        _Transform_scalar(_First, _Last, _Dest, _Scalar);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+void __stdcall __std_exp_array(const double* const _First, const double* const _Last, double* const _Dest) noexcept {
+    _Transform<_Exp_kernel>(_First, _Last, _Dest, _Exp_scalar);
+}
+
+void __stdcall __std_sinh_array(const double* const _First, const double* const _Last, double* const _Dest) noexcept {
+    _Transform<_Sinh_kernel>(_First, _Last, _Dest, _Sinh_scalar);
+}
+
+void __stdcall __std_cosh_array(const double* const _First, const double* const _Last, double* const _Dest) noexcept {
+    _Transform<_Cosh_kernel>(_First, _Last, _Dest, _Cosh_scalar);
+}
+
+} // extern "C"
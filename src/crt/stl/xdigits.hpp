@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// decimal digit scanning for the _Sto* parsers, 8 characters per step (16 with SSE2)
+
+#pragma once
+
+#include <yvals.h>
+
+#include <cstddef>
+#include <cstring>
+#include <intrin.h>
+
+#if defined(_M_X64) && !defined(_M_ARM64EC)
+#include <emmintrin.h>
+#endif // defined(_M_X64) && !defined(_M_ARM64EC)
+
+// The scanners read whole words starting at the current character, which may run past the
+// terminating null of the caller's string; a read that stays within one page cannot fault.
+// It can still leave the caller's allocation, and tools that check reads at a finer grain than
+// the page report it: kernel AddressSanitizer flags the bytes past the end of a pool block, as
+// do special pool style checkers that guard an allocation more tightly than a page. Under
+// AddressSanitizer the scanners are off and the parsers take their character loops.
+constexpr size_t _Digits_page_size = 0x1000;
+
+inline bool _Digits_can_read(const void* const _Ptr, const size_t _Size) noexcept {
+#ifdef __SANITIZE_ADDRESS__
+    (void) _Ptr;
+    (void) _Size;
+    return false;
+#else // ^^^ defined(__SANITIZE_ADDRESS__) ^^^ / vvv !defined(__SANITIZE_ADDRESS__) vvv
+    return (reinterpret_cast<size_t>(_Ptr) & (_Digits_page_size - 1)) <= _Digits_page_size - _Size;
+#endif // ^^^ !defined(__SANITIZE_ADDRESS__) ^^^
+}
+
+inline int _Digits_countr_zero(const unsigned long long _Val) noexcept { // _Val != 0
+    unsigned long _Idx;
+#if defined(_M_X64) || defined(_M_ARM64)
+    _BitScanForward64(&_Idx, _Val);
+    return static_cast<int>(_Idx);
+#else // ^^^ 64-bit ^^^ / vvv _M_IX86 vvv
+    if (_BitScanForward(&_Idx, static_cast<unsigned long>(_Val))) {
+        return static_cast<int>(_Idx);
+    }
+
+    _BitScanForward(&_Idx, static_cast<unsigned long>(_Val >> 32));
+    return static_cast<int>(_Idx) + 32;
+#endif // ^^^ _M_IX86 ^^^
+}
+
+inline unsigned long long _Digits_load_8(const void* const _Ptr) noexcept {
+    unsigned long long _Word;
+    _CSTD memcpy(&_Word, _Ptr, sizeof(_Word));
+    return _Word;
+}
+
+inline int _Digits_run_8(const unsigned long long _Word) noexcept {
+    // number of leading '0'-'9' bytes in _Word; a byte is a digit when its high nibble is 3 and
+    // adding 6 keeps it so (carries only start at bytes past the first non-digit)
+    const unsigned long long _Bad = ((_Word & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030)
+                                  | (((_Word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030);
+    if (_Bad == 0) {
+        return 8;
+    }
+
+    return _Digits_countr_zero(((_Bad & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F | _Bad) & 0x8080808080808080) >> 3;
+}
+
+inline int _Digits_run_4w(const unsigned long long _Word) noexcept {
+    // number of leading L'0'-L'9' elements in _Word, four wchar_t at a time
+    const unsigned long long _Bad = ((_Word & 0xFFF0FFF0FFF0FFF0) ^ 0x0030003000300030)
+                                  | (((_Word + 0x0006000600060006) & 0xFFF0FFF0FFF0FFF0) ^ 0x0030003000300030);
+    if (_Bad == 0) {
+        return 4;
+    }
+
+    return _Digits_countr_zero(
+               ((_Bad & 0x7FFF7FFF7FFF7FFF) + 0x7FFF7FFF7FFF7FFF | _Bad) & 0x8000800080008000)
+        >> 4;
+}
+
+inline unsigned long _Digits_value_8(unsigned long long _Word, const int _Count) noexcept {
+    // value of the first _Count (1-8) digit bytes of _Word; moving them to the top leaves zero digits below
+    _Word = (_Word - 0x3030303030303030) << (64 - 8 * _Count);
+    _Word = _Word * 10 + (_Word >> 8); // pairs in bytes 0, 2, 4, 6
+    return static_cast<unsigned long>(((_Word & 0x000000FF000000FF) * (100 + (1000000ULL << 32))
+                                          + ((_Word >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))
+                                      >> 32);
+}
+
+#if defined(_M_X64) && !defined(_M_ARM64EC)
+inline int _Digits_run_16(const char* const _Ptr) noexcept {
+    // '0'-'9' become -128..-119 as signed bytes; anything else compares greater
+    const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+    const __m128i _Bias = _mm_sub_epi8(_Data, _mm_set1_epi8(static_cast<char>('0' + 128)));
+    const unsigned int _Bad =
+        static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_Bias, _mm_set1_epi8(-128 + 9))));
+    return _Bad == 0 ? 16 : _Digits_countr_zero(_Bad);
+}
+#endif // defined(_M_X64) && !defined(_M_ARM64EC)
+
+inline int _Digits_scan(const char*& _Ptr, const int _Max, unsigned long long& _Val) noexcept {
+    // consume up to _Max decimal digits, _Val = _Val * 10^n + digits; the caller keeps _Val from overflowing
+    static constexpr unsigned long _Pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+    int _Count = 0;
+
+#if defined(_M_X64) && !defined(_M_ARM64EC)
+    if (16 <= _Max && _Digits_can_read(_Ptr, 16)) {
+        const int _Run = _Digits_run_16(_Ptr);
+        if (_Run < 16) { // the common case: the whole number is in view
+            if (_Run > 8) {
+                _Val = _Val * _Pow10[8] + _Digits_value_8(_Digits_load_8(_Ptr), 8);
+                _Val = _Val * _Pow10[_Run - 8] + _Digits_value_8(_Digits_load_8(_Ptr + 8), _Run - 8);
+            } else if (_Run > 0) {
+                _Val = _Val * _Pow10[_Run] + _Digits_value_8(_Digits_load_8(_Ptr), _Run);
+            }
+
+            _Ptr += _Run;
+            return _Run;
+        }
+    }
+#endif // defined(_M_X64) && !defined(_M_ARM64EC)
+
+    while (_Count < _Max && _Digits_can_read(_Ptr, 8)) {
+        const unsigned long long _Word = _Digits_load_8(_Ptr);
+        int _Run                       = _Digits_run_8(_Word);
+        if (_Max - _Count < _Run) {
+            _Run = _Max - _Count;
+        }
+
+        if (_Run == 0) {
+            break;
+        }
+
+        _Val = _Val * _Pow10[_Run] + _Digits_value_8(_Word, _Run);
+        _Ptr += _Run;
+        _Count += _Run;
+        if (_Run != 8) {
+            break;
+        }
+    }
+
+    return _Count;
+}
+
+inline int _Digits_copy(const char*& _Ptr, const int _Max, char* _Buf) noexcept {
+    // move up to _Max decimal digits to _Buf as values 0-9, 8 at a time; _Buf must have room for
+    // _Max rounded up to a multiple of 8
+    int _Count = 0;
+
+    while (_Count + 8 <= _Max && _Digits_can_read(_Ptr, 8)) {
+        const unsigned long long _Word = _Digits_load_8(_Ptr);
+        const int _Run                 = _Digits_run_8(_Word);
+        const unsigned long long _Vals = _Word - 0x3030303030303030; // garbage past _Run is never used
+
+        _CSTD memcpy(_Buf + _Count, &_Vals, sizeof(_Vals));
+        _Ptr += _Run;
+        _Count += _Run;
+        if (_Run != 8) {
+            break;
+        }
+    }
+
+    return _Count;
+}
+
+inline int _Digits_copy(const wchar_t*& _Ptr, const int _Max, char* _Buf) noexcept {
+    // wide form of the above, 4 digits at a time
+    int _Count = 0;
+
+    while (_Count + 4 <= _Max && _Digits_can_read(_Ptr, 8)) {
+        const unsigned long long _Word = _Digits_load_8(_Ptr);
+        const int _Run                 = _Digits_run_4w(_Word);
+        const unsigned long long _Vals = _Word - 0x0030003000300030;
+
+        _Buf[_Count]     = static_cast<char>(_Vals);
+        _Buf[_Count + 1] = static_cast<char>(_Vals >> 16);
+        _Buf[_Count + 2] = static_cast<char>(_Vals >> 32);
+        _Buf[_Count + 3] = static_cast<char>(_Vals >> 48);
+        _Ptr += _Run;
+        _Count += _Run;
+        if (_Run != 4) {
+            break;
+        }
+    }
+
+    return _Count;
+}
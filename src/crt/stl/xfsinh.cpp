@@ -35,9 +35,10 @@ _CRTIMP2_PURE float __CLRCALL_PURE_OR_CDECL _FSinh(float x, float y) noexcept {
         if (x < _FRteps._Float) {
             x *= y; // x tiny
         } else if (x < 1.0F) {
-            float w = x * x;
+            const float w  = x * x;
+            const float w2 = w * w;
 
-            x += ((p[0] * w + p[1]) * w + p[2]) * w * x;
+            x += (p[0] * w2 + (p[1] * w + p[2])) * w * x;
             x *= y;
         } else if (x < _FXbig) { // worth adding in exp(-x)
             _FExp(&x, 1.0F, -1);
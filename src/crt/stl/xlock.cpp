@@ -15,13 +15,15 @@
 #endif
 #include "xmtx.hpp"
 
+#include <kext/klockit.h>
+
 #ifndef _LOCK_AT_THREAD_EXIT
 #define _LOCK_AT_THREAD_EXIT 4
 #endif
 
 _STD_BEGIN
 
-constexpr int _Max_lock = 8; // must be power of two
+constexpr int _Max_lock = 8; // must be power of two, one cache line each
 
 #pragma warning(disable : 4074)
 #pragma init_seg(compiler)
@@ -137,6 +139,35 @@ void _Lock_at_thread_exit_mutex() { // lock the at-thread-exit mutex
 void _Unlock_at_thread_exit_mutex() { // unlock the at-thread-exit mutex
     _Mtxunlock(&mtx[_LOCK_AT_THREAD_EXIT]);
 }
+
+void __cdecl __ucxxrt_lockit_lock_shared(int kind) noexcept { // lock the mutex shared
+    if (kind == _LOCK_LOCALE) {
+        _lock_locales();
+    } else {
+        _Mtxlock_shared(&mtx[kind & (_Max_lock - 1)]);
+    }
+}
+
+void __cdecl __ucxxrt_lockit_unlock_shared(int kind) noexcept { // unlock the mutex shared
+    if (kind == _LOCK_LOCALE) {
+        _unlock_locales();
+    } else {
+        _Mtxunlock_shared(&mtx[kind & (_Max_lock - 1)]);
+    }
+}
+
+bool __cdecl __ucxxrt_query_lockit_statistics(int kind, __ucxxrt_lockit_statistics* statistics) noexcept {
+    if (kind == _LOCK_LOCALE || kind < 0 || kind >= _Max_lock) {
+        return false;
+    }
+
+    const _Rmtx& _Mtx = mtx[kind];
+    statistics->exclusive = ReadULong64NoFence(&_Mtx._Exclusive);
+    statistics->shared    = static_cast<unsigned long long>(ReadNoFence64(&_Mtx._Shared));
+    statistics->contended = static_cast<unsigned long long>(ReadNoFence64(&_Mtx._Contended));
+    statistics->sleeps    = static_cast<unsigned long long>(ReadNoFence64(&_Mtx._Sleeps));
+    return true;
+}
 _END_EXTERN_C
 
 _STD_END
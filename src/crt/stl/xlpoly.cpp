@@ -10,6 +10,27 @@ _EXTERN_C_UNLESS_PURE
 long double _LPoly(long double x, const long double* tab, int n) noexcept { // compute polynomial
     long double y;
 
+    if (1 < n && n < 8) { // Estrin's scheme: three dependent multiply-adds instead of up to seven
+        const long double x2 = x * x;
+        const long double x4 = x2 * x2;
+
+        switch (n) {
+        case 2:
+            return tab[0] * x2 + (tab[1] * x + tab[2]);
+        case 3:
+            return (tab[0] * x + tab[1]) * x2 + (tab[2] * x + tab[3]);
+        case 4:
+            return tab[0] * x4 + ((tab[1] * x + tab[2]) * x2 + (tab[3] * x + tab[4]));
+        case 5:
+            return (tab[0] * x + tab[1]) * x4 + ((tab[2] * x + tab[3]) * x2 + (tab[4] * x + tab[5]));
+        case 6:
+            return (tab[0] * x2 + (tab[1] * x + tab[2])) * x4 + ((tab[3] * x + tab[4]) * x2 + (tab[5] * x + tab[6]));
+        default:
+            return ((tab[0] * x + tab[1]) * x2 + (tab[2] * x + tab[3])) * x4
+                 + ((tab[4] * x + tab[5]) * x2 + (tab[6] * x + tab[7]));
+        }
+    }
+
     for (y = *tab; 0 <= --n;) {
         y = y * x + *++tab;
     }
@@ -129,6 +129,8 @@ double* _Xp_addx(double*, int, const double*, int) noexcept;
 double* _Xp_ldexpx(double*, int, int) noexcept;
 double* _Xp_mulx(double*, int, const double*, int, double*) noexcept;
 
+bool _Eisel_lemire(unsigned long long, long, bool, double*, int*) noexcept;
+
 // float declarations
 union _Fval { // pun floating type as integer array
     unsigned short _Sh[8];
@@ -156,6 +158,8 @@ float* _FXp_addx(float*, int, const float*, int) noexcept;
 float* _FXp_ldexpx(float*, int, int) noexcept;
 float* _FXp_mulx(float*, int, const float*, int, float*) noexcept;
 
+bool _FEisel_lemire(unsigned long long, long, bool, float*, int*) noexcept;
+
 // long double declarations
 union _Lval { // pun floating type as integer array
     unsigned short _Sh[8];
@@ -183,6 +187,8 @@ long double* _LXp_addx(long double*, int, const long double*, int) noexcept;
 long double* _LXp_ldexpx(long double*, int, int) noexcept;
 long double* _LXp_mulx(long double*, int, const long double*, int, long double*) noexcept;
 
+bool _LEisel_lemire(unsigned long long, long, bool, long double*, int*) noexcept;
+
 _END_EXTERN_C_UNLESS_PURE
 
 // raise IEEE 754 exceptions
@@ -7,26 +7,171 @@
 
 //#include "awint.hpp"
 
-_EXTERN_C_UNLESS_PURE
+// Recursive when held exclusive, like the critical sections these replace.
+// A thread that holds the mutex exclusive may also take it shared; it keeps
+// the mutex exclusive until it has released both kinds of acquisition, in
+// any order. Shared acquisitions do not nest: while a writer waits, no new
+// shared owner joins those already in.
+//
+// A release wakes every thread counted in _Waiters. The semaphore does not
+// pick which thread gets a wakeup, so a thread may consume one meant for
+// another; that is safe because a free mutex can always be taken by the
+// thread that wakes, and its own count, still in _Waiters, pays for a wakeup
+// at its release.
+
+enum : long {
+    _Mtx_exclusive      = 1,
+    _Mtx_writer_waiting = 2,
+    _Mtx_shared_unit    = 4,
+};
+
+static unsigned long _Mtx_spin_count; // zero on one processor
+
+static bool _Mtx_try_exclusive(_Rmtx* _Mtx) noexcept {
+    // A waiting writer's flag is cleared by whichever writer gets in; the
+    // others set it again when they wake.
+    const long _State = ReadNoFence(&_Mtx->_State);
+    return (_State & ~_Mtx_writer_waiting) == 0
+        && _InterlockedCompareExchange(&_Mtx->_State, _Mtx_exclusive, _State) == _State;
+}
+
+static bool _Mtx_try_shared(_Rmtx* _Mtx) noexcept {
+    for (;;) {
+        const long _State = ReadNoFence(&_Mtx->_State);
+        if ((_State & _Mtx_exclusive) != 0
+            || ((_State & _Mtx_writer_waiting) != 0 && _State >= _Mtx_shared_unit)) {
+            return false;
+        }
+
+        if (_InterlockedCompareExchange(&_Mtx->_State, _State + _Mtx_shared_unit, _State) == _State) {
+            return true;
+        }
+    }
+}
 
-// Win32 critical sections are recursive
+template <bool _Exclusive>
+static __declspec(noinline) void _Mtx_wait(_Rmtx* _Mtx) noexcept {
+    const auto _Try = _Exclusive ? _Mtx_try_exclusive : _Mtx_try_shared;
+
+    _InterlockedIncrement64(&_Mtx->_Contended);
+    for (;;) {
+        for (unsigned long _Spin = 0; _Spin < _Mtx_spin_count; ++_Spin) {
+            YieldProcessor();
+            if (_Try(_Mtx)) {
+                return;
+            }
+        }
+
+        if (_Exclusive) {
+            _InterlockedOr(&_Mtx->_State, _Mtx_writer_waiting);
+        }
+
+        // Count ourselves in before the last look at the state; a release
+        // after that look finds us when it drains the count. A count left
+        // behind costs a later waiter one spurious wakeup.
+        _InterlockedIncrement(&_Mtx->_Waiters);
+        if (_Try(_Mtx)) {
+            return;
+        }
+
+        _InterlockedIncrement64(&_Mtx->_Sleeps);
+        KeWaitForSingleObject(&_Mtx->_Semaphore, Executive, KernelMode, FALSE, nullptr);
+        if (_Try(_Mtx)) {
+            return;
+        }
+    }
+}
+
+static void _Mtx_wake(_Rmtx* _Mtx) noexcept {
+    // Ordered after the interlocked release of _State; every waiter counts
+    // itself in with an interlocked increment before it reads _State.
+    if (ReadNoFence(&_Mtx->_Waiters) == 0) {
+        return;
+    }
+
+    const long _Waiters = _InterlockedExchange(&_Mtx->_Waiters, 0);
+    if (_Waiters > 0) {
+        KeReleaseSemaphore(&_Mtx->_Semaphore, IO_NO_INCREMENT, _Waiters, FALSE);
+    }
+}
+
+static void _Mtx_release_exclusive(_Rmtx* _Mtx) noexcept {
+    WritePointerNoFence(&_Mtx->_Owner, nullptr);
+    _InterlockedAnd(&_Mtx->_State, ~_Mtx_exclusive);
+    _Mtx_wake(_Mtx);
+    KeLeaveCriticalRegion();
+}
+
+_EXTERN_C_UNLESS_PURE
 
 void __CLRCALL_PURE_OR_CDECL _Mtxinit(_Rmtx* _Mtx) noexcept { // initialize mutex
-    (void)ExInitializeResourceLite(_Mtx);
+    *_Mtx = {};
+    KeInitializeSemaphore(&_Mtx->_Semaphore, 0, MAXLONG);
+
+    if (KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS) > 1) {
+        _Mtx_spin_count = 256;
+    }
 }
 
-void __CLRCALL_PURE_OR_CDECL _Mtxdst(_Rmtx* _Mtx) noexcept { // delete mutex
-    (void)ExDeleteResourceLite(_Mtx);
+void __CLRCALL_PURE_OR_CDECL _Mtxdst(_Rmtx*) noexcept { // delete mutex
+    // nothing to release
 }
 
 _RELIABILITY_CONTRACT
 void __CLRCALL_PURE_OR_CDECL _Mtxlock(_Rmtx* _Mtx) noexcept { // lock mutex
-    ExEnterCriticalRegionAndAcquireResourceExclusive(_Mtx);
+    const auto _Self = static_cast<void*>(KeGetCurrentThread());
+    if (ReadPointerNoFence(&_Mtx->_Owner) == _Self) {
+        ++_Mtx->_Owner_exclusive;
+        ++_Mtx->_Exclusive;
+        return;
+    }
+
+    KeEnterCriticalRegion();
+    if (!_Mtx_try_exclusive(_Mtx)) {
+        _Mtx_wait<true>(_Mtx);
+    }
+
+    WritePointerNoFence(&_Mtx->_Owner, _Self);
+    _Mtx->_Owner_exclusive = 1;
+    ++_Mtx->_Exclusive;
 }
 
 _RELIABILITY_CONTRACT
 void __CLRCALL_PURE_OR_CDECL _Mtxunlock(_Rmtx* _Mtx) noexcept { // unlock mutex
-    ExReleaseResourceAndLeaveCriticalRegion(_Mtx);
+    if (--_Mtx->_Owner_exclusive == 0 && _Mtx->_Owner_shared == 0) {
+        _Mtx_release_exclusive(_Mtx);
+    }
+}
+
+void __cdecl _Mtxlock_shared(_Rmtx* _Mtx) noexcept { // lock mutex shared
+    _InterlockedIncrement64(&_Mtx->_Shared);
+    if (ReadPointerNoFence(&_Mtx->_Owner) == KeGetCurrentThread()) {
+        ++_Mtx->_Owner_shared;
+        return;
+    }
+
+    KeEnterCriticalRegion();
+    if (!_Mtx_try_shared(_Mtx)) {
+        _Mtx_wait<false>(_Mtx);
+    }
+}
+
+void __cdecl _Mtxunlock_shared(_Rmtx* _Mtx) noexcept { // unlock mutex shared
+    if (ReadPointerNoFence(&_Mtx->_Owner) == KeGetCurrentThread()) {
+        if (--_Mtx->_Owner_shared == 0 && _Mtx->_Owner_exclusive == 0) {
+            _Mtx_release_exclusive(_Mtx);
+        }
+
+        return;
+    }
+
+    // Only writers wait on shared owners, so only the last one wakes them
+    const long _State = _InterlockedExchangeAdd(&_Mtx->_State, -_Mtx_shared_unit) - _Mtx_shared_unit;
+    if (_State < _Mtx_shared_unit) {
+        _Mtx_wake(_Mtx);
+    }
+
+    KeLeaveCriticalRegion();
 }
 
 _END_EXTERN_C_UNLESS_PURE
@@ -21,7 +21,27 @@
 
 _EXTERN_C_UNLESS_PURE
 
-using _Rmtx = ERESOURCE;
+// A reader-writer lock, recursive when held exclusive, cache-line aligned so
+// that the lock kinds of xlock.cpp do not share lines. _State holds
+// _Mtx_exclusive, _Mtx_writer_waiting and the number of shared owners times
+// _Mtx_shared_unit; threads that cannot get it spin briefly, then sleep on
+// _Semaphore. The counters are read by __ucxxrt_query_lockit_statistics.
+// With them the lock takes 128 bytes: two lines on x86 and x64, one on ARM64.
+struct __declspec(align(SYSTEM_CACHE_ALIGNMENT_SIZE)) _Rmtx {
+    long volatile _State;
+    long volatile _Waiters; // threads that may sleep on _Semaphore
+    void* volatile _Owner; // exclusive owner, a PKTHREAD
+    unsigned long _Owner_exclusive; // acquisitions held by _Owner, exclusive
+    unsigned long _Owner_shared; // and shared
+    KSEMAPHORE _Semaphore;
+
+    unsigned long long _Exclusive; // updated by the owner
+    long long volatile _Shared;
+    long long volatile _Contended; // acquisitions that did not succeed at once
+    long long volatile _Sleeps;
+};
+
+static_assert(sizeof(_Rmtx) == 128, "_Rmtx should take 128 bytes");
 
 #ifdef _M_CEE_PURE
 void __clrcall _Mtxinit(_Rmtx*) noexcept;
@@ -36,6 +56,9 @@ _MRTIMP2 void __cdecl _Mtxlock(_Rmtx*) noexcept;
 _MRTIMP2 void __cdecl _Mtxunlock(_Rmtx*) noexcept;
 #endif // _M_CEE_PURE
 
+void __cdecl _Mtxlock_shared(_Rmtx*) noexcept;
+void __cdecl _Mtxunlock_shared(_Rmtx*) noexcept;
+
 _END_EXTERN_C_UNLESS_PURE
 
 #pragma pop_macro("new")
@@ -7,6 +7,7 @@
 #include <clocale>
 #include <cstdlib>
 
+#include "xdigits.hpp"
 #include "xmath.hpp"
 
 _EXTERN_C_UNLESS_PURE
@@ -37,6 +38,12 @@ _In_range_(0, maxsig) int _Stoflt(const char* s0, const char* s, char** endptr,
         ++s;
     }
 
+    int ncopy = _Digits_copy(s, maxsig - nsig, buf + nsig); // ASCII digits in bulk while they fit
+    if (ncopy != 0) {
+        nsig += ncopy;
+        seen = 1;
+    }
+
     while (isdigit(static_cast<unsigned char>(*s))) {
         if (nsig < maxsig) {
             buf[nsig++] = static_cast<char>(*s - '0'); // accumulate a digit
@@ -61,6 +68,13 @@ _In_range_(0, maxsig) int _Stoflt(const char* s0, const char* s, char** endptr,
         }
     }
 
+    ncopy = _Digits_copy(s, maxsig - nsig, buf + nsig);
+    if (ncopy != 0) {
+        nsig += ncopy;
+        lo[0] -= ncopy;
+        seen = 1;
+    }
+
     for (; isdigit(static_cast<unsigned char>(*s)); ++s, seen = 1) {
         if (nsig < maxsig) { // accumulate a fraction digit
             buf[nsig++] = static_cast<char>(*s - '0');
@@ -12,6 +12,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "xdigits.hpp"
+
 _EXTERN_C_UNLESS_PURE
 
 constexpr int _Base_max = 36; // largest valid base
@@ -71,8 +73,20 @@ _CRTIMP2_PURE unsigned long __CLRCALL_PURE_OR_CDECL _Stoulx(
         ++sc;
     }
 
-    x = 0;
-    for (s2 = sc, y = 0; (sd = static_cast<const char*>(memchr(&digits[0], tolower(*sc), base))) != nullptr;
+    x  = 0;
+    y  = 0;
+    s2 = sc;
+    if (base == 10) { // 10 digits fit in 64 bits; recover the last step for the overflow check
+        unsigned long long x10 = 0;
+        if (_Digits_scan(sc, 10, x10) == 10) {
+            y   = static_cast<unsigned long>(x10 / 10);
+            dig = static_cast<char>(x10 % 10);
+        }
+
+        x = static_cast<unsigned long>(x10);
+    }
+
+    for (; (sd = static_cast<const char*>(memchr(&digits[0], tolower(*sc), base))) != nullptr;
          ++sc) { // accumulate digits
         y   = x;
         dig = static_cast<char>(sd - digits); // for overflow checking
@@ -12,6 +12,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "xdigits.hpp"
+
 _EXTERN_C_UNLESS_PURE
 
 constexpr int _Base_max = 36; // largest valid base
@@ -69,8 +71,13 @@ _CRTIMP2_PURE unsigned long long __CLRCALL_PURE_OR_CDECL _Stoullx(
     for (s1 = sc; *sc == '0'; ++sc) { // skip leading zeros
     }
 
-    x = 0;
-    for (s2 = sc, y = 0, dig = 0; (sd = static_cast<const char*>(memchr(&digits[0], tolower(*sc), base))) != nullptr;
+    x  = 0;
+    s2 = sc;
+    if (base == 10) { // 19 digits cannot overflow; the loop below takes any more
+        _Digits_scan(sc, 19, x);
+    }
+
+    for (y = 0, dig = 0; (sd = static_cast<const char*>(memchr(&digits[0], tolower(*sc), base))) != nullptr;
          ++sc) { // accumulate digits
         y   = x;
         dig = static_cast<char>(sd - digits); // for overflow checking
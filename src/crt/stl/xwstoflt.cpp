@@ -7,6 +7,7 @@
 #include <cwchar>
 #include <cwctype>
 
+#include "xdigits.hpp"
 #include "xmath.hpp"
 
 _EXTERN_C_UNLESS_PURE
@@ -36,6 +37,12 @@ _In_range_(0, maxsig) int _WStoflt(const wchar_t* s0, const wchar_t* s, wchar_t*
         seen = 1;
     }
 
+    int ncopy = _Digits_copy(s, maxsig + 1 - nsig, buf + nsig); // ASCII digits in bulk while they fit
+    if (ncopy != 0) {
+        nsig += ncopy;
+        seen = 1;
+    }
+
     while (iswdigit(*s)) {
         if (nsig <= maxsig) {
             buf[nsig++] = static_cast<char>(*s - L'0'); // accumulate a digit
@@ -59,6 +66,13 @@ _In_range_(0, maxsig) int _WStoflt(const wchar_t* s0, const wchar_t* s, wchar_t*
         }
     }
 
+    ncopy = _Digits_copy(s, maxsig + 1 - nsig, buf + nsig);
+    if (ncopy != 0) {
+        nsig += ncopy;
+        lo[0] -= ncopy;
+        seen = 1;
+    }
+
     while (iswdigit(*s)) {
         if (nsig <= maxsig) { // accumulate a fraction digit
             buf[nsig++] = static_cast<char>(*s - L'0');
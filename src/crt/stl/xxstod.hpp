@@ -34,26 +34,36 @@
     if ((code &= ~FL_NEG) == FL_DEC) { // parse decimal format
         const int nlo = CNAME(Stoflt)(s0, s, endptr, lo, NLONG);
         _Analysis_assume_(nlo <= NLONG);
-        FTYPE xpx[ACSIZE];
-        FTYPE xpf[ACSIZE];
+        unsigned long long w = 0;
         int i;
 
-        FNAME(Xp_setw)(xpf, ACSIZE, D10TO9);
-        if (nlo == 0) {
-            FNAME(Xp_setw)(xpx, ACSIZE, 0.0);
-        } else {
-            for (i = 1, FNAME(Xp_setn)(xpx, ACSIZE, lo[1]); i < nlo;) { // x = x * D10TO9 + (FTYPE)lo[++i]
-                FTYPE xpa[ACSIZE];
-                FTYPE xpt[ACSIZE * 2];
-
-                FNAME(Xp_mulx)(xpx, ACSIZE, xpf, ACSIZE, xpt);
-                FNAME(Xp_setn)(xpa, ACSIZE, lo[++i]);
-                FNAME(Xp_addx)(xpx, ACSIZE, xpa, ACSIZE);
-            }
+        for (i = 1; i <= nlo && i <= 2; ++i) { // up to 18 digits fit the 64-bit significand of the fast path
+            w = w * 1000000000 + static_cast<unsigned long>(lo[i]);
         }
 
+        // a full first word means every kept digit is used and the last one may have been rounded
         pten += lo[0];
-        x = FNAME(Dtento)(xpx, pten, perr);
+        if (nlo == 0 || 2 < nlo
+            || !FNAME(Eisel_lemire)(w, pten, nlo == NLONG && 100000000 <= lo[1], &x, perr)) { // else extended precision
+            FTYPE xpx[ACSIZE];
+            FTYPE xpf[ACSIZE];
+
+            FNAME(Xp_setw)(xpf, ACSIZE, D10TO9);
+            if (nlo == 0) {
+                FNAME(Xp_setw)(xpx, ACSIZE, 0.0);
+            } else {
+                for (i = 1, FNAME(Xp_setn)(xpx, ACSIZE, lo[1]); i < nlo;) { // x = x * D10TO9 + (FTYPE)lo[++i]
+                    FTYPE xpa[ACSIZE];
+                    FTYPE xpt[ACSIZE * 2];
+
+                    FNAME(Xp_mulx)(xpx, ACSIZE, xpf, ACSIZE, xpt);
+                    FNAME(Xp_setn)(xpa, ACSIZE, lo[++i]);
+                    FNAME(Xp_addx)(xpx, ACSIZE, xpa, ACSIZE);
+                }
+            }
+
+            x = FNAME(Dtento)(xpx, pten, perr);
+        }
     } else if (code == FL_HEX) { // parse hexadecimal format
         const int nlo = CNAME(Stoxflt)(s0, s, endptr, lo, NLONG);
         _Analysis_assume_(nlo <= NLONG);
@@ -0,0 +1,803 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      ehcache.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// Per-processor, direct-mapped cache of RtlLookupFunctionEntry results, and a
+// global memo of RtlPcToFileHeader results keyed by ThrowInfo / locator.  The
+// EH dispatcher asks for the same handful of control PCs on every pass of
+// every throw, and _CxxThrowException / RTTI ask for the image base of the
+// same ThrowInfo and locators; both walks are searches over loader data.
+// __RTDynamicCast keeps the outcome of its base class array walks in a third
+// table keyed by (locator, source type, target type, source offset), and the
+// type comparators keep the hash and length of each decorated name they have
+// seen, so that names the cache keeps are only compared when they match.
+//
+// Each entry is guarded by a sequence word (odd while being written), so a
+// thread that migrates between processors, or is preempted mid-update, can
+// only ever see a miss, never a torn entry.  Entries also carry the cache
+// generation at the time they were filled; bumping the generation drops the
+// whole cache at once.  A kernel image's range can only be reused by a later
+// load, so when the driver opts in to image tracking the generation is bumped
+// on every system image load.  Otherwise only keys inside this driver's image,
+// which stays loaded as long as the CRT, are cached: a load image notify
+// routine takes one of the few slots the system has (eight on Windows 7).
+//
+#include <vcruntime_internal.h>
+#include <kext/kehcache.h>
+
+#if defined _M_X64 || defined _M_ARM || defined _M_ARM64 || defined _M_HYBRID
+
+// Must be a power of two.
+#define __vcrt_eh_cache_slots 64
+
+struct __vcrt_eh_cache_entry
+{
+    long volatile               sequence;
+    long volatile               generation;
+    ULONG_PTR volatile          pc;
+    ULONG_PTR volatile          image_base;
+    PRUNTIME_FUNCTION volatile  function_entry;
+};
+
+struct __vcrt_eh_cache_block
+{
+    __vcrt_eh_cache_entry       entries[__vcrt_eh_cache_slots];
+
+    LONG64 volatile             function_entry_hits;
+    LONG64 volatile             function_entry_misses;
+    LONG64 volatile             image_base_hits;
+    LONG64 volatile             image_base_misses;
+    LONG64 volatile             cast_hits;
+    LONG64 volatile             cast_misses;
+    LONG64 volatile             type_name_hits;
+    LONG64 volatile             type_name_misses;
+};
+
+// Image base memo, open addressed with linear probing.  Slots are claimed
+// once and never freed; a slot from an older generation is reclaimed by the
+// next insert that probes over it.  Must be a power of two.
+#define __vcrt_image_base_slots  256
+#define __vcrt_image_base_probes 8
+
+struct __vcrt_image_base_entry
+{
+    long volatile               sequence;
+    long volatile               generation;
+    ULONG_PTR volatile          key;
+    ULONG_PTR volatile          image_base;
+};
+
+static __vcrt_image_base_entry  __vcrt_image_base_table[__vcrt_image_base_slots];
+
+// dynamic_cast memo, managed like the image base memo.  A cached failure has
+// a null base_class.  Must be a power of two.
+#define __vcrt_cast_slots  256
+#define __vcrt_cast_probes 8
+
+struct __vcrt_cast_entry
+{
+    long volatile               sequence;
+    long volatile               generation;
+    ULONG_PTR volatile          locator;
+    ULONG_PTR volatile          source;
+    ULONG_PTR volatile          target;
+    LONG_PTR volatile           source_offset;
+    ULONG_PTR volatile          base_class;
+};
+
+static __vcrt_cast_entry        __vcrt_cast_table[__vcrt_cast_slots];
+
+// Decorated name -> (hash, length) memo, keyed by the address of the name and
+// managed like the image base memo.  The hash is the one std::type_info::hash
+// returns, so the memo serves both.  Must be a power of two.
+#define __vcrt_type_name_slots  512
+#define __vcrt_type_name_probes 8
+
+struct __vcrt_type_name_entry
+{
+    long volatile               sequence;
+    long volatile               generation;
+    ULONG_PTR volatile          key;
+    size_t volatile             hash;
+    size_t volatile             length;
+};
+
+static __vcrt_type_name_entry   __vcrt_type_name_table[__vcrt_type_name_slots];
+
+// Keep per-processor blocks on separate cache lines.
+#define __vcrt_eh_cache_block_size \
+    ROUND_TO_SIZE(sizeof(__vcrt_eh_cache_block), SYSTEM_CACHE_ALIGNMENT_SIZE)
+
+static unsigned char*   __vcrt_eh_cache;
+static ULONG            __vcrt_eh_cache_processors;
+static long volatile    __vcrt_eh_cache_generation;
+static LONG64 volatile  __vcrt_eh_cache_flushes;
+static bool             __vcrt_eh_cache_tracking;
+
+// The address range whose keys are cached: everything while image tracking is
+// on, this image otherwise.
+static ULONG_PTR        __vcrt_eh_cache_low;
+static ULONG_PTR        __vcrt_eh_cache_span;
+
+
+
+static __forceinline void __vcrt_eh_cache_load_fence()
+{
+#if defined _M_ARM64 || defined _M_ARM64EC
+    __dmb(_ARM64_BARRIER_ISHLD);
+#elif defined _M_ARM
+    __dmb(_ARM_BARRIER_ISH);
+#else
+    _ReadBarrier(); // x64 does not reorder loads with other loads
+#endif
+}
+
+static __forceinline bool __vcrt_eh_cache_keeps(ULONG_PTR const address)
+{
+    return address - __vcrt_eh_cache_low < __vcrt_eh_cache_span;
+}
+
+static __forceinline __vcrt_eh_cache_block* __vcrt_eh_cache_current_block()
+{
+    ULONG processor = KeGetCurrentProcessorNumberEx(nullptr);
+    if (processor >= __vcrt_eh_cache_processors)
+    {
+        processor = 0;
+    }
+
+    return reinterpret_cast<__vcrt_eh_cache_block*>(
+        __vcrt_eh_cache + static_cast<size_t>(processor) * __vcrt_eh_cache_block_size);
+}
+
+static __forceinline __vcrt_eh_cache_entry* __vcrt_eh_cache_slot(
+    __vcrt_eh_cache_block* const block,
+    ULONG_PTR              const pc
+)
+{
+    // Code PCs are 4-byte aligned on ARM, and data keys (ThrowInfo, locators)
+    // are pointer aligned everywhere; fold in the page number so that
+    // neighbouring functions in different pages do not collide.
+    size_t const index = ((pc >> 2) ^ (pc >> 12)) & (__vcrt_eh_cache_slots - 1);
+    return &block->entries[index];
+}
+
+static bool __vcrt_eh_cache_read(
+    __vcrt_eh_cache_entry* const entry,
+    ULONG_PTR              const pc,
+    ULONG_PTR*             const image_base,
+    PRUNTIME_FUNCTION*     const function_entry
+)
+{
+    long const sequence = ReadAcquire(&entry->sequence);
+    if (sequence & 1)
+    {
+        return false;
+    }
+
+    long              const generation = entry->generation;
+    ULONG_PTR         const key        = entry->pc;
+    ULONG_PTR         const base       = entry->image_base;
+    PRUNTIME_FUNCTION const function   = entry->function_entry;
+
+    __vcrt_eh_cache_load_fence();
+
+    if (ReadNoFence(&entry->sequence) != sequence ||
+        generation != ReadNoFence(&__vcrt_eh_cache_generation) ||
+        key != pc)
+    {
+        return false;
+    }
+
+    *image_base     = base;
+    *function_entry = function;
+    return true;
+}
+
+static void __vcrt_eh_cache_write(
+    __vcrt_eh_cache_entry* const entry,
+    long                   const generation,
+    ULONG_PTR              const pc,
+    ULONG_PTR              const image_base,
+    PRUNTIME_FUNCTION      const function_entry
+)
+{
+    long const sequence = ReadNoFence(&entry->sequence);
+
+    // Somebody else (another thread that was preempted on this processor, or
+    // one that migrated) is filling this slot; it is only a cache, give up.
+    if ((sequence & 1) || InterlockedCompareExchange(&entry->sequence, sequence + 1, sequence) != sequence)
+    {
+        return;
+    }
+
+    entry->generation     = generation;
+    entry->pc             = pc;
+    entry->image_base     = image_base;
+    entry->function_entry = function_entry;
+
+    WriteRelease(&entry->sequence, sequence + 2);
+}
+
+static __forceinline size_t __vcrt_cast_home(
+    ULONG_PTR const locator,
+    ULONG_PTR const source,
+    ULONG_PTR const target,
+    LONG_PTR  const source_offset
+)
+{
+    // Locators and type descriptors are pointer aligned; the same hierarchy
+    // is usually cast between a few sources and targets, so mix all four.
+    ULONG_PTR const key = (locator >> 3) ^ (source >> 2) ^ (target >> 4) ^ static_cast<ULONG_PTR>(source_offset);
+    return (key ^ (key >> 9)) & (__vcrt_cast_slots - 1);
+}
+
+static void NTAPI __vcrt_eh_cache_load_image_notify(
+    _In_opt_ PUNICODE_STRING /*full_image_name*/,
+    _In_ HANDLE              /*process_id*/,
+    _In_ PIMAGE_INFO         image_info
+)
+{
+    if (image_info->SystemModeImage)
+    {
+        __ucxxrt_flush_eh_cache();
+    }
+}
+
+
+
+extern "C" bool __cdecl __vcrt_initialize_eh_cache()
+{
+    ULONG const processors = KeQueryMaximumProcessorCountEx(ALL_PROCESSOR_GROUPS);
+    SIZE_T const size = static_cast<SIZE_T>(processors) * __vcrt_eh_cache_block_size;
+
+    #pragma warning(suppress: 4996)
+    auto const cache = static_cast<unsigned char*>(ExAllocatePoolWithTag(NonPagedPoolNx, size, __ucxxrt_tag));
+    if (cache == nullptr)
+    {
+        // The cache is an optimization only; run without it.
+        return true;
+    }
+
+    RtlZeroMemory(cache, size);
+
+    if (__ucxxrt_eh_cache_track_images() &&
+        NT_SUCCESS(PsSetLoadImageNotifyRoutine(&__vcrt_eh_cache_load_image_notify)))
+    {
+        __vcrt_eh_cache_tracking = true;
+        __vcrt_eh_cache_low      = 0;
+        __vcrt_eh_cache_span     = ~static_cast<ULONG_PTR>(0);
+    }
+    else
+    {
+        auto const image_base = reinterpret_cast<unsigned char*>(&__ImageBase);
+        auto const nt_header  = reinterpret_cast<PIMAGE_NT_HEADERS>(image_base + __ImageBase.e_lfanew);
+
+        __vcrt_eh_cache_low  = reinterpret_cast<ULONG_PTR>(image_base);
+        __vcrt_eh_cache_span = nt_header->OptionalHeader.SizeOfImage;
+    }
+
+    __vcrt_eh_cache_processors = processors;
+    __vcrt_eh_cache            = cache;
+
+    return true;
+}
+
+extern "C" bool __cdecl __vcrt_uninitialize_eh_cache()
+{
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return true;
+    }
+
+    if (__vcrt_eh_cache_tracking)
+    {
+        PsRemoveLoadImageNotifyRoutine(&__vcrt_eh_cache_load_image_notify);
+        __vcrt_eh_cache_tracking = false;
+    }
+
+    ExFreePoolWithTag(__vcrt_eh_cache, __ucxxrt_tag);
+    __vcrt_eh_cache            = nullptr;
+    __vcrt_eh_cache_processors = 0;
+
+    return true;
+}
+
+extern "C" PRUNTIME_FUNCTION __cdecl __vcrt_lookup_function_entry(
+    _In_  ULONG_PTR  const control_pc,
+    _Out_ PULONG_PTR const image_base
+)
+{
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return RtlLookupFunctionEntry(control_pc, image_base, nullptr);
+    }
+
+    __vcrt_eh_cache_block* const block = __vcrt_eh_cache_current_block();
+
+    if (!__vcrt_eh_cache_keeps(control_pc))
+    {
+        InterlockedIncrementNoFence64(&block->function_entry_misses);
+        return RtlLookupFunctionEntry(control_pc, image_base, nullptr);
+    }
+
+    __vcrt_eh_cache_entry* const entry = __vcrt_eh_cache_slot(block, control_pc);
+
+    ULONG_PTR         cached_base     = 0;
+    PRUNTIME_FUNCTION cached_function = nullptr;
+    if (__vcrt_eh_cache_read(entry, control_pc, &cached_base, &cached_function) && cached_function)
+    {
+        InterlockedIncrementNoFence64(&block->function_entry_hits);
+
+        *image_base = cached_base;
+        return cached_function;
+    }
+
+    InterlockedIncrementNoFence64(&block->function_entry_misses);
+
+    // Sample the generation before the lookup, so a flush racing with it
+    // leaves a stale-tagged entry rather than a stale entry tagged current.
+    long const generation = ReadAcquire(&__vcrt_eh_cache_generation);
+
+    PRUNTIME_FUNCTION const function = RtlLookupFunctionEntry(control_pc, image_base, nullptr);
+    if (function)
+    {
+        __vcrt_eh_cache_write(entry, generation, control_pc, *image_base, function);
+    }
+
+    return function;
+}
+
+extern "C" PVOID __cdecl __vcrt_pc_to_file_header(
+    _In_  PVOID  const pc_value,
+    _Out_ PVOID* const base_of_image
+)
+{
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return RtlPcToFileHeader(pc_value, base_of_image);
+    }
+
+    ULONG_PTR const key = reinterpret_cast<ULONG_PTR>(pc_value);
+    size_t    const home = ((key >> 3) ^ (key >> 12)) & (__vcrt_image_base_slots - 1);
+
+    __vcrt_eh_cache_block* const block = __vcrt_eh_cache_current_block();
+
+    if (!__vcrt_eh_cache_keeps(key))
+    {
+        InterlockedIncrementNoFence64(&block->image_base_misses);
+        return RtlPcToFileHeader(pc_value, base_of_image);
+    }
+
+    long const generation = ReadAcquire(&__vcrt_eh_cache_generation);
+
+    for (size_t i = 0; i < __vcrt_image_base_probes; ++i)
+    {
+        __vcrt_image_base_entry* const entry = &__vcrt_image_base_table[(home + i) & (__vcrt_image_base_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence == 0)
+        {
+            break; // never used, so the key cannot be further along
+        }
+
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        long      const entry_generation = entry->generation;
+        ULONG_PTR const entry_key        = entry->key;
+        ULONG_PTR const entry_base       = entry->image_base;
+
+        __vcrt_eh_cache_load_fence();
+
+        if (ReadNoFence(&entry->sequence) == sequence &&
+            entry_generation == generation &&
+            entry_key == key)
+        {
+            InterlockedIncrementNoFence64(&block->image_base_hits);
+
+            *base_of_image = reinterpret_cast<PVOID>(entry_base);
+            return *base_of_image;
+        }
+    }
+
+    InterlockedIncrementNoFence64(&block->image_base_misses);
+
+    PVOID const base = RtlPcToFileHeader(pc_value, base_of_image);
+    if (base == nullptr)
+    {
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < __vcrt_image_base_probes; ++i)
+    {
+        __vcrt_image_base_entry* const entry = &__vcrt_image_base_table[(home + i) & (__vcrt_image_base_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        if (sequence != 0 && entry->generation == generation)
+        {
+            if (entry->key == key)
+            {
+                break; // another thread got here first
+            }
+
+            continue;
+        }
+
+        // Empty, or left over from an older generation: claim it.
+        if (InterlockedCompareExchange(&entry->sequence, sequence + 1, sequence) != sequence)
+        {
+            continue;
+        }
+
+        entry->generation = generation;
+        entry->key        = key;
+        entry->image_base = reinterpret_cast<ULONG_PTR>(base);
+
+        WriteRelease(&entry->sequence, sequence + 2);
+        break;
+    }
+
+    return base;
+}
+
+extern "C" bool __cdecl __vcrt_lookup_cast(
+    _In_  void const* const locator,
+    _In_  void const* const source,
+    _In_  void const* const target,
+    _In_  ptrdiff_t   const source_offset,
+    _Out_ void**      const base_class,
+    _Out_ long*       const generation
+)
+{
+    *base_class = nullptr;
+    *generation = 0;
+
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return false;
+    }
+
+    ULONG_PTR const key_locator = reinterpret_cast<ULONG_PTR>(locator);
+    ULONG_PTR const key_source  = reinterpret_cast<ULONG_PTR>(source);
+    ULONG_PTR const key_target  = reinterpret_cast<ULONG_PTR>(target);
+
+    size_t const home = __vcrt_cast_home(key_locator, key_source, key_target, source_offset);
+
+    __vcrt_eh_cache_block* const block = __vcrt_eh_cache_current_block();
+
+    if (!__vcrt_eh_cache_keeps(key_locator) ||
+        !__vcrt_eh_cache_keeps(key_source)  ||
+        !__vcrt_eh_cache_keeps(key_target))
+    {
+        InterlockedIncrementNoFence64(&block->cast_misses);
+        return false;
+    }
+
+    // Sample the generation before the walk, see __vcrt_lookup_function_entry.
+    long const current = ReadAcquire(&__vcrt_eh_cache_generation);
+    *generation = current;
+
+    for (size_t i = 0; i < __vcrt_cast_probes; ++i)
+    {
+        __vcrt_cast_entry* const entry = &__vcrt_cast_table[(home + i) & (__vcrt_cast_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence == 0)
+        {
+            break;
+        }
+
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        long      const entry_generation = entry->generation;
+        ULONG_PTR const entry_locator    = entry->locator;
+        ULONG_PTR const entry_source     = entry->source;
+        ULONG_PTR const entry_target     = entry->target;
+        LONG_PTR  const entry_offset     = entry->source_offset;
+        ULONG_PTR const entry_base_class = entry->base_class;
+
+        __vcrt_eh_cache_load_fence();
+
+        if (ReadNoFence(&entry->sequence) == sequence &&
+            entry_generation == current &&
+            entry_locator == key_locator &&
+            entry_source  == key_source  &&
+            entry_target  == key_target  &&
+            entry_offset  == source_offset)
+        {
+            InterlockedIncrementNoFence64(&block->cast_hits);
+
+            *base_class = reinterpret_cast<void*>(entry_base_class);
+            return true;
+        }
+    }
+
+    InterlockedIncrementNoFence64(&block->cast_misses);
+    return false;
+}
+
+extern "C" void __cdecl __vcrt_remember_cast(
+    _In_     void const* const locator,
+    _In_     void const* const source,
+    _In_     void const* const target,
+    _In_     ptrdiff_t   const source_offset,
+    _In_opt_ void*       const base_class,
+    _In_     long        const generation
+)
+{
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return;
+    }
+
+    ULONG_PTR const key_locator = reinterpret_cast<ULONG_PTR>(locator);
+    ULONG_PTR const key_source  = reinterpret_cast<ULONG_PTR>(source);
+    ULONG_PTR const key_target  = reinterpret_cast<ULONG_PTR>(target);
+
+    if (!__vcrt_eh_cache_keeps(key_locator) ||
+        !__vcrt_eh_cache_keeps(key_source)  ||
+        !__vcrt_eh_cache_keeps(key_target))
+    {
+        return;
+    }
+
+    size_t const home = __vcrt_cast_home(key_locator, key_source, key_target, source_offset);
+
+    for (size_t i = 0; i < __vcrt_cast_probes; ++i)
+    {
+        __vcrt_cast_entry* const entry = &__vcrt_cast_table[(home + i) & (__vcrt_cast_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        if (sequence != 0 && entry->generation == generation)
+        {
+            continue; // a live entry; another thread may well hold our key already
+        }
+
+        if (InterlockedCompareExchange(&entry->sequence, sequence + 1, sequence) != sequence)
+        {
+            continue;
+        }
+
+        entry->generation    = generation;
+        entry->locator       = key_locator;
+        entry->source        = key_source;
+        entry->target        = key_target;
+        entry->source_offset = source_offset;
+        entry->base_class    = reinterpret_cast<ULONG_PTR>(base_class);
+
+        WriteRelease(&entry->sequence, sequence + 2);
+        break;
+    }
+}
+
+extern "C" size_t __cdecl __vcrt_type_name_hash(
+    _In_z_    char const* const name,
+    _Out_opt_ size_t*     const length
+)
+{
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return __vcrt_hash_type_name(name, length);
+    }
+
+    ULONG_PTR const key  = reinterpret_cast<ULONG_PTR>(name);
+    size_t    const home = ((key >> 3) ^ (key >> 11)) & (__vcrt_type_name_slots - 1);
+
+    __vcrt_eh_cache_block* const block = __vcrt_eh_cache_current_block();
+
+    if (!__vcrt_eh_cache_keeps(key))
+    {
+        InterlockedIncrementNoFence64(&block->type_name_misses);
+        return __vcrt_hash_type_name(name, length);
+    }
+
+    long const generation = ReadAcquire(&__vcrt_eh_cache_generation);
+
+    for (size_t i = 0; i < __vcrt_type_name_probes; ++i)
+    {
+        __vcrt_type_name_entry* const entry = &__vcrt_type_name_table[(home + i) & (__vcrt_type_name_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence == 0)
+        {
+            break;
+        }
+
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        long          const entry_generation = entry->generation;
+        ULONG_PTR     const entry_key        = entry->key;
+        size_t        const entry_hash       = entry->hash;
+        size_t        const entry_length     = entry->length;
+
+        __vcrt_eh_cache_load_fence();
+
+        if (ReadNoFence(&entry->sequence) == sequence &&
+            entry_generation == generation &&
+            entry_key == key)
+        {
+            InterlockedIncrementNoFence64(&block->type_name_hits);
+
+            if (length)
+            {
+                *length = entry_length;
+            }
+
+            return entry_hash;
+        }
+    }
+
+    InterlockedIncrementNoFence64(&block->type_name_misses);
+
+    size_t       name_length = 0;
+    size_t const hash        = __vcrt_hash_type_name(name, &name_length);
+
+    for (size_t i = 0; i < __vcrt_type_name_probes; ++i)
+    {
+        __vcrt_type_name_entry* const entry = &__vcrt_type_name_table[(home + i) & (__vcrt_type_name_slots - 1)];
+
+        long const sequence = ReadAcquire(&entry->sequence);
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        if (sequence != 0 && entry->generation == generation)
+        {
+            if (entry->key == key)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        if (InterlockedCompareExchange(&entry->sequence, sequence + 1, sequence) != sequence)
+        {
+            continue;
+        }
+
+        entry->generation = generation;
+        entry->key        = key;
+        entry->hash       = hash;
+        entry->length     = name_length;
+
+        WriteRelease(&entry->sequence, sequence + 2);
+        break;
+    }
+
+    if (length)
+    {
+        *length = name_length;
+    }
+
+    return hash;
+}
+
+extern "C" bool __cdecl __vcrt_type_names_equal(
+    _In_z_ char const* const lhs,
+    _In_z_ char const* const rhs
+)
+{
+    if (lhs == rhs)
+    {
+        return true;
+    }
+
+    // A name the cache does not keep would be hashed in full on every call,
+    // where strcmp stops at the first difference
+    if (__vcrt_eh_cache == nullptr ||
+        !__vcrt_eh_cache_keeps(reinterpret_cast<ULONG_PTR>(lhs)) ||
+        !__vcrt_eh_cache_keeps(reinterpret_cast<ULONG_PTR>(rhs)))
+    {
+        return strcmp(lhs, rhs) == 0;
+    }
+
+    size_t lhs_length = 0;
+    size_t rhs_length = 0;
+
+    if (__vcrt_type_name_hash(lhs, &lhs_length) != __vcrt_type_name_hash(rhs, &rhs_length) ||
+        lhs_length != rhs_length)
+    {
+        return false;
+    }
+
+    return memcmp(lhs, rhs, lhs_length) == 0;
+}
+
+extern "C" bool __cdecl __ucxxrt_query_eh_cache_stats(
+    _Out_ __ucxxrt_eh_cache_stats* const stats
+)
+{
+    RtlZeroMemory(stats, sizeof(*stats));
+
+    if (__vcrt_eh_cache == nullptr)
+    {
+        return false;
+    }
+
+    for (ULONG i = 0; i < __vcrt_eh_cache_processors; ++i)
+    {
+        auto const block = reinterpret_cast<__vcrt_eh_cache_block*>(
+            __vcrt_eh_cache + static_cast<size_t>(i) * __vcrt_eh_cache_block_size);
+
+        stats->function_entry_hits   += ReadNoFence64(&block->function_entry_hits);
+        stats->function_entry_misses += ReadNoFence64(&block->function_entry_misses);
+        stats->image_base_hits       += ReadNoFence64(&block->image_base_hits);
+        stats->image_base_misses     += ReadNoFence64(&block->image_base_misses);
+        stats->cast_hits             += ReadNoFence64(&block->cast_hits);
+        stats->cast_misses           += ReadNoFence64(&block->cast_misses);
+        stats->type_name_hits        += ReadNoFence64(&block->type_name_hits);
+        stats->type_name_misses      += ReadNoFence64(&block->type_name_misses);
+    }
+
+    stats->flushes = ReadNoFence64(&__vcrt_eh_cache_flushes);
+    return true;
+}
+
+extern "C" void __cdecl __ucxxrt_flush_eh_cache()
+{
+    InterlockedIncrement(&__vcrt_eh_cache_generation);
+    InterlockedIncrementNoFence64(&__vcrt_eh_cache_flushes);
+}
+
+#else // ^^^ RISC/x64 ^^^ // vvv x86 vvv
+
+extern "C" bool __cdecl __vcrt_type_names_equal(
+    _In_z_ char const* const lhs,
+    _In_z_ char const* const rhs
+)
+{
+    return lhs == rhs || strcmp(lhs, rhs) == 0;
+}
+
+extern "C" bool __cdecl __vcrt_initialize_eh_cache()
+{
+    return true;
+}
+
+extern "C" bool __cdecl __vcrt_uninitialize_eh_cache()
+{
+    return true;
+}
+
+extern "C" bool __cdecl __ucxxrt_query_eh_cache_stats(
+    _Out_ __ucxxrt_eh_cache_stats* const stats
+)
+{
+    RtlZeroMemory(stats, sizeof(*stats));
+    return false;
+}
+
+extern "C" void __cdecl __ucxxrt_flush_eh_cache()
+{
+}
+
+#endif
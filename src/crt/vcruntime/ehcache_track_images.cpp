@@ -0,0 +1,27 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      ehcache_track_images.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// The default __ucxxrt_eh_cache_track_images(), which keeps the EH cache to
+// the driver's own image and leaves the load image notify routines alone.
+// This object is only linked when the driver does not define its own; keep it
+// free of anything else, so that defining one never clashes with it.
+//
+#include <vcruntime.h>
+#include <kext/kehcache.h>
+
+
+
+extern "C" bool __cdecl __ucxxrt_eh_cache_track_images()
+{
+    return false;
+}
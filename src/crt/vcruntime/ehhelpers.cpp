@@ -310,10 +310,10 @@ extern "C" _VCRTIMP int __cdecl _is_exception_typeof(const type_info & type, str
     {
 #if _EH_RELATIVE_TYPEINFO
         pCatchable = (CatchableType *)(imgBase + *ppCatchable);
-        if(strcmp(type.raw_name(), CT_NAME_IB(*pCatchable, imgBase)) == 0)
+        if(__vcrt_type_names_equal(type.raw_name(), CT_NAME_IB(*pCatchable, imgBase)))
 #else
         pCatchable = *ppCatchable;
-        if(strcmp(type.raw_name(), CT_NAME(*pCatchable)) == 0)
+        if(__vcrt_type_names_equal(type.raw_name(), CT_NAME(*pCatchable)))
 #endif
         {
             // Found a Match.
@@ -104,3 +104,22 @@ extern"C" void __cdecl __CxxRaiseException(
     _In_reads_opt_(nNumberOfArguments) CONST ULONG_PTR * lpArguments
 );
 
+//
+// EH telemetry (ehtelemetry.cpp). Each hook costs a single test of
+// __vcrt_eh_telemetry_enabled while telemetry is off.
+//
+
+extern "C" bool volatile __vcrt_eh_telemetry_enabled;
+
+extern "C" void __cdecl __vcrt_eh_telemetry_throw(void* ReturnAddress, void const* ThrowInfo);
+extern "C" void __cdecl __vcrt_eh_telemetry_unwind_frame();
+extern "C" void __cdecl __vcrt_eh_telemetry_destructor();
+extern "C" void __cdecl __vcrt_eh_telemetry_catch_found();
+extern "C" void __cdecl __vcrt_eh_telemetry_catch_entered();
+
+#define _VCRT_EH_TELEMETRY(Event)                                                      \
+    do {                                                                               \
+        if (__vcrt_eh_telemetry_enabled) {                                             \
+            Event;                                                                     \
+        }                                                                              \
+    } while (false)
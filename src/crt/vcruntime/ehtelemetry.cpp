@@ -0,0 +1,468 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      ehtelemetry.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// Optional exception telemetry.  _CxxThrowException, the frame handlers and
+// CxxCallCatchBlock call in here only while __vcrt_eh_telemetry_enabled is
+// set.  Counters live in one block per processor and are summed by the
+// snapshot.  The state of a throw in flight lives in a slot the throw claims
+// for its thread and the catch releases; the hooks find it by hashing the
+// thread, without the PTD lookup and its lock.  A throw from a destructor or
+// catch block while another is in flight restarts the tracking of the outer
+// one.  A throw that no catch block ends, because an __except handler stops
+// it or nothing does, leaves its slot claimed: the thread's next throw
+// reuses it, and once no slot is free a throw takes over the one with the
+// oldest throw.
+//
+#include <vcruntime_internal.h>
+#include <ehdata.h>
+#include <ehhelpers.h>
+#include <kext/kehtelemetry.h>
+
+// Per processor, must be a power of two.
+#define __vcrt_eh_telemetry_sites  64
+#define __vcrt_eh_telemetry_probes 8
+
+// Must be a power of two.  Throws beyond this many in flight at once are
+// counted but not timed.
+#define __vcrt_eh_telemetry_in_flight 64
+
+struct __vcrt_eh_telemetry_site
+{
+    void* volatile              return_address;
+    void const* volatile        throw_info;
+    LONG64 volatile             count;
+};
+
+struct __vcrt_eh_telemetry_block
+{
+    __vcrt_eh_telemetry_site    sites[__vcrt_eh_telemetry_sites];
+
+    LONG64 volatile             throws;
+    LONG64 volatile             catches;
+    LONG64 volatile             frames_unwound;
+    LONG64 volatile             destructors_run;
+    LONG64 volatile             search_ticks;
+    LONG64 volatile             unwind_ticks;
+    LONG64 volatile             dropped_sites;
+    LONG64 volatile             depth_histogram[UCXXRT_EH_DEPTH_BUCKETS];
+};
+
+// Written only by the thread that claimed it; other threads read the
+// throw_timestamp to pick a slot to take over.
+struct __vcrt_eh_telemetry_throw_state
+{
+    void* volatile              thread;
+    long long volatile          throw_timestamp;
+    long long                   catch_timestamp;    // handler found, or 0
+    unsigned int                frames_unwound;
+    unsigned int                destructors_run;
+};
+
+// Keep per-processor blocks on separate cache lines.
+#define __vcrt_eh_telemetry_block_size \
+    ROUND_TO_SIZE(sizeof(__vcrt_eh_telemetry_block), SYSTEM_CACHE_ALIGNMENT_SIZE)
+
+extern "C" bool volatile __vcrt_eh_telemetry_enabled = false;
+
+static unsigned char* volatile  __vcrt_eh_telemetry;
+static ULONG                    __vcrt_eh_telemetry_processors;
+
+static __vcrt_eh_telemetry_throw_state __vcrt_eh_telemetry_throws[__vcrt_eh_telemetry_in_flight];
+
+
+
+static __vcrt_eh_telemetry_block* __vcrt_eh_telemetry_block_of(
+    unsigned char* const blocks,
+    ULONG          const processor
+)
+{
+    return reinterpret_cast<__vcrt_eh_telemetry_block*>(
+        blocks + static_cast<size_t>(processor) * __vcrt_eh_telemetry_block_size);
+}
+
+static __vcrt_eh_telemetry_block* __vcrt_eh_telemetry_current_block()
+{
+    // The enabled flag is set after the blocks are published, but a weakly
+    // ordered processor may still see the flag first.
+    auto const blocks = static_cast<unsigned char*>(
+        ReadPointerAcquire(reinterpret_cast<void* volatile*>(&__vcrt_eh_telemetry)));
+    if (blocks == nullptr)
+    {
+        return nullptr;
+    }
+
+    ULONG processor = KeGetCurrentProcessorNumberEx(nullptr);
+    if (processor >= __vcrt_eh_telemetry_processors)
+    {
+        processor = 0;
+    }
+
+    return __vcrt_eh_telemetry_block_of(blocks, processor);
+}
+
+static size_t __vcrt_eh_telemetry_bucket(unsigned int const frames)
+{
+    // 0, 1, 2, 3-4, 5-8, 9-16, 17-32, 33+
+    size_t bucket = 0;
+    for (unsigned int limit = 1; bucket < UCXXRT_EH_DEPTH_BUCKETS - 1 && frames > (limit >> 1); limit <<= 1)
+    {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+static size_t __vcrt_eh_telemetry_throw_home(void* const thread)
+{
+    // Thread objects are allocated on large boundaries; a Fibonacci hash
+    // spreads them over the table
+    unsigned long long const key = reinterpret_cast<uintptr_t>(thread) >> 4;
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (__vcrt_eh_telemetry_in_flight - 1);
+}
+
+// Returns the throw in flight on this thread, or nullptr if none is tracked.
+static __vcrt_eh_telemetry_throw_state* __vcrt_eh_telemetry_find_throw(void* const thread)
+{
+    size_t const home = __vcrt_eh_telemetry_throw_home(thread);
+
+    for (size_t i = 0; i != __vcrt_eh_telemetry_in_flight; ++i)
+    {
+        __vcrt_eh_telemetry_throw_state* const state =
+            &__vcrt_eh_telemetry_throws[(home + i) & (__vcrt_eh_telemetry_in_flight - 1)];
+        if (ReadPointerNoFence(&state->thread) == thread)
+        {
+            return state;
+        }
+    }
+
+    return nullptr;
+}
+
+static __vcrt_eh_telemetry_throw_state* __vcrt_eh_telemetry_claim_throw(void* const thread)
+{
+    size_t const home = __vcrt_eh_telemetry_throw_home(thread);
+
+    __vcrt_eh_telemetry_throw_state* oldest       = nullptr;
+    void*                            oldest_owner = nullptr;
+
+    for (size_t i = 0; i != __vcrt_eh_telemetry_in_flight; ++i)
+    {
+        __vcrt_eh_telemetry_throw_state* const state =
+            &__vcrt_eh_telemetry_throws[(home + i) & (__vcrt_eh_telemetry_in_flight - 1)];
+
+        void* const owner = ReadPointerNoFence(&state->thread);
+        if (owner == nullptr)
+        {
+            if (InterlockedCompareExchangePointer(&state->thread, thread, nullptr) == nullptr)
+            {
+                return state;
+            }
+
+            continue;
+        }
+
+        if (oldest == nullptr || state->throw_timestamp < oldest->throw_timestamp)
+        {
+            oldest       = state;
+            oldest_owner = owner;
+        }
+    }
+
+    // None is free.  Throws are caught within microseconds, so the oldest is
+    // all but certainly one that no catch block ended; if it is still in
+    // flight after all, its owner just stops timing it.
+    if (oldest && InterlockedCompareExchangePointer(&oldest->thread, thread, oldest_owner) == oldest_owner)
+    {
+        return oldest;
+    }
+
+    return nullptr;
+}
+
+static void __vcrt_eh_telemetry_count_site(
+    __vcrt_eh_telemetry_block* const block,
+    void*                      const return_address,
+    void const*                const throw_info
+)
+{
+    size_t const home = (reinterpret_cast<uintptr_t>(return_address) >> 2) & (__vcrt_eh_telemetry_sites - 1);
+
+    for (size_t i = 0; i < __vcrt_eh_telemetry_probes; ++i)
+    {
+        __vcrt_eh_telemetry_site* const site = &block->sites[(home + i) & (__vcrt_eh_telemetry_sites - 1)];
+
+        void* key = ReadPointerAcquire(&site->return_address);
+        if (key == nullptr)
+        {
+            // Claim it.  A thread that loses the race just keeps probing; at
+            // worst a site ends up in two slots, which the snapshot merges.
+            key = InterlockedCompareExchangePointer(&site->return_address, return_address, nullptr);
+            if (key == nullptr)
+            {
+                WritePointerRelease(const_cast<void* volatile*>(&site->throw_info), const_cast<void*>(throw_info));
+                InterlockedIncrementNoFence64(&site->count);
+                return;
+            }
+        }
+
+        if (key == return_address && ReadPointerAcquire(const_cast<void* volatile*>(&site->throw_info)) == throw_info)
+        {
+            InterlockedIncrementNoFence64(&site->count);
+            return;
+        }
+    }
+
+    InterlockedIncrementNoFence64(&block->dropped_sites);
+}
+
+
+
+extern "C" bool __cdecl __vcrt_initialize_eh_telemetry()
+{
+    return true;
+}
+
+extern "C" bool __cdecl __vcrt_uninitialize_eh_telemetry()
+{
+    __vcrt_eh_telemetry_enabled = false;
+
+    if (__vcrt_eh_telemetry)
+    {
+        ExFreePoolWithTag(__vcrt_eh_telemetry, __ucxxrt_tag);
+        __vcrt_eh_telemetry = nullptr;
+    }
+
+    return true;
+}
+
+extern "C" void __cdecl __vcrt_eh_telemetry_throw(
+    void*       const return_address,
+    void const* const throw_info
+)
+{
+    __vcrt_eh_telemetry_block* const block = __vcrt_eh_telemetry_current_block();
+    if (block == nullptr)
+    {
+        return;
+    }
+
+    InterlockedIncrementNoFence64(&block->throws);
+    __vcrt_eh_telemetry_count_site(block, return_address, throw_info);
+
+    void* const thread = KeGetCurrentThread();
+
+    __vcrt_eh_telemetry_throw_state* state = __vcrt_eh_telemetry_find_throw(thread);
+    if (state == nullptr)
+    {
+        state = __vcrt_eh_telemetry_claim_throw(thread);
+    }
+
+    if (state)
+    {
+        state->throw_timestamp = KeQueryPerformanceCounter(nullptr).QuadPart;
+        state->catch_timestamp = 0;
+        state->frames_unwound  = 0;
+        state->destructors_run = 0;
+    }
+}
+
+extern "C" void __cdecl __vcrt_eh_telemetry_unwind_frame()
+{
+    __vcrt_eh_telemetry_throw_state* const state = __vcrt_eh_telemetry_find_throw(KeGetCurrentThread());
+    if (state)
+    {
+        ++state->frames_unwound;
+    }
+}
+
+extern "C" void __cdecl __vcrt_eh_telemetry_destructor()
+{
+    __vcrt_eh_telemetry_throw_state* const state = __vcrt_eh_telemetry_find_throw(KeGetCurrentThread());
+    if (state)
+    {
+        ++state->destructors_run;
+    }
+}
+
+extern "C" void __cdecl __vcrt_eh_telemetry_catch_found()
+{
+    __vcrt_eh_telemetry_throw_state* const state = __vcrt_eh_telemetry_find_throw(KeGetCurrentThread());
+    if (state && state->catch_timestamp == 0)
+    {
+        state->catch_timestamp = KeQueryPerformanceCounter(nullptr).QuadPart;
+    }
+}
+
+extern "C" void __cdecl __vcrt_eh_telemetry_catch_entered()
+{
+    void* const thread = KeGetCurrentThread();
+
+    __vcrt_eh_telemetry_throw_state* const state = __vcrt_eh_telemetry_find_throw(thread);
+    if (state == nullptr)
+    {
+        return;
+    }
+
+    long long const now   = KeQueryPerformanceCounter(nullptr).QuadPart;
+    long long const found = state->catch_timestamp ? state->catch_timestamp : now;
+
+    __vcrt_eh_telemetry_block* const block = __vcrt_eh_telemetry_current_block();
+    if (block)
+    {
+        InterlockedIncrementNoFence64(&block->catches);
+        InterlockedAddNoFence64(&block->frames_unwound,  state->frames_unwound);
+        InterlockedAddNoFence64(&block->destructors_run, state->destructors_run);
+        InterlockedAddNoFence64(&block->search_ticks,    found - state->throw_timestamp);
+        InterlockedAddNoFence64(&block->unwind_ticks,    now - found);
+        InterlockedIncrementNoFence64(&block->depth_histogram[__vcrt_eh_telemetry_bucket(state->frames_unwound)]);
+    }
+
+    // Unless another throw has taken the slot over in the meantime
+    InterlockedCompareExchangePointer(&state->thread, nullptr, thread);
+}
+
+extern "C" bool __cdecl __ucxxrt_eh_telemetry_enable(
+    _In_ bool const enable
+)
+{
+    if (!enable)
+    {
+        __vcrt_eh_telemetry_enabled = false;
+        return true;
+    }
+
+    if (__vcrt_eh_telemetry == nullptr)
+    {
+        ULONG  const processors = KeQueryMaximumProcessorCountEx(ALL_PROCESSOR_GROUPS);
+        SIZE_T const size       = static_cast<SIZE_T>(processors) * __vcrt_eh_telemetry_block_size;
+
+        #pragma warning(suppress: 4996)
+        auto const blocks = static_cast<unsigned char*>(ExAllocatePoolWithTag(NonPagedPoolNx, size, __ucxxrt_tag));
+        if (blocks == nullptr)
+        {
+            return false;
+        }
+
+        RtlZeroMemory(blocks, size);
+
+        // Two callers may race to enable; the loser frees its copy.
+        __vcrt_eh_telemetry_processors = processors;
+        if (InterlockedCompareExchangePointer(
+            reinterpret_cast<void* volatile*>(&__vcrt_eh_telemetry), blocks, nullptr) != nullptr)
+        {
+            ExFreePoolWithTag(blocks, __ucxxrt_tag);
+        }
+    }
+
+    __vcrt_eh_telemetry_enabled = true;
+    return true;
+}
+
+extern "C" bool __cdecl __ucxxrt_eh_telemetry_snapshot(
+    _Out_ __ucxxrt_eh_telemetry* const telemetry,
+    _Out_writes_to_opt_(capacity, *count) __ucxxrt_eh_throw_site* const sites,
+    _In_ size_t const capacity,
+    _Out_opt_ size_t* const count
+)
+{
+    RtlZeroMemory(telemetry, sizeof(*telemetry));
+    if (count)
+    {
+        *count = 0;
+    }
+
+    if (__vcrt_eh_telemetry == nullptr)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER frequency{};
+    KeQueryPerformanceCounter(&frequency);
+    telemetry->tick_frequency = static_cast<unsigned long long>(frequency.QuadPart);
+
+    size_t written = 0;
+
+    for (ULONG i = 0; i < __vcrt_eh_telemetry_processors; ++i)
+    {
+        __vcrt_eh_telemetry_block* const block = __vcrt_eh_telemetry_block_of(__vcrt_eh_telemetry, i);
+
+        telemetry->throws          += ReadNoFence64(&block->throws);
+        telemetry->catches         += ReadNoFence64(&block->catches);
+        telemetry->frames_unwound  += ReadNoFence64(&block->frames_unwound);
+        telemetry->destructors_run += ReadNoFence64(&block->destructors_run);
+        telemetry->search_ticks    += ReadNoFence64(&block->search_ticks);
+        telemetry->unwind_ticks    += ReadNoFence64(&block->unwind_ticks);
+        telemetry->dropped_sites   += ReadNoFence64(&block->dropped_sites);
+
+        for (size_t bucket = 0; bucket < UCXXRT_EH_DEPTH_BUCKETS; ++bucket)
+        {
+            telemetry->depth_histogram[bucket] += ReadNoFence64(&block->depth_histogram[bucket]);
+        }
+
+        if (sites == nullptr)
+        {
+            continue;
+        }
+
+        for (auto& site : block->sites)
+        {
+            void*       const return_address = ReadPointerAcquire(&site.return_address);
+            void const* const throw_info     = ReadPointerAcquire(const_cast<void* volatile*>(&site.throw_info));
+            LONG64      const site_count     = ReadNoFence64(&site.count);
+
+            if (return_address == nullptr || site_count == 0)
+            {
+                continue;
+            }
+
+            size_t j = 0;
+            while (j < written && (sites[j].return_address != return_address || sites[j].throw_info != throw_info))
+            {
+                ++j;
+            }
+
+            if (j == written)
+            {
+                if (written == capacity)
+                {
+                    continue;
+                }
+
+                sites[written++] = { return_address, throw_info, 0 };
+            }
+
+            sites[j].count += static_cast<unsigned long long>(site_count);
+        }
+    }
+
+    // Most frequent first; the list is short, so insertion sort will do.
+    for (size_t i = 1; i < written; ++i)
+    {
+        __ucxxrt_eh_throw_site const site = sites[i];
+
+        size_t j = i;
+        for (; j > 0 && sites[j - 1].count < site.count; --j)
+        {
+            sites[j] = sites[j - 1];
+        }
+
+        sites[j] = site;
+    }
+
+    if (count)
+    {
+        *count = written;
+    }
+
+    return true;
+}
@@ -328,6 +328,8 @@ EXCEPTION_DISPOSITION __InternalCxxFrameHandler(
             // Only unwind if there's something to unwind
             // AND we're being called through the primary RN.
 
+            _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_unwind_frame());
+
 #if _EH_RELATIVE_FUNCINFO
             if (IS_TARGET_UNWIND(PER_FLAGS(pExcept)) && PER_CODE(pExcept) == STATUS_LONGJUMP) {
                     __ehstate_t target_state = T::StateFromIp(
@@ -1051,7 +1053,7 @@ int TypeMatchHelper(
     // Not ellipsis; the basic types match if it's the same record *or* the
     // names are identical.
     if (HT_PTD(*pCatch) != CT_PTD(*pCatchable)
-        && strcmp(HT_NAME(*pCatch), CT_NAME(*pCatchable)) != 0) {
+        && !__vcrt_type_names_equal(HT_NAME(*pCatch), CT_NAME(*pCatchable))) {
         return FALSE;
     }
 
@@ -1182,6 +1184,7 @@ void RENAME_EH_EXTERN(__FrameHandler4)::FrameUnwindToState(
 #endif // _EH_RELATIVE_FUNCINFO
 
                 EHTRACE_FMT2("Unwind from state %d to state %d\n", prevState, curState);
+                _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_destructor());
                 __try {
                     // Call the unwind action (if one exists):
                     if ((UWEntry.type == UnwindMapEntry4::Type::DtorWithObj) || (UWEntry.type == UnwindMapEntry4::Type::DtorWithPtrToObj))
@@ -1272,6 +1275,7 @@ void RENAME_EH_EXTERN(__FrameHandler3)::FrameUnwindToState(
                 SetState(pRN, pFuncInfo, nxtState);
 
                 EHTRACE_FMT2("Unwind from state %d to state %d", curState, nxtState);
+                _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_destructor());
 
 #if defined(_M_ARM64EC)
                 if (RtlIsEcCode((ULONG64)UWE_ACTION(FUNC_UNWIND(*pFuncInfo, curState)))) {
@@ -1367,6 +1371,8 @@ static void CatchIt(
 
     EHTRACE_FMT1("Catching object @ 0x%p", PER_PEXCEPTOBJ(pExcept));
 
+    _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_catch_found());
+
     EHRegistrationNode *pEstablisher = pRN;
 
 #if _EH_RELATIVE_FUNCINFO
@@ -1421,6 +1427,8 @@ static void CatchIt(
     EHTRACE_FMT2("Move from state %d to state %d", T::GetCurrentState(pRN, pDC, pFuncInfo), TBME_HIGH(*pEntry) + 1);
     T::SetState(pRN, pFuncInfo, TBME_HIGH(*pEntry) + 1);
 
+    _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_catch_entered());
+
     continuationAddress = CallCatchBlock(pExcept,
         pEstablisher,
         pContext,
@@ -1484,6 +1492,8 @@ void * RENAME_EH_EXTERN(__FrameHandler4)::CxxCallCatchBlock(
 
     __except_validate_context_record(pContext);
 
+    _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_catch_entered());
+
     _pCurrentException = pThisException;
     _pCurrentExContext = pContext;
     FRAMEINFO *pFrameInfo = RENAME_EH_EXTERN(_CreateFrameInfo)(&FrameInfo,
@@ -1598,6 +1608,8 @@ void * RENAME_EH_EXTERN(__FrameHandler3)::CxxCallCatchBlock(
 
     __except_validate_context_record(pContext);
 
+    _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_catch_entered());
+
     _pCurrentException  = pThisException;
     _pCurrentExContext = pContext;
     FRAMEINFO *pFrameInfo = RENAME_EH_EXTERN(_CreateFrameInfo)(&FrameInfo,
@@ -9,21 +9,47 @@
 // VCRuntime library, these are called by the initialization code.
 //
 #include <vcruntime_internal.h>
+#include <kext/kstartup.h>
 
 extern "C" {
 
 bool __cdecl __vcrt_initialize()
 {
+    // Cannot fail, and holds nothing that needs to be released.
+    if (!__vcrt_initialize_thread_safe_statics())
+    {
+        return false;
+    }
+
+    LONGLONG phase_start = __scrt_startup_phase_begin();
     if (!__vcrt_initialize_locks())
     {
         return false;
     }
+    __scrt_startup_phase_end(__ucxxrt_phase_initialize_locks, phase_start);
 
+    phase_start = __scrt_startup_phase_begin();
     if (!__vcrt_initialize_ptd())
     {
         __vcrt_uninitialize_locks();
         return false;
     }
+    __scrt_startup_phase_end(__ucxxrt_phase_initialize_ptd, phase_start);
+
+    if (!__vcrt_initialize_eh_cache())
+    {
+        __vcrt_uninitialize_ptd();
+        __vcrt_uninitialize_locks();
+        return false;
+    }
+
+    if (!__vcrt_initialize_eh_telemetry())
+    {
+        __vcrt_uninitialize_eh_cache();
+        __vcrt_uninitialize_ptd();
+        __vcrt_uninitialize_locks();
+        return false;
+    }
 
     return true;
 }
@@ -32,6 +58,9 @@ bool __cdecl __vcrt_uninitialize(_In_ bool const terminating)
 {
     UNREFERENCED_PARAMETER(terminating);
 
+    __std_type_info_destroy_list(&__type_info_root_node);
+    __vcrt_uninitialize_eh_telemetry();
+    __vcrt_uninitialize_eh_cache();
     __vcrt_uninitialize_ptd();
     __vcrt_uninitialize_locks();
 
@@ -29,11 +29,17 @@
 //  XCU "user" inits
 //  XCZ used here, for end marker
 //
+// The parallel initializers of kext/kinitializer.h sort after XCZ, so that
+// _initterm never sees them: XCZPA and XCZPZ are the markers used here, and
+// the entries go in XCZPU.
+//
 
 extern "C" _CRTALLOC(".CRT$XIA") _PIFV __xi_a[] = { nullptr }; // C initializers (first)
 extern "C" _CRTALLOC(".CRT$XIZ") _PIFV __xi_z[] = { nullptr }; // C initializers (last)
 extern "C" _CRTALLOC(".CRT$XCA") _PVFV __xc_a[] = { nullptr }; // C++ initializers (first)
 extern "C" _CRTALLOC(".CRT$XCZ") _PVFV __xc_z[] = { nullptr }; // C++ initializers (last)
+extern "C" _CRTALLOC(".CRT$XCZPA") __ucxxrt_parallel_initializer const* const __xcp_a[] = { nullptr }; // Parallel C++ initializers (first)
+extern "C" _CRTALLOC(".CRT$XCZPZ") __ucxxrt_parallel_initializer const* const __xcp_z[] = { nullptr }; // Parallel C++ initializers (last)
 extern "C" _CRTALLOC(".CRT$XPA") _PVFV __xp_a[] = { nullptr }; // C pre-terminators (first)
 extern "C" _CRTALLOC(".CRT$XPZ") _PVFV __xp_z[] = { nullptr }; // C pre-terminators (last)
 extern "C" _CRTALLOC(".CRT$XTA") _PVFV __xt_a[] = { nullptr }; // C terminators (first)
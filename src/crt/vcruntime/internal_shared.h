@@ -105,6 +105,9 @@ extern IMAGE_DOS_HEADER     __ImageBase;
 #pragma section(".CRT$XCA",    long, read) // First C++ Initializer
 #pragma section(".CRT$XCAA",   long, read) // Startup C++ Initializer
 #pragma section(".CRT$XCZ",    long, read) // Last C++ Initializer
+#pragma section(".CRT$XCZPA",  long, read) // First Parallel C++ Initializer
+#pragma section(".CRT$XCZPU",  long, read) // Parallel C++ Initializers
+#pragma section(".CRT$XCZPZ",  long, read) // Last Parallel C++ Initializer
 
 #pragma section(".CRT$XDA",    long, read) // First Dynamic TLS Initializer
 #pragma section(".CRT$XDZ",    long, read) // Last Dynamic TLS Initializer
@@ -122,9 +122,8 @@ EHRegistrationNode * RENAME_EH_EXTERN(__FrameHandler3)::GetEstablisherFrame(
         pEntry = FUNC_PTRYBLOCK(*pFuncInfo, index -1, pDC->ImageBase);
         if (curState > TBME_HIGH(*pEntry) && curState <= TBME_CATCHHIGH(*pEntry)) {
             // Get catch handler address.
-            HandlerAdd = (*RENAME_EH_EXTERN(RtlLookupFunctionEntry)(pDC->ControlPc,
-                                                                    &ImageBase,
-                                                                    nullptr)).BeginAddress;
+            HandlerAdd = (*__vcrt_lookup_function_entry(pDC->ControlPc,
+                                                        &ImageBase)).BeginAddress;
             pHandler = TBME_PLIST(*pEntry, ImageBase);
             for ( i = 0;
                   i < (unsigned)TBME_NCATCHES(*pEntry) &&
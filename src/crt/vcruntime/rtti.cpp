@@ -13,6 +13,7 @@
 #endif // _M_CEE_PURE
 
 #define _RTTI 1 // assume EH structures have RTTI turned on even though this TU may not
+#include <vcruntime_internal.h>
 #include <ehdata.h>
 #include <rttidata.h>
 #include <vcruntime_typeinfo.h>
@@ -23,14 +24,14 @@ typedef TypeDescriptor _RTTITypeDescriptor;
 
 static bool TypeidsEqual(const _RTTITypeDescriptor* const lhs, const _RTTITypeDescriptor* const rhs) noexcept
 {
-    return lhs == rhs || !strcmp(lhs->name, rhs->name);
+    return __vcrt_type_names_equal(lhs->name, rhs->name);
 }
 
 #if _RTTI_RELATIVE_TYPEINFO
 static inline uintptr_t GetImageBase(const void * pCallerPC)
 {
     void * _ImageBase;
-    _ImageBase = RtlPcToFileHeader(
+    _ImageBase = __vcrt_pc_to_file_header(
         const_cast<void *>(pCallerPC),
         &_ImageBase);
     return reinterpret_cast<uintptr_t>(_ImageBase);
@@ -225,8 +226,39 @@ extern "C" void * __CLRCALL_OR_CDECL __RTDynamicCast (
         const auto _ImageBase = GetImageBaseFromCompleteObjectLocator(pCompleteLocator);
 #endif
 
+        const auto attributes = COL_PCHD(*pCompleteLocator)->attributes;
+
+        // Offset of source object in complete object, only needed (and only
+        // meaningful) with multiple inheritance
+        ptrdiff_t inptr_delta = 0;
+        if (attributes & CHD_MULTINH)
+        {
+            // Adjust by vfptr displacement, if any
+            inptr = ((char *)inptr - VfDelta);
+
+            inptr_delta = (char *)inptr - (char *)pCompleteObject;
+        }
+
         _RTTIBaseClassDescriptor* pBaseClass;
-        if (!(COL_PCHD(*pCompleteLocator)->attributes & CHD_MULTINH))
+
+#if _RTTI_RELATIVE_TYPEINFO
+        // The walk below depends only on the hierarchy described by the
+        // locator and on where the source sits in it, so its outcome can be
+        // remembered.  An object under construction with a construction
+        // displacement may not match its locator's layout; leave those alone.
+        const bool cacheable = pCompleteLocator->cdOffset == 0;
+
+        long cacheGeneration = 0;
+        void * pCachedBaseClass = nullptr;
+        const bool cacheHit = cacheable && __vcrt_lookup_cast(pCompleteLocator, srcType, targetType,
+                                                              inptr_delta, &pCachedBaseClass, &cacheGeneration);
+        if (cacheHit)
+        {
+            pBaseClass = static_cast<_RTTIBaseClassDescriptor *>(pCachedBaseClass);
+        }
+        else
+#endif
+        if (!(attributes & CHD_MULTINH))
         {
             // if not multiple inheritance
             pBaseClass = FindSITargetTypeInstance(
@@ -236,39 +268,38 @@ extern "C" void * __CLRCALL_OR_CDECL __RTDynamicCast (
                             IMAGEBASE_ARGUMENT
                             );
         }
+        else if (!(attributes & CHD_VIRTINH))
+        {
+            // if multiple, but not virtual, inheritance
+            pBaseClass = FindMITargetTypeInstance(
+                            pCompleteObject,
+                            pCompleteLocator,
+                            srcType,
+                            inptr_delta,
+                            targetType
+                            IMAGEBASE_ARGUMENT
+                            );
+        }
         else
         {
-            // Adjust by vfptr displacement, if any
-            inptr = ((char *)inptr - VfDelta);
-
-            // Calculate offset of source object in complete object
-            ptrdiff_t inptr_delta = (char *)inptr - (char *)pCompleteObject;
+            // if virtual inheritance
+            pBaseClass = FindVITargetTypeInstance(
+                            pCompleteObject,
+                            pCompleteLocator,
+                            srcType,
+                            inptr_delta,
+                            targetType
+                            IMAGEBASE_ARGUMENT
+                            );
+        }
 
-            if (!(COL_PCHD(*pCompleteLocator)->attributes & CHD_VIRTINH))
-            {
-                // if multiple, but not virtual, inheritance
-                pBaseClass = FindMITargetTypeInstance(
-                                pCompleteObject,
-                                pCompleteLocator,
-                                srcType,
-                                inptr_delta,
-                                targetType
-                                IMAGEBASE_ARGUMENT
-                                );
-            }
-            else
-            {
-                // if virtual inheritance
-                pBaseClass = FindVITargetTypeInstance(
-                                pCompleteObject,
-                                pCompleteLocator,
-                                srcType,
-                                inptr_delta,
-                                targetType
-                                IMAGEBASE_ARGUMENT
-                                );
-            }
+#if _RTTI_RELATIVE_TYPEINFO
+        if (cacheable && !cacheHit)
+        {
+            __vcrt_remember_cast(pCompleteLocator, srcType, targetType, inptr_delta,
+                                 pBaseClass, cacheGeneration);
         }
+#endif
 
         if (pBaseClass == nullptr)
         {
@@ -421,12 +452,12 @@ static _RTTIBaseClassDescriptor * FindSITargetTypeInstance (
     }
 
 
-    // Same as loop above, but falling back to strcmp in case pCOLocator comes
-    // from a different image than pSrcTypeID / pTargetTypeID
+    // Same as loop above, but comparing names in case pCOLocator comes from a
+    // different image than pSrcTypeID / pTargetTypeID
     for (DWORD i = 0; i < nCompleteObjectBases; i++)
     {
         _RTTIBaseClassDescriptor * pBCD = CHD_PBCD(pBaseClassArray->arrayOfBaseClassDescriptors[i]);
-        if (!strcmp(BCD_PTD(*pBCD)->name, pTargetTypeID->name))
+        if (__vcrt_type_names_equal(BCD_PTD(*pBCD)->name, pTargetTypeID->name))
         {
             for (DWORD j = i + 1; j < nCompleteObjectBases; j++)
             {
@@ -436,7 +467,7 @@ static _RTTIBaseClassDescriptor * FindSITargetTypeInstance (
                     return nullptr;
                 }
 
-                if (!strcmp(BCD_PTD(*pSourceBCD)->name, pSrcTypeID->name))
+                if (__vcrt_type_names_equal(BCD_PTD(*pSourceBCD)->name, pSrcTypeID->name))
                 {
                     return pBCD;
                 }
@@ -0,0 +1,250 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      startup_timing.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// Startup and shutdown timing (kext/kstartup.h).  The mode is read once, at
+// the top of DriverEntry; while it is off, every phase timer and the
+// initializer loops cost one test of __scrt_startup_timing.  Each step is
+// bracketed by __scrt_startup_phase_begin and __scrt_startup_phase_end, since
+// __try blocks rule out timer objects with destructors.  Initializer
+// records live in one block sized, before the first initializer runs, for
+// every entry in the .CRT initializer sections; the parallel initializers
+// claim slots with an interlocked increment.
+//
+#include <vcstartup_internal.h>
+#include <vcruntime_internal.h>
+#include <kext/kstartup.h>
+#include <stdlib.h>
+
+extern "C" bool __scrt_startup_timing = false;
+
+static int                          __scrt_startup_timing_mode;
+static LONGLONG                     __scrt_startup_frequency;
+static LONGLONG                     __scrt_startup_ticks[__ucxxrt_phase_count];
+static __ucxxrt_initializer_timing* __scrt_initializer_records;
+static size_t                       __scrt_initializer_capacity;
+static long volatile                __scrt_initializer_count;
+
+static char const* const __scrt_startup_phase_names[__ucxxrt_phase_count] =
+{
+    "__scrt_initialize_crt",
+    "  __vcrt_initialize_locks",
+    "  __vcrt_initialize_ptd",
+    "  __acrt_initialize",
+    "_initterm_e",
+    "_initterm",
+    "_initterm_parallel",
+    "DriverMain",
+    "DriverUnload",
+    "_cexit",
+    "__scrt_uninitialize_crt",
+};
+
+
+
+template <typename Entry>
+static size_t __cdecl __scrt_count_entries(Entry const* first, Entry const* const last)
+{
+    size_t count = 0;
+    for (; first != last; ++first)
+    {
+        if (*first != nullptr)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+static void __cdecl __scrt_reserve_initializer_records()
+{
+    if (__scrt_initializer_records != nullptr)
+    {
+        return;
+    }
+
+    size_t const capacity =
+        __scrt_count_entries(__xi_a, __xi_z) +
+        __scrt_count_entries(__xc_a, __xc_z) +
+        __scrt_count_entries(__xcp_a, __xcp_z);
+
+    // Without memory the phases are still timed
+    __scrt_initializer_records  = _calloc_crt_t(__ucxxrt_initializer_timing, capacity + 1).detach();
+    __scrt_initializer_capacity = __scrt_initializer_records ? capacity : 0;
+}
+
+static unsigned long long __cdecl __scrt_ticks_to(LONGLONG const ticks, LONGLONG const units_per_second)
+{
+    return static_cast<unsigned long long>(ticks) * units_per_second / __scrt_startup_frequency;
+}
+
+static void __cdecl __scrt_print_phases(int const first, int const last)
+{
+    for (int phase = first; phase != last; ++phase)
+    {
+        DbgPrintEx(DPFLTR_DEFAULT_ID, DPFLTR_ERROR_LEVEL, "ucxxrt: %-26s %10llu us\n",
+            __scrt_startup_phase_names[phase], __scrt_ticks_to(__scrt_startup_ticks[phase], 1000000));
+    }
+}
+
+
+
+extern "C" void __cdecl __scrt_initialize_startup_timing()
+{
+    __scrt_startup_timing_mode = __ucxxrt_startup_timing_mode();
+    if (__scrt_startup_timing_mode == UCXXRT_STARTUP_TIMING_OFF)
+    {
+        return;
+    }
+
+    LARGE_INTEGER frequency;
+    KeQueryPerformanceCounter(&frequency);
+    __scrt_startup_frequency = frequency.QuadPart;
+    __scrt_startup_timing    = true;
+}
+
+extern "C" void __cdecl __scrt_record_startup_phase(int const phase, LONGLONG const start)
+{
+    __scrt_startup_ticks[phase] = KeQueryPerformanceCounter(nullptr).QuadPart - start;
+}
+
+extern "C" void __cdecl __scrt_record_initializer(void const* const function, LONGLONG const start)
+{
+    LONGLONG const ticks = KeQueryPerformanceCounter(nullptr).QuadPart - start;
+
+    size_t const index = static_cast<size_t>(_InterlockedIncrement(&__scrt_initializer_count) - 1);
+    if (index < __scrt_initializer_capacity)
+    {
+        __scrt_initializer_records[index].function = function;
+        __scrt_initializer_records[index].ticks    = static_cast<unsigned long long>(ticks);
+    }
+}
+
+// _initterm_e and _initterm, timing each initializer when timing is on.
+extern "C" int __cdecl __scrt_initterm_e(_PIFV* const first, _PIFV* const last)
+{
+    if (!__scrt_startup_timing)
+    {
+        return _initterm_e(first, last);
+    }
+
+    __scrt_reserve_initializer_records();
+
+    for (_PIFV* it = first; it != last; ++it)
+    {
+        if (*it == nullptr)
+            continue;
+
+        LONGLONG const start = KeQueryPerformanceCounter(nullptr).QuadPart;
+        int const result = (**it)();
+        __scrt_record_initializer(reinterpret_cast<void const*>(*it), start);
+
+        if (result != 0)
+            return result;
+    }
+
+    return 0;
+}
+
+extern "C" void __cdecl __scrt_initterm(_PVFV* const first, _PVFV* const last)
+{
+    if (!__scrt_startup_timing)
+    {
+        return _initterm(first, last);
+    }
+
+    __scrt_reserve_initializer_records();
+
+    for (_PVFV* it = first; it != last; ++it)
+    {
+        if (*it == nullptr)
+            continue;
+
+        LONGLONG const start = KeQueryPerformanceCounter(nullptr).QuadPart;
+        (**it)();
+        __scrt_record_initializer(reinterpret_cast<void const*>(*it), start);
+    }
+}
+
+// Called at the end of DriverEntry, whatever DriverMain returned.
+extern "C" void __cdecl __scrt_report_startup_timing()
+{
+    if (__scrt_startup_timing_mode != UCXXRT_STARTUP_TIMING_PRINT)
+    {
+        return;
+    }
+
+    __scrt_print_phases(__ucxxrt_phase_initialize_crt, __ucxxrt_phase_driver_unload);
+
+    size_t const count = __min(static_cast<size_t>(__scrt_initializer_count), __scrt_initializer_capacity);
+    for (size_t i = 0; i != count; ++i)
+    {
+        DbgPrintEx(DPFLTR_DEFAULT_ID, DPFLTR_ERROR_LEVEL, "ucxxrt:   initializer %p %10llu ns\n",
+            __scrt_initializer_records[i].function,
+            __scrt_ticks_to(static_cast<LONGLONG>(__scrt_initializer_records[i].ticks), 1000000000));
+    }
+}
+
+// Called last on unload, and when DriverMain fails, once the CRT has been
+// uninitialized.
+extern "C" void __cdecl __scrt_finish_startup_timing()
+{
+    if (__scrt_startup_timing_mode == UCXXRT_STARTUP_TIMING_PRINT)
+    {
+        __scrt_print_phases(__ucxxrt_phase_driver_unload, __ucxxrt_phase_count);
+    }
+
+    __scrt_startup_timing = false;
+    __scrt_initializer_capacity = 0;
+
+    _free_crt(__scrt_initializer_records);
+    __scrt_initializer_records = nullptr;
+}
+
+
+
+extern "C" bool __cdecl __ucxxrt_query_startup_timing(__ucxxrt_startup_timing* const timing)
+{
+    if (!__scrt_startup_timing)
+    {
+        return false;
+    }
+
+    timing->frequency = static_cast<unsigned long long>(__scrt_startup_frequency);
+    for (int phase = 0; phase != __ucxxrt_phase_count; ++phase)
+    {
+        timing->ticks[phase] = static_cast<unsigned long long>(__scrt_startup_ticks[phase]);
+    }
+    timing->initializers = __min(static_cast<size_t>(__scrt_initializer_count), __scrt_initializer_capacity);
+
+    return true;
+}
+
+extern "C" size_t __cdecl __ucxxrt_query_initializer_timing(
+    __ucxxrt_initializer_timing* const records,
+    size_t                       const capacity
+    )
+{
+    if (!__scrt_startup_timing)
+    {
+        return 0;
+    }
+
+    size_t const count = __min(__min(static_cast<size_t>(__scrt_initializer_count), __scrt_initializer_capacity), capacity);
+    for (size_t i = 0; i != count; ++i)
+    {
+        records[i] = __scrt_initializer_records[i];
+    }
+
+    return count;
+}
@@ -0,0 +1,26 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      startup_timing_mode.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// The default __ucxxrt_startup_timing_mode(), which leaves startup timing off.
+// This object is only linked when the driver does not define its own; keep it
+// free of anything else, so that defining one never clashes with it.
+//
+#include <vcruntime.h>
+#include <kext/kstartup.h>
+
+
+
+extern "C" int __cdecl __ucxxrt_startup_timing_mode()
+{
+    return UCXXRT_STARTUP_TIMING_OFF;
+}
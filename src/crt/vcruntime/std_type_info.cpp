@@ -15,6 +15,113 @@
 
 
 
+// Hash of a decorated name, 16 bytes per step.  Each step folds the full
+// 128-bit product of two 64-bit words, so every input bit reaches every output
+// bit within a couple of steps; the tail is read as (possibly overlapping)
+// words rather than byte by byte.  Decorated names of templates run to a few
+// hundred bytes, so this matters more than the setup cost.  The value is only
+// stable within a build, which is all std::type_info::hash promises.
+
+static unsigned long long const __vcrt_type_hash_seed0 = 0xa0761d6478bd642fULL;
+static unsigned long long const __vcrt_type_hash_seed1 = 0xe7037ed1a0b428dbULL;
+
+static __forceinline unsigned long long __vcrt_type_hash_mix(
+    unsigned long long const a,
+    unsigned long long const b
+    )
+{
+    #if defined _M_X64
+    unsigned long long high;
+    unsigned long long const low = _umul128(a, b, &high);
+    return low ^ high;
+    #elif defined _M_ARM64
+    return (a * b) ^ __umulh(a, b);
+    #else
+    unsigned long long const a_low  = a & 0xffffffff;
+    unsigned long long const a_high = a >> 32;
+    unsigned long long const b_low  = b & 0xffffffff;
+    unsigned long long const b_high = b >> 32;
+
+    unsigned long long const low_low   = a_low  * b_low;
+    unsigned long long const high_low  = a_high * b_low;
+    unsigned long long const low_high  = a_low  * b_high;
+    unsigned long long const high_high = a_high * b_high;
+
+    unsigned long long const middle = (low_low >> 32) + (high_low & 0xffffffff) + low_high;
+    unsigned long long const low    = (middle << 32) | (low_low & 0xffffffff);
+    unsigned long long const high   = high_high + (high_low >> 32) + (middle >> 32);
+    return low ^ high;
+    #endif
+}
+
+static __forceinline unsigned long long __vcrt_type_hash_read8(char const* const p)
+{
+    unsigned long long value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static __forceinline unsigned long long __vcrt_type_hash_read4(char const* const p)
+{
+    unsigned int value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+extern "C" size_t __cdecl __vcrt_hash_type_name(
+    _In_z_    char const* const name,
+    _Out_opt_ size_t*     const length
+    )
+{
+    size_t const count = strlen(name);
+    if (length)
+    {
+        *length = count;
+    }
+
+    char const*        it        = name;
+    size_t             remaining = count;
+    unsigned long long seed      = __vcrt_type_hash_seed0 ^ count;
+
+    for (; remaining > 16; remaining -= 16, it += 16)
+    {
+        seed = __vcrt_type_hash_mix(
+            __vcrt_type_hash_read8(it)     ^ __vcrt_type_hash_seed1,
+            __vcrt_type_hash_read8(it + 8) ^ seed);
+    }
+
+    unsigned long long a = 0;
+    unsigned long long b = 0;
+    if (remaining > 8)
+    {
+        a = __vcrt_type_hash_read8(it);
+        b = __vcrt_type_hash_read8(it + remaining - 8);
+    }
+    else if (remaining >= 4)
+    {
+        a = __vcrt_type_hash_read4(it);
+        b = __vcrt_type_hash_read4(it + remaining - 4);
+    }
+    else if (remaining > 0)
+    {
+        a = (static_cast<unsigned long long>(static_cast<unsigned char>(it[0])) << 16)
+          | (static_cast<unsigned long long>(static_cast<unsigned char>(it[remaining >> 1])) << 8)
+          |  static_cast<unsigned long long>(static_cast<unsigned char>(it[remaining - 1]));
+    }
+
+    unsigned long long const value = __vcrt_type_hash_mix(
+        __vcrt_type_hash_seed1 ^ count,
+        __vcrt_type_hash_mix(a ^ __vcrt_type_hash_seed1, b ^ seed));
+
+    #ifdef _WIN64
+    static_assert(sizeof(size_t) == 8, "This code is for 64-bit size_t.");
+    return static_cast<size_t>(value);
+    #else
+    static_assert(sizeof(size_t) == 4, "This code is for 32-bit size_t.");
+    return static_cast<size_t>(value ^ (value >> 32));
+    #endif
+}
+
 extern "C" int __cdecl __std_type_info_compare(
     __std_type_info_data const* const lhs,
     __std_type_info_data const* const rhs
@@ -25,6 +132,10 @@ extern "C" int __cdecl __std_type_info_compare(
         return 0;
     }
 
+    // type_info::before is ordered by the decorated names, so this cannot
+    // return early on a hash mismatch: that would tell the names apart but
+    // not which comes first.  The runtime's own type equality checks go
+    // through __vcrt_type_names_equal, which does reject by the hash.
     return strcmp(lhs->_DecoratedName + 1, rhs->_DecoratedName + 1);
 }
 
@@ -32,36 +143,35 @@ extern "C" size_t __cdecl __std_type_info_hash(
     __std_type_info_data const* const data
     )
 {
-    // FNV-1a hash function for the undecorated name
-
-    #ifdef _WIN64
-    static_assert(sizeof(size_t) == 8, "This code is for 64-bit size_t.");
-    size_t const fnv_offset_basis = 14695981039346656037ULL;
-    size_t const fnv_prime        = 1099511628211ULL;
+    #if defined _M_X64 || defined _M_ARM || defined _M_ARM64 || defined _M_HYBRID
+    return __vcrt_type_name_hash(data->_DecoratedName, nullptr);
     #else
-    static_assert(sizeof(size_t) == 4, "This code is for 32-bit size_t.");
-    size_t const fnv_offset_basis = 2166136261U;
-    size_t const fnv_prime        = 16777619U;
+    return __vcrt_hash_type_name(data->_DecoratedName, nullptr);
     #endif
+}
 
-    size_t value = fnv_offset_basis;
-    for (char const* it = data->_DecoratedName + 1; *it != '\0'; ++it)
-    {
-        value ^= static_cast<size_t>(static_cast<unsigned char>(*it));
-        value *= fnv_prime;
-    }
+// The list of undecorated names handed out by std::type_info::name(), freed
+// when the runtime is uninitialized.
+extern "C" __type_info_node __type_info_root_node{};
 
-    #ifdef _WIN64
-    static_assert(sizeof(size_t) == 8, "This code is for 64-bit size_t.");
-    value ^= value >> 32;
-    #else
-    static_assert(sizeof(size_t) == 4, "This code is for 32-bit size_t.");
-    #endif
+// Blocks for the undecorated name leave room for the list entry in front of
+// the string, so that it can be linked into the list as it is, without being
+// copied into a node of its own.  The undecorator also takes the blocks it
+// spills to once its arena is full from here; they are freed the same way.
+static void* __cdecl __vcrt_type_name_alloc(size_t const size)
+{
+    PSLIST_ENTRY const node = static_cast<PSLIST_ENTRY>(malloc(sizeof(SLIST_ENTRY) + size));
+    return node ? node + 1 : nullptr;
+}
 
-    return value;
+static void __cdecl __vcrt_type_name_free(void* const block)
+{
+    if (block)
+    {
+        free(static_cast<PSLIST_ENTRY>(block) - 1);
+    }
 }
 
-#if 0 // TODO
 extern "C" char const* __cdecl __std_type_info_name(
     __std_type_info_data* const data,
     __type_info_node*     const root_node
@@ -77,44 +187,41 @@ extern "C" char const* __cdecl __std_type_info_name(
         }
     }
 
-    __crt_unique_heap_ptr<char> undecorated_name(__unDName(
+    // The undecorator's working storage comes from this arena, so that most
+    // names cost a single allocation (the result):
+    char arena[1024];
+
+    char* const undecorated_name = __unDNameInArena(
         nullptr,
         data->_DecoratedName + 1,
         0,
-        [](size_t const n) { return malloc(n); },
-        [](void*  const p) { return free(p);   },
-        UNDNAME_32_BIT_DECODE | UNDNAME_TYPE_ONLY));
+        __vcrt_type_name_alloc,
+        __vcrt_type_name_free,
+        nullptr,
+        UNDNAME_32_BIT_DECODE | UNDNAME_TYPE_ONLY,
+        arena,
+        sizeof(arena));
 
     if (!undecorated_name)
     {
         return nullptr; // CRT_REFACTOR TODO This is nonconforming
     }
 
-    size_t undecorated_name_length = strlen(undecorated_name.get());
-    while (undecorated_name_length != 0 && undecorated_name.get()[undecorated_name_length - 1] == ' ')
-    {
-        undecorated_name.get()[undecorated_name_length - 1] = '\0';
-        --undecorated_name_length;
-    }
-
-    size_t const undecorated_name_count = undecorated_name_length + 1;
-    size_t const node_size = sizeof(SLIST_ENTRY) + undecorated_name_count;
+    __crt_unique_heap_ptr<void> node_block(reinterpret_cast<PSLIST_ENTRY>(undecorated_name) - 1);
 
-    __crt_unique_heap_ptr<void> node_block(malloc(node_size));
-    if (!node_block)
+    size_t undecorated_name_length = strlen(undecorated_name);
+    while (undecorated_name_length != 0 && undecorated_name[undecorated_name_length - 1] == ' ')
     {
-        return nullptr; // CRT_REFACTOR TODO This is nonconforming
+        undecorated_name[undecorated_name_length - 1] = '\0';
+        --undecorated_name_length;
     }
 
     PSLIST_ENTRY const node_header = static_cast<PSLIST_ENTRY>(node_block.get());
-    char*        const node_string = reinterpret_cast<char*>(node_header + 1);
-
     *node_header = SLIST_ENTRY{};
-    strcpy_s(node_string, undecorated_name_count, undecorated_name.get());
 
     char const* const cached_undecorated_name = __crt_interlocked_compare_exchange_pointer(
         &data->_UndecoratedName,
-        node_string,
+        undecorated_name,
         nullptr);
 
     // If the cache already contained an undecorated name pointer, another
@@ -129,9 +236,8 @@ extern "C" char const* __cdecl __std_type_info_name(
     // and return it:
     node_block.detach();
     InterlockedPushEntrySList(&root_node->_Header, node_header);
-    return node_string;
+    return undecorated_name;
 }
-#endif
 
 // This function is called during module unload to clean up all of the undecorated
 // name strings that were allocated by calls to name().
@@ -31,6 +31,7 @@
 #include <rtcapi.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <kext/kstartup.h>
 
 
 
@@ -73,31 +74,80 @@ static __declspec(noinline) void __scrt_common_exit(PDRIVER_OBJECT drvobj)
 {
     if (__drv_unload && __drv_unload != &__scrt_common_exit)
     {
+        LONGLONG const unload_start = __scrt_startup_phase_begin();
         __drv_unload(drvobj);
+        __scrt_startup_phase_end(__ucxxrt_phase_driver_unload, unload_start);
     }
 
+    LONGLONG const cexit_start = __scrt_startup_phase_begin();
     _cexit();
+    __scrt_startup_phase_end(__ucxxrt_phase_cexit, cexit_start);
 
+    LONGLONG const uninitialize_start = __scrt_startup_phase_begin();
     __scrt_uninitialize_crt(true, true);
+    __scrt_startup_phase_end(__ucxxrt_phase_uninitialize_crt, uninitialize_start);
+
+    __scrt_finish_startup_timing();
+}
+
+// Undoes the initialization when DriverEntry fails once the CRT is up:  the
+// I/O manager unloads the image without calling DriverUnload, so the atexit
+// functions and the CRT's own callbacks must not outlive this call.
+static void __cdecl __scrt_common_main_failed()
+{
+    LONGLONG phase_start = __scrt_startup_phase_begin();
+    _cexit();
+    __scrt_startup_phase_end(__ucxxrt_phase_cexit, phase_start);
+
+    // We terminate the CRT:
+    phase_start = __scrt_startup_phase_begin();
+    __scrt_uninitialize_crt(true, false);
+    __scrt_startup_phase_end(__ucxxrt_phase_uninitialize_crt, phase_start);
+
+    __scrt_finish_startup_timing();
 }
 
 static __declspec(noinline) long __cdecl __scrt_common_main_seh(PDRIVER_OBJECT drvobj, PUNICODE_STRING regpath)
 {
+    __scrt_initialize_startup_timing();
+
+    LONGLONG const initialize_start = __scrt_startup_phase_begin();
     if (!__scrt_initialize_crt())
         __scrt_fastfail(FAST_FAIL_FATAL_APP_EXIT);
+    __scrt_startup_phase_end(__ucxxrt_phase_initialize_crt, initialize_start);
 
     __try
     {
-        if (_initterm_e(__xi_a, __xi_z) != 0)
+        LONGLONG phase_start = __scrt_startup_phase_begin();
+        if (__scrt_initterm_e(__xi_a, __xi_z) != 0)
+        {
+            __scrt_common_main_failed();
             return STATUS_FAILED_DRIVER_ENTRY;
+        }
+        __scrt_startup_phase_end(__ucxxrt_phase_c_initializers, phase_start);
+
+        phase_start = __scrt_startup_phase_begin();
+        __scrt_initterm(__xc_a, __xc_z);
+        __scrt_startup_phase_end(__ucxxrt_phase_cpp_initializers, phase_start);
 
-        _initterm(__xc_a, __xc_z);
+        phase_start = __scrt_startup_phase_begin();
+        if (_initterm_parallel(__xcp_a, __xcp_z) != 0)
+        {
+            __scrt_common_main_failed();
+            return STATUS_FAILED_DRIVER_ENTRY;
+        }
+        __scrt_startup_phase_end(__ucxxrt_phase_parallel_initializers, phase_start);
 
         //
         // Initialization is complete; invoke main...
         //
 
+        phase_start = __scrt_startup_phase_begin();
         long const main_result = invoke_main(drvobj, regpath);
+        __scrt_startup_phase_end(__ucxxrt_phase_driver_main, phase_start);
+
+        __scrt_report_startup_timing();
+
         if (NT_SUCCESS(main_result))
         {
             if (drvobj && drvobj->DriverUnload)
@@ -108,10 +158,7 @@ static __declspec(noinline) long __cdecl __scrt_common_main_seh(PDRIVER_OBJECT d
         }
         else
         {
-            _cexit();
-
-            // We terminate the CRT:
-            __scrt_uninitialize_crt(true, false);
+            __scrt_common_main_failed();
         }
 
         return main_result;
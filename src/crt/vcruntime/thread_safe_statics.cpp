@@ -0,0 +1,174 @@
+/*
+ * PROJECT:   Universal C++ RunTime (UCXXRT)
+ * FILE:      thread_safe_statics.cpp
+ * DATE:      2026/10/16
+ *
+ * PURPOSE:   Universal C++ RunTime
+ *
+ * LICENSE:   Relicensed under The MIT License from The CC BY 4.0 License
+ *
+ * DEVELOPER: MiroKaku (miro.kaku AT Outlook.com)
+ */
+
+//
+// Helpers for the thread-safe initialization of statics.  The compiler wraps
+// the initializer of such a static in
+//
+//     if (guard > _Init_thread_epoch)
+//     {
+//         _Init_thread_header(&guard);
+//         if (guard == -1)
+//         {
+//             construct the static; _Init_thread_abort(&guard) if it throws
+//             _Init_thread_footer(&guard);
+//         }
+//     }
+//
+// The desktop VCRuntime runs every header and footer under one critical
+// section and parks every waiter on one condition variable.  Here the guard
+// word is the whole state: 0 before initialization, -1 while some thread runs
+// the initializer, and INT_MIN once it has completed.  A thread claims the
+// guard with a compare-exchange; a thread that finds it claimed sleeps on one
+// of a fixed set of wait slots chosen by hashing the guard address, and the
+// footer or abort wakes only that slot.  Statics whose guards hash to the same
+// slot share at most a spurious wakeup.
+//
+// The desktop VCRuntime keeps _Init_thread_epoch in thread local storage and
+// stamps each completed guard with a new global epoch.  Compiler-generated
+// guards read the epoch through the TLS slot, which a driver does not have, so
+// drivers are built with /Zc:threadSafeInit- and neither epoch is defined
+// here.  Kernel code reaches these helpers through std::kstatic
+// (kext/kstatic.h), whose fast path is a single acquire load of the guard.
+//
+#include <vcruntime_internal.h>
+#include <limits.h>
+
+enum : int
+{
+    __vcrt_static_uninitialized      = 0,
+    __vcrt_static_being_initialized  = -1,
+    __vcrt_static_initialized        = INT_MIN
+};
+
+// Must be a power of two.
+#define __vcrt_static_wait_slots 64
+
+struct __declspec(align(SYSTEM_CACHE_ALIGNMENT_SIZE)) __vcrt_static_wait_slot
+{
+    KSEMAPHORE      semaphore;
+    long volatile   waiters; // threads that may sleep on the semaphore
+};
+
+static __vcrt_static_wait_slot __vcrt_static_wait_table[__vcrt_static_wait_slots];
+
+
+
+static __forceinline long volatile* __vcrt_static_guard(int* const once)
+{
+    static_assert(sizeof(int) == sizeof(long), "");
+    return reinterpret_cast<long volatile*>(once);
+}
+
+static __forceinline __vcrt_static_wait_slot* __vcrt_static_slot(int* const once)
+{
+    // Guards are 4-byte aligned and often sit next to each other; a Fibonacci
+    // hash spreads neighbours over the whole table.
+    unsigned const key = static_cast<unsigned>(reinterpret_cast<uintptr_t>(once) >> 2);
+    return &__vcrt_static_wait_table[(key * 0x9E3779B1u) >> (32 - 6)];
+}
+
+static_assert(__vcrt_static_wait_slots == 1 << 6, "the hash shift must match the slot count");
+
+static void __vcrt_static_wait(int* const once)
+{
+    __vcrt_static_wait_slot* const slot = __vcrt_static_slot(once);
+
+    // Count ourselves in before the last look at the guard:  a footer that
+    // changes the guard after that look will then find us when it drains the
+    // count.  If the guard has already changed, the count we leave behind
+    // only costs some later waiter on this slot a spurious wakeup.
+    _InterlockedIncrement(&slot->waiters);
+    if (ReadAcquire(__vcrt_static_guard(once)) != __vcrt_static_being_initialized)
+    {
+        return;
+    }
+
+    KeWaitForSingleObject(&slot->semaphore, Executive, KernelMode, FALSE, nullptr);
+}
+
+static void __vcrt_static_wake(int* const once)
+{
+    __vcrt_static_wait_slot* const slot = __vcrt_static_slot(once);
+
+    // The interlocked store of the guard orders this read after it, and every
+    // waiter counts itself in with an interlocked increment before it reads
+    // the guard; one side or the other sees the change.
+    if (ReadNoFence(&slot->waiters) == 0)
+    {
+        return;
+    }
+
+    long const waiters = _InterlockedExchange(&slot->waiters, 0);
+    if (waiters > 0)
+    {
+        KeReleaseSemaphore(&slot->semaphore, IO_NO_INCREMENT, waiters, FALSE);
+    }
+}
+
+extern "C" {
+
+bool __cdecl __vcrt_initialize_thread_safe_statics()
+{
+    for (auto& slot : __vcrt_static_wait_table)
+    {
+        KeInitializeSemaphore(&slot.semaphore, 0, LONG_MAX);
+    }
+
+    return true;
+}
+
+// Returns with *once == -1 if the caller is to run the initializer, or with
+// the static initialized.  Waits, at IRQL <= APC_LEVEL, while another thread
+// runs the initializer.
+void __cdecl _Init_thread_header(int* const once) noexcept
+{
+    long volatile* const guard = __vcrt_static_guard(once);
+
+    for (;;)
+    {
+        long const state = ReadAcquire(guard);
+        if (state == __vcrt_static_uninitialized)
+        {
+            if (_InterlockedCompareExchange(guard, __vcrt_static_being_initialized,
+                __vcrt_static_uninitialized) == __vcrt_static_uninitialized)
+            {
+                return;
+            }
+        }
+        else if (state == __vcrt_static_being_initialized)
+        {
+            __vcrt_static_wait(once);
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+// Called by the thread that ran the initializer once it has completed.
+void __cdecl _Init_thread_footer(int* const once) noexcept
+{
+    _InterlockedExchange(__vcrt_static_guard(once), __vcrt_static_initialized);
+    __vcrt_static_wake(once);
+}
+
+// Called by the thread that ran the initializer if it threw; one of the
+// waiters takes over.
+void __cdecl _Init_thread_abort(int* const once) noexcept
+{
+    _InterlockedExchange(__vcrt_static_guard(once), __vcrt_static_uninitialized);
+    __vcrt_static_wake(once);
+}
+
+} // extern "C"
@@ -32,8 +32,10 @@ extern "C" __declspec(noreturn) void __stdcall _CxxThrowException(
     auto pTI = reinterpret_cast<ThrowInfo *>(pThrowInfo);
     ULONG_PTR magicNumber = EH_MAGIC_NUMBER1;
 
+    _VCRT_EH_TELEMETRY(__vcrt_eh_telemetry_throw(_ReturnAddress(), pTI));
+
 #if _EH_RELATIVE_TYPEINFO
-    void *throwImageBase = RtlPcToFileHeader(const_cast<void *>(static_cast<const void *>(pTI)), &throwImageBase);
+    void *throwImageBase = __vcrt_pc_to_file_header(const_cast<void *>(static_cast<const void *>(pTI)), &throwImageBase);
 #endif // _EH_RELATIVE_TYPEINFO
 
     // If the throw info indicates this throw is from a pure region,
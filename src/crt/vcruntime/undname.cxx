@@ -19,6 +19,30 @@
 #define __UNDNAME_IMP
 #endif
 
+#ifndef __UNDNAME_NAME
+#ifdef _VCRT_BUILD
+#define __UNDNAME_NAME __unDName
+#else
+#define __UNDNAME_NAME unDName
+#endif
+#endif
+
+#ifndef __UNDNAME_NAME_EX
+#ifdef _VCRT_BUILD
+#define __UNDNAME_NAME_EX __unDNameEx
+#else
+#define __UNDNAME_NAME_EX unDNameEx
+#endif
+#endif
+
+#ifndef __UNDNAME_NAME_ARENA
+#ifdef _VCRT_BUILD
+#define __UNDNAME_NAME_ARENA __unDNameInArena
+#else
+#define __UNDNAME_NAME_ARENA unDNameInArena
+#endif
+#endif
+
 #ifndef PACK_SIZE
 #ifdef _VCRT_BUILD
 #define PACK_SIZE 8
@@ -121,14 +145,34 @@ private:
 	Block *			tail;
 	size_t blockLeft;
 
+	// Caller-supplied storage (usually on the caller's stack) that is used up
+	// before the first Block is allocated, so that typical names need none.
+	pchar_t arena;
+	size_t arenaLeft;
+
 public:
-	void Constructor(Alloc_t pAlloc, Free_t pFree)
+	void Constructor(Alloc_t pAlloc, Free_t pFree, _Out_writes_bytes_opt_(arenaSize) void* pArena = nullptr, size_t arenaSize = 0)
 	{
 		pOpNew = pAlloc;
 		pOpDelete = pFree;
 		blockLeft = 0;
 		head = 0;
 		tail = 0;
+
+		//	Keep every allocation carved from the arena PACK_SIZE aligned
+
+		size_t const skip = (PACK_SIZE - (reinterpret_cast<size_t>(pArena) & (PACK_SIZE - 1))) & (PACK_SIZE - 1);
+
+		if (pArena && arenaSize > skip)
+		{
+			arena = static_cast<pchar_t>(pArena) + skip;
+			arenaLeft = (arenaSize - skip) & ~static_cast<size_t>(PACK_SIZE - 1);
+		}
+		else
+		{
+			arena = 0;
+			arenaLeft = 0;
+		}
 	}
 
 	void *getMemoryWithoutBuffer(size_t sz);
@@ -154,10 +198,21 @@ public:
 
 
 void   *	operator new (size_t, _HeapManager &, int = 0);
+void   *	operator new[] (size_t, _HeapManager &, int = 0);
 
 
 
-static _HeapManager heap;
+//	Each undecoration owns its heap, so any number of them may run at once.
+//	UnDecorator members reach it through their 'heap' member; the DName
+//	composition code (which has no UnDecorator at hand) reaches the heap of
+//	the undecoration running on the current thread through this tag instead.
+
+struct _CurrentHeapManager {};
+
+static constexpr _CurrentHeapManager heap{};
+
+void   *	operator new (size_t, _CurrentHeapManager, int = 0);
+void   *	operator new[] (size_t, _CurrentHeapManager, int = 0);
 
 // This class is used to wrap a string literal which is available in the whole program
 // DName can directly reference a string literal without potential lifetime issue
@@ -434,7 +489,7 @@ public:
 	explicit DName(const StringLiteral& s);
 	template<StringLife life>
 	explicit DName(pcchar_t, StringLifeSelector<life>);
-	explicit DName(pcchar_t&, char);
+	explicit DName(pcchar_t&, char, bool fCheckIdentChars = true);
 	explicit DName(DNameStatus);
 	explicit DName(DName *);
 	explicit DName(unsigned __int64);
@@ -595,23 +650,25 @@ private:
 	//	Declare, in order to suppress automatic generation
 	void operator = (const UnDecorator&);
 
+	_HeapManager &	heap;
+
 	Replicator ArgList;
-	static Replicator *	pArgList;
+	Replicator *	pArgList;
 
 	Replicator ZNameList;
-	static Replicator *	pZNameList;
+	Replicator *	pZNameList;
 
-	static Replicator *	pTemplateArgList;
+	Replicator *	pTemplateArgList;
 
-	static pcchar_t gName;
-	static pcchar_t name;
-	static unsigned long disableFlags;
-	static bool fExplicitTemplateParams;
-	static bool fGetTemplateArgumentList;
+	pcchar_t gName;
+	pcchar_t name;
+	unsigned long disableFlags;
+	bool fExplicitTemplateParams;
+	bool fGetTemplateArgumentList;
 
 	// Increment the internal buffer 'gName' by 'count' characters.
 	// If it passes the terminating null, return false. Otherwise, return true.
-	static [[nodiscard]] bool increment_buffer(size_t count)
+	[[nodiscard]] bool increment_buffer(size_t count)
 	{
 		DASSERT(count > 0);
 
@@ -630,7 +687,7 @@ private:
 
 	// Increment the internal buffer 'gName' by 'count' characters.
 	// The caller ensures that it won't pass the terminating null.
-	static void increment_buffer_no_check(size_t count)
+	void increment_buffer_no_check(size_t count)
 	{
 		DASSERT(count > 0);
 
@@ -644,7 +701,7 @@ private:
 
 	// Increment the internal buffer 'gName' by one character.
 	// The caller ensures that it won't pass the terminating null.
-	static void increment_buffer_no_check()
+	void increment_buffer_no_check()
 	{
 		DASSERT(*gName != 0);
 		++gName;
@@ -653,139 +710,341 @@ private:
 	// Get the current character pointed by the internal buffer 'gName'.
 	// If the current character isn't the terminating null, increment the buffer
 	// by one character.
-	static [[nodiscard]] char get_current_character_and_increment_buffer()
+	[[nodiscard]] char get_current_character_and_increment_buffer()
 	{
 		char c = *gName;
 		if (c) ++gName;
 		return c;
 	}
 
-	static DName getDecoratedName(void);
-	static DName getSymbolName(void);
-	static DName getZName(bool fUpdateCachedNames, bool fAllowEmptyName = false);
-	static DName getOperatorName(bool fIsTemplate, bool *pfReadTemplateArguments);
-	static DName getScope(void);
-	static DName getScopedName(void);
-	static std::optional<std::uint64_t> getValue();
-	static DName getSignedDimension(void);
-	static DName getDimension(bool is_signed = false);
-	static DName getFloatingPoint(int type_category);
-	static DName getValueObject();
-	static DName getArrayObject();
-	static DName getStringObject();
-	static DName getAddressOf();
-	static DName getMemberAccess();
-	static DName getArrayAccess();
-	static DName getUnionObject();
-	static DName getPointerToMember();
-	static int getNumberOfDimensions(void);
-	static DName getTemplateName(bool);
-	static DName getTemplateArgumentList(void);
-	static DName getTemplateNonTypeArgument(void);
-	static DName getTemplateTypeArgument(void);
-	static DName composeDeclaration(const DName &);
-	static int getTypeEncoding(void);
-	static DName getBasedType(void);
-	static DName getECSUName(void);
-	static DName getEnumType(void);
-	static DName getCallingConvention(void);
-	static DName getReturnType(DName * = 0);
-	static DName getDataType(DName *);
-	static DName getPrimaryDataType(const DName &);
-	static DName getDataIndirectType(const DName &, IndirectionKind kind, const DName &, int = FALSE);
-	static DName getExtendedDataIndirectType(IndirectionKind& kind, bool& fIsPinPtr, int thisFlag);
-	static DName getDataIndirectType();
-	static DName getBasicDataType(const DName &);
-	static DName getECSUDataType(void);
-	static DName getPtrRefType(const DName &, const DName &, IndirectionKind kind);
-	static DName getPtrRefDataType(const DName &, int);
-	static DName getArrayType(const DName&);
-	static DName getFunctionIndirectType(const DName & superType);
-	static DName getArgumentTypes(void);
-	static DName getArgumentList(void);
-	static DName getThrowTypes(void);
-	static DName getNoexcept();
+	DName getDecoratedName(void);
+	DName getSymbolName(void);
+	DName getZName(bool fUpdateCachedNames, bool fAllowEmptyName = false);
+	DName getOperatorName(bool fIsTemplate, bool *pfReadTemplateArguments);
+	DName getScope(void);
+	DName getScopedName(void);
+	std::optional<std::uint64_t> getValue();
+	DName getSignedDimension(void);
+	DName getDimension(bool is_signed = false);
+	DName getFloatingPoint(int type_category);
+	DName getValueObject();
+	DName getArrayObject();
+	DName getStringObject();
+	DName getAddressOf();
+	DName getMemberAccess();
+	DName getArrayAccess();
+	DName getUnionObject();
+	DName getPointerToMember();
+	int getNumberOfDimensions(void);
+	DName getTemplateName(bool);
+	DName getTemplateArgumentList(void);
+	DName getTemplateNonTypeArgument(void);
+	DName getTemplateTypeArgument(void);
+	DName composeDeclaration(const DName &);
+	int getTypeEncoding(void);
+	DName getBasedType(void);
+	DName getECSUName(void);
+	DName getEnumType(void);
+	DName getCallingConvention(void);
+	DName getReturnType(DName * = 0);
+	DName getDataType(DName *);
+	DName getPrimaryDataType(const DName &);
+	DName getDataIndirectType(const DName &, IndirectionKind kind, const DName &, int = FALSE);
+	DName getExtendedDataIndirectType(IndirectionKind& kind, bool& fIsPinPtr, int thisFlag);
+	DName getDataIndirectType();
+	DName getBasicDataType(const DName &);
+	DName getECSUDataType(void);
+	DName getPtrRefType(const DName &, const DName &, IndirectionKind kind);
+	DName getPtrRefDataType(const DName &, int);
+	DName getArrayType(const DName&);
+	DName getFunctionIndirectType(const DName & superType);
+	DName getArgumentTypes(void);
+	DName getArgumentList(void);
+	DName getThrowTypes(void);
+	DName getNoexcept();
 #if CC_RESTRICTION_SPEC
-	static DName getRestrictionSpec(void);
-	static DName getDispatchTarget(void);
+	DName getRestrictionSpec(void);
+	DName getDispatchTarget(void);
 #endif // CC_RESTRICTION_SPEC
-	static DName getLexicalFrame(void);
-	static DName getStorageConvention(void);
-	static DName getThisType(void);
-	static DName getPointerType(const DName &, const DName &);
-	static DName getPointerTypeArray(const DName &, const DName &);
-	static DName getReferenceType(const DName &, const DName &, IndirectionKind kind);
-	static DName getExternalDataType(const DName &);
-	static DName getSegmentName(void);
+	DName getLexicalFrame(void);
+	DName getStorageConvention(void);
+	DName getThisType(void);
+	DName getPointerType(const DName &, const DName &);
+	DName getPointerTypeArray(const DName &, const DName &);
+	DName getReferenceType(const DName &, const DName &, IndirectionKind kind);
+	DName getExternalDataType(const DName &);
+	DName getSegmentName(void);
 
 #if ( !NO_COMPILER_NAMES )
-	static DName getDisplacement(void);
-	static DName getCallIndex(void);
-	static DName getGuardNumber(void);
-	static DName getVfTableType(const DName &);
-	static DName getVbTableType(const DName &);
-	static DName getVdispMapType(const DName &);
-	static DName getVCallThunkType(void);
+	DName getDisplacement(void);
+	DName getCallIndex(void);
+	DName getGuardNumber(void);
+	DName getVfTableType(const DName &);
+	DName getVbTableType(const DName &);
+	DName getVdispMapType(const DName &);
+	DName getVCallThunkType(void);
 #endif // !NO_COMPILER_NAMES
 
-	static DName getStringEncoding(PrefixKind kind, int wantBody);
-    static DName parseDecoratedName(void);
+	DName getStringEncoding(PrefixKind kind, int wantBody);
+    DName parseDecoratedName(void);
 
-	static GetParameter_t m_pGetParameter;
-    static unsigned long m_CHPENameOffset;
-    static unsigned long m_recursionLevel;
+	GetParameter_t m_pGetParameter;
+    unsigned long m_CHPENameOffset;
+    unsigned long m_recursionLevel;
 
 public:
-	UnDecorator(pcchar_t, GetParameter_t, unsigned long);
+	UnDecorator(_HeapManager&, pcchar_t, GetParameter_t, unsigned long);
 
-	static int doUnderScore();
-	static int doMSKeywords();
-	static int doPtr64();
-	static int doFunctionReturns();
-	static int doAllocationModel();
-	static int doAllocationLanguage();
+	int doUnderScore();
+	int doMSKeywords();
+	int doPtr64();
+	int doFunctionReturns();
+	int doAllocationModel();
+	int doAllocationLanguage();
 
 #if 0
-	static int doMSThisType();
-	static int doCVThisType();
+	int doMSThisType();
+	int doCVThisType();
 #endif
 
-	static int doThisTypes();
-	static int doAccessSpecifiers();
-	static int doThrowTypes();
-	static int doMemberTypes();
-	static int doReturnUDTModel();
+	int doThisTypes();
+	int doAccessSpecifiers();
+	int doThrowTypes();
+	int doMemberTypes();
+	int doReturnUDTModel();
 
-	static int do32BitNear();
+	int do32BitNear();
 
-	static int doNameOnly();
-	static int doTypeOnly();
-	static int haveTemplateParameters();
-	static int doEcsu();
-	static int doNoIdentCharCheck();
-	static int doEllipsis();
+	int doNameOnly();
+	int doTypeOnly();
+	int haveTemplateParameters();
+	int doEcsu();
+	int doNoIdentCharCheck();
+	int doEllipsis();
 #if CC_RESTRICTION_SPEC
-	static int doRestrictionSpec();
+	int doRestrictionSpec();
 #endif // CC_RESTRICTION_SPEC
-	static StringLiteral UScore(Tokens);
+	StringLiteral UScore(Tokens);
 
     _Success_(return != nullptr) pchar_t getUndecoratedName(_Out_opt_z_cap_(maxStringLength) pchar_t, int maxStringLength);
     _Success_(return != nullptr) pchar_t getCHPEName(_Out_opt_z_cap_(maxStringLength) pchar_t, int maxStringLength);
 };
 
 
+//	The heap management for the undecorator.  Each call builds its own heap
+//	on its stack, so the routines below need no serialization.
+
+// Arena on the caller's stack used by the entry points below; big enough for
+// the nodes and strings of typical type and function names.
+const   unsigned int    defaultArenaSize = 1024;
+
+void * _HeapManager::getMemoryWithoutBuffer(size_t sz)
+{
+	//	Storage that outlives the call (the returned name, new Blocks)
+
+	return (*pOpNew)(sz);
+}
+
+void * _HeapManager::getMemoryWithBuffer(size_t sz)
+{
+	//	Align the allocation on an appropriate boundary
+
+	sz = ((sz + PACK_SIZE - 1) & ~static_cast<size_t>(PACK_SIZE - 1));
+
+	//	Handle a potential request for no space
+
+	if (!sz)
+		sz = PACK_SIZE;
+
+	//	Use up the caller's arena first
+
+	if (arenaLeft >= sz)
+	{
+		arenaLeft -= sz;
+		return arena + arenaLeft;
+	}
+
+	if (blockLeft < sz)
+	{
+		//	Is the request greater than the largest buffer size ?
+
+		if (sz > memBlockSize)
+			return 0;		// If it is, there is nothing we can do
+
+		//	Allocate a new block
+
+		Block * pNewBlock = static_cast<Block *>(getMemoryWithoutBuffer(sizeof(Block)));
+
+		if (!pNewBlock)
+			return 0;		// Oh-oh!  Memory allocation failure
+
+		pNewBlock->next = 0;
+
+		if (tail)
+			tail = tail->next = pNewBlock;
+		else
+			head = tail = pNewBlock;
+
+		blockLeft = memBlockSize - sz;
+	}
+	else
+		blockLeft -= sz;	// Deduct the allocated amount
+
+	return &(tail->memBlock[blockLeft]);
+}
+
+void * operator new (size_t sz, _HeapManager & callHeap, int noBuffer)
+{
+	if (noBuffer)
+		return callHeap.getMemoryWithoutBuffer(sz);
+	else
+		return callHeap.getMemoryWithBuffer(sz);
+}
+
+void * operator new[] (size_t sz, _HeapManager & callHeap, int noBuffer)
+{
+	return operator new(sz, callHeap, noBuffer);
+}
+
+#ifdef _VCRT_BUILD
+
+//	The kernel has no thread local storage, and the PTD lookup takes a global
+//	lock.  Instead, each undecoration publishes its heap in a slot of this
+//	table, claimed for the thread for the duration of the outermost call and
+//	found again by hashing the thread.  Only the owning thread writes a
+//	claimed slot or reads its heap, so lookups take no lock; other threads
+//	see only that the slot is not theirs.
+
+struct _CurrentHeapSlot
+{
+	void * volatile	thread;
+	_HeapManager *	pHeap;
+};
+
+// Must be a power of two; bounds the number of threads undecorating at once, past
+// which undecoration fails
+const   unsigned int    currentHeapSlots = 256;
+
+static _CurrentHeapSlot currentHeapTable[currentHeapSlots];
+
+static unsigned int current_heap_hash(void * thread)
+{
+	//	Thread objects are allocated on large boundaries; a Fibonacci hash
+	//	spreads them over the table
+
+	unsigned long long const key = reinterpret_cast<uintptr_t>(thread) >> 4;
+	return static_cast<unsigned int>((key * 0x9E3779B97F4A7C15ull) >> 32) & (currentHeapSlots - 1);
+}
+
+static _CurrentHeapSlot * find_current_heap_slot(void * thread)
+{
+	unsigned int const first = current_heap_hash(thread);
+
+	for (unsigned int i = 0; i != currentHeapSlots; ++i)
+	{
+		_CurrentHeapSlot * const pSlot = &currentHeapTable[(first + i) & (currentHeapSlots - 1)];
+		if (ReadPointerNoFence(&pSlot->thread) == thread)
+			return pSlot;
+	}
+
+	return nullptr;
+}
+
+//	Makes 'pHeap' the heap of the undecoration running on this thread, and
+//	returns the previous one in 'ppOuterHeap' for leave_current_heap.  Fails
+//	if every slot is taken by other threads; the caller then fails as it would
+//	when out of memory, rather than wait for a slot that a stalled or
+//	preempted thread may hold for a long time.
+
+static bool enter_current_heap(_HeapManager * pHeap, _HeapManager ** ppOuterHeap)
+{
+	void * const thread = KeGetCurrentThread();
+
+	//	A nested call (from pAlloc, pFree or pGetParameter) reuses the slot
+
+	if (_CurrentHeapSlot * const pSlot = find_current_heap_slot(thread))
+	{
+		*ppOuterHeap = pSlot->pHeap;
+		pSlot->pHeap = pHeap;
+		return true;
+	}
+
+	unsigned int const first = current_heap_hash(thread);
+
+	for (unsigned int i = 0; i != currentHeapSlots; ++i)
+	{
+		_CurrentHeapSlot * const pSlot = &currentHeapTable[(first + i) & (currentHeapSlots - 1)];
+		if (ReadPointerNoFence(&pSlot->thread) == nullptr &&
+			InterlockedCompareExchangePointer(&pSlot->thread, thread, nullptr) == nullptr)
+		{
+			pSlot->pHeap = pHeap;
+			*ppOuterHeap = nullptr;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//	Restores the heap that enter_current_heap replaced; restoring nullptr
+//	releases the thread's slot.
+
+static void leave_current_heap(_HeapManager * pOuterHeap)
+{
+	_CurrentHeapSlot * const pSlot = find_current_heap_slot(KeGetCurrentThread());
+
+	DASSERT(pSlot);
+
+	if (pOuterHeap)
+		pSlot->pHeap = pOuterHeap;
+	else
+		WritePointerRelease(&pSlot->thread, nullptr);
+}
+
+void * operator new (size_t sz, _CurrentHeapManager, int noBuffer)
+{
+	_CurrentHeapSlot * const pSlot = find_current_heap_slot(KeGetCurrentThread());
+
+	DASSERT(pSlot);
+
+	return operator new(sz, *pSlot->pHeap, noBuffer);
+}
+
+#else
+
+static thread_local _HeapManager * pCurrentHeap;
+
+//	Makes 'pHeap' the heap of the undecoration running on this thread, and
+//	returns the previous one in 'ppOuterHeap' for leave_current_heap.
+
+static bool enter_current_heap(_HeapManager * pHeap, _HeapManager ** ppOuterHeap)
+{
+	*ppOuterHeap = pCurrentHeap;
+	pCurrentHeap = pHeap;
+
+	return true;
+}
+
+static void leave_current_heap(_HeapManager * pOuterHeap)
+{
+	pCurrentHeap = pOuterHeap;
+}
+
+void * operator new (size_t sz, _CurrentHeapManager, int noBuffer)
+{
+	_HeapManager * const pHeap = pCurrentHeap;
+
+	DASSERT(pHeap);
+
+	return operator new(sz, *pHeap, noBuffer);
+}
+
+#endif
 
-Replicator * UnDecorator::pArgList;
-Replicator * UnDecorator::pZNameList;
-Replicator * UnDecorator::pTemplateArgList;
-pcchar_t UnDecorator::gName;
-pcchar_t UnDecorator::name;
-unsigned long UnDecorator::disableFlags;
-GetParameter_t UnDecorator::m_pGetParameter;
-bool UnDecorator::fExplicitTemplateParams;
-bool UnDecorator::fGetTemplateArgumentList;
-unsigned long UnDecorator::m_CHPENameOffset;
-unsigned long UnDecorator::m_recursionLevel;
+void * operator new[] (size_t sz, _CurrentHeapManager, int noBuffer)
+{
+	return operator new(sz, heap, noBuffer);
+}
 
 pchar_t __cdecl unDNameGenerateCHPE (
     _When_(pAlloc, _Out_writes_opt_z_(maxStringLength)) pchar_t outputString,
@@ -800,11 +1059,34 @@ pchar_t __cdecl unDNameGenerateCHPE (
         return 0;
 
     pchar_t chpeName = nullptr;
+    char arena[defaultArenaSize];
+
+    _HeapManager callHeap;
+    callHeap.Constructor(pAlloc, pFree, arena, sizeof(arena));
+
+    _HeapManager* pOuterHeap;
+    if (!enter_current_heap(&callHeap, &pOuterHeap))
+    {
+        callHeap.Destructor();
+        return nullptr;
+    }
 
-    heap.Constructor(pAlloc, pFree);
-    UnDecorator unDecorate(name, nullptr, disableFlags);
-    chpeName = unDecorate.getCHPEName(outputString, maxStringLength);
-    heap.Destructor();
+#ifdef _VCRT_BUILD
+    __try
+    {
+#endif
+        UnDecorator unDecorate(callHeap, name, nullptr, disableFlags);
+        chpeName = unDecorate.getCHPEName(outputString, maxStringLength);
+#ifdef _VCRT_BUILD
+    }
+    __finally
+    {
+#endif
+        leave_current_heap(pOuterHeap);
+        callHeap.Destructor();
+#ifdef _VCRT_BUILD
+    }
+#endif
 
     return chpeName;
 }
@@ -878,6 +1160,39 @@ pchar_t __UNDNAME_IMP __cdecl __UNDNAME_NAME_EX(
  *	memory, or an internal error occurred, and was unable to complete its task.
  */
 
+{
+	char arena[defaultArenaSize];
+
+	return __UNDNAME_NAME_ARENA(outputString, name, maxStringLength, pAlloc, pFree,
+                                pGetParameter, disableFlags, arena, sizeof(arena));
+
+}	// End of FUNCTION "unDName"
+
+
+
+
+pchar_t __UNDNAME_IMP __cdecl __UNDNAME_NAME_ARENA(
+	_When_(pAlloc, _Out_writes_opt_z_(maxStringLength)) pchar_t outputString,
+	pcchar_t name,
+	int maxStringLength,	// Note, COMMA is leading following optional arguments
+	Alloc_t pAlloc,
+	Free_t pFree,
+	GetParameter_t pGetParameter,
+	unsigned long disableFlags,
+	_Out_writes_bytes_opt_(arenaSize) void * arena,
+	size_t arenaSize
+
+)
+/*
+ *	As 'unDNameEx', but the working storage of the undecorator is carved from
+ *	'arena' (typically a buffer on the caller's stack) until it is exhausted,
+ *	and only then from 'pAlloc'.  The arena is not used for the returned name.
+ *
+ *	Every call has its own heap and undecorator state, so this may be called
+ *	concurrently from any number of threads, and reentrantly from within
+ *	'pAlloc', 'pFree' or 'pGetParameter'.
+ */
+
 {
 	//	Must have an allocator and a deallocator (and we MUST trust them)
 
@@ -886,54 +1201,70 @@ pchar_t __UNDNAME_IMP __cdecl __UNDNAME_NAME_EX(
 
 	pchar_t unDecoratedName = nullptr;
 
+	_HeapManager callHeap;
+	callHeap.Constructor(pAlloc, pFree, arena, arenaSize);
+
+	_HeapManager * pOuterHeap;
+	if (!enter_current_heap(&callHeap, &pOuterHeap))
+	{
+		callHeap.Destructor();
+		return nullptr;
+	}
+
+	//	The heap is released even if 'pAlloc' or 'pGetParameter' raises, so
+	//	that the thread's slot is not lost to it
+
 #ifdef _VCRT_BUILD
-	__vcrt_lock(__vcrt_undname_lock);
 	__try
 	{
 #endif
 
-		heap.Constructor(pAlloc, pFree);
-
 		//	Create the undecorator object, and get the result
 
-		UnDecorator unDecorate(name, pGetParameter, disableFlags);
+		UnDecorator unDecorate(callHeap, name, pGetParameter, disableFlags);
 		unDecoratedName = unDecorate.getUndecoratedName(outputString, maxStringLength);
 
+#ifdef _VCRT_BUILD
+	}
+	__finally
+	{
+#endif
 
 		// Destruct the heap (would use a destructor, but that causes DLL problems)
 
-		heap.Destructor();
+		leave_current_heap(pOuterHeap);
+		callHeap.Destructor();
 
 #ifdef _VCRT_BUILD
 	}
-	__finally
-	{
-		__vcrt_unlock(__vcrt_undname_lock);
-	}
 #endif
 
 	//	And return the composed name
 
 	return unDecoratedName;
 
-}	// End of FUNCTION "unDName"
+}	// End of FUNCTION "unDNameInArena"
 
 //	The 'UnDecorator' member functions
 
 inline UnDecorator::UnDecorator(
+	_HeapManager & callHeap,
 	pcchar_t dName,
 	GetParameter_t pGetParameter,
 	unsigned long disable
 )
+	: heap(callHeap)
 {
 	name = dName;
 	gName = name;
 
 	pZNameList = &ZNameList;
 	pArgList = &ArgList;
+	pTemplateArgList = nullptr;
 	disableFlags = disable;
 	m_pGetParameter = pGetParameter;
 	fExplicitTemplateParams = false;
+	fGetTemplateArgumentList = false;
     m_CHPENameOffset = 0;
     m_recursionLevel = 0;
 
@@ -1136,13 +1467,14 @@ DName UnDecorator::getDecoratedName(void)
     // Setup a C++ object that will count recursive invocations of this
     // function.
     struct TrackRecursion {
-        TrackRecursion() {
-            m_recursionLevel += 1;
+        unsigned long & level;
+        explicit TrackRecursion(unsigned long & recursionLevel) : level(recursionLevel) {
+            level += 1;
         }
         ~TrackRecursion() {
-            m_recursionLevel -= 1;
+            level -= 1;
         }
-    } trackRecursion;
+    } trackRecursion(m_recursionLevel);
 
 	//	Ensure that it is intended to be a decorated name
 
@@ -1387,11 +1719,18 @@ DName UnDecorator::getZName(bool fUpdateCachedNames, bool fAllowEmptyName)
 				zName = DName();
 				increment_buffer_no_check();
 			}
+			else if (*gName == '<')
+			{
+				//	Compiler-generated names, '<lambda_1>', '<unnamed-type-x>'
+				//	and the like, are printed as they are
+
+				zName = DName(gName, '@', false);
+			}
 			else
 			{
 				//	Extract the 'zname' to the terminator
 
-				zName = DName(gName, '@');	// This constructor updates 'name'
+				zName = DName(gName, '@', !doNoIdentCharCheck());	// This constructor updates 'name'
 			}
 		}
 
@@ -1914,7 +2253,7 @@ DName UnDecorator::getScope(void)
 				// skip the (unreadable) name and instead insert
 				// an appropriate string
 				//
-				DName namespaceName = DName(gName, '@');
+				DName namespaceName = DName(gName, '@', !doNoIdentCharCheck());
 
 				scope = "`anonymous namespace'"_l + scope;
 
@@ -2088,9 +2427,16 @@ template<typename T>
 static auto get_encoding(uint64_t representation)
 {
 	T value = *reinterpret_cast<T*>(&representation);
-	auto required_size = snprintf(nullptr, 0, "%lf", value) + 1;
-	auto* buffer = gnew char[required_size];
-	sprintf_s(buffer, required_size, "%lf", value);
+
+	//	"%lf" of the largest double is 317 characters
+
+	char text[320];
+	sprintf_s(text, _countof(text), "%lf", static_cast<double>(value));
+
+	auto* buffer = gnew char[strlen(text) + 1];
+	if (!buffer)
+		return DName(DN_error);
+	memcpy(buffer, text, strlen(text) + 1);
 	return DName(buffer, StringLifeSelector<StringLife::Temporary>{ });
 }
 
@@ -2147,6 +2493,11 @@ DName UnDecorator::getValueObject()
 			encoding += ',';
 		}
 
+		if (*gName == '\0')
+		{
+			return DName(DN_truncated);		// A truncated member would otherwise never end the list
+		}
+
 		switch (*gName)
 		{
 		case TC_value_object:
@@ -54,6 +54,26 @@ _CRTIMP pchar_t __cdecl __unDNameEx(
         GetParameter_t,	// Function to get any template parameters
         unsigned long	// Feature disable flags
     );
+
+#ifdef  __cplusplus
+extern "C"
+#endif
+
+#ifdef _VCRT_BUILD
+_CRTIMP pchar_t __cdecl __unDNameInArena(
+#else
+    pchar_t __cdecl unDNameInArena(
+#endif
+        pchar_t,		// User supplied buffer (or NULL)
+        pcchar_t,		// Input decorated name
+        int,			// Maximum length of user buffer
+        Alloc_t,		// Address of heap allocator
+        Free_t,			// Address of heap deallocator
+        GetParameter_t,	// Function to get any template parameters
+        unsigned long,	// Feature disable flags
+        void*,			// Working storage used before the heap (or NULL)
+        size_t			// Size of the working storage
+    );
 /*
  *  The user may provide a buffer into which the undecorated declaration
  *  is to be placed, in which case, the length field must be specified.
@@ -72,6 +92,12 @@ _CRTIMP pchar_t __cdecl __unDNameEx(
  *  If the allocator address is NULL, then the routine will default to using
  *  the standard allocator and deallocator functions, 'malloc' and 'free'.
  *
+ *  The undecorator keeps all of its state per call, so the routines may be
+ *  used concurrently.  'unDNameInArena' additionally takes a caller buffer
+ *  (usually on the stack) that serves the working storage before the heap
+ *  is touched; the undecorated name itself always comes from the heap when
+ *  no user buffer is given.
+ *
  *  If an error occurs internally, then the routine will return NULL.  If
  *  it was successful, it will return the buffer address provided by the
  *  user, or the address of the buffer allocated on their behalf, if they
@@ -108,4 +134,5 @@ _CRTIMP pchar_t __cdecl __unDNameEx(
 #define UNDNAME_NO_ECSU                 (0x8000)    // Suppress enum/class/struct/union
 #define UNDNAME_NO_IDENT_CHAR_CHECK     (0x10000)   // Suppress check for IsValidIdentChar
 #define UNDNAME_NO_PTR64                (0x20000)   // disable just ptr64 in output
+#define UNDNAME_NO_ELLIPSIS             (0x40000)   // Print '<ellipsis>' rather than '...' for variadic arguments
 
@@ -107,6 +107,16 @@
 
 #define OC_ehvcctor			((unsigned char)'C')
 #define OC_ehvcctorvb		((unsigned char)'D')
+#define OC_staticinit		((unsigned char)'E')	// dynamic initializer
+#define OC_staticatexit		((unsigned char)'F')	// dynamic atexit destructor
+#define OC_vec_copy_ctor	((unsigned char)'G')
+#define OC_vec_copy_ctor_vb	((unsigned char)'H')
+#define OC_man_vec_copy_ctor ((unsigned char)'I')
+#define OC_thread_guard		((unsigned char)'J')	// local static thread guard
+#define OC_udl				((unsigned char)'K')	// operator "" (user-defined literal)
+#define OC_await			((unsigned char)'L')	// operator co_await
+#define OC_spaceship		((unsigned char)'M')	// operator <=>
+#define OC_NTTP_class_type	((unsigned char)'N')	// template parameter object
 
 //	Values for the 'type-encoding'
 
@@ -157,6 +167,9 @@
 #define	TE_isvtoradj(t)			(TE_ismember(t)&&(((t)&0x0700)==0x0500))
 #define	TE_setisvtoradj(t)		((t)=(((t)&~0x0700)|0x0500))
 
+#define	TE_isvtoradjex(t)		(TE_ismember(t)&&(((t)&0x0700)==0x0600))
+#define	TE_setisvtoradjex(t)	((t)=(((t)&~0x0700)|0x0600))
+
 #define	TE_ispublic(t)			(TE_ismember(t)&&(TE_isfunction(t)?(((t)&0x00C0)==0x0000):(((t)&0x1800)==0x0000)))
 #define	TE_setispublic(t)		((t)=(TE_isfunction(t)?((t)&~0x00C0):((t)&~0x1800)))
 
@@ -194,6 +207,13 @@
 #define	TE_isglobal(t)			(TE_isdata(t)&&(((t)&0x6000)==0x4000))
 #define	TE_setisglobal(t)		((t)=(((t)&~0x6000)|0x4000))
 
+#define	TE_isexternc(t)			(!TE_isbadtype(t)&&!TE_istruncated(t)&&!TE_isCident(t)&&((t)&0x0020))
+#define	TE_setisisexternc(t)	((t)|=0x0020)
+
+//	A structured binding has no type of its own; it is printed as its name
+
+#define	TE_setisstructuredbinding(t)	TE_setisCident(t)
+
 
 #define	TE_member		((unsigned char)0)
 #define	TE_static		((unsigned char)2)
@@ -229,6 +249,7 @@
 #define	TE_vbtable		((unsigned char)'7')
 #define	TE_metatype		((unsigned char)'8')
 #define	TE_vcall		((unsigned char)'9')
+#define	TE_structured_binding	((unsigned char)'a')
 
 //	Values for the 'data-indirect-type'
 
@@ -246,8 +267,17 @@
 #define	DIT_ptr64		((unsigned char)0x04)
 #define	DIT_unaligned	((unsigned char)0x05)
 
+#define	DIT_lref		((unsigned char)0x06)	// '&' ref-qualifier on 'this'
+#define	DIT_rref		((unsigned char)0x07)	// '&&' ref-qualifier on 'this'
+
 #define	DIT_restrict	((unsigned char)0x08)
 
+//	Values for the C++/CLI indirections, prefixed by '$'
+
+#define	DIT_GCPointer		'A'
+#define	DIT_PinPointer		'B'
+#define	DIT_InteriorPointer	'C'
+
 //	Values for the 'calling-convention'
 
 #define	CC_cdecl		((unsigned char)0x00)
@@ -257,6 +287,13 @@
 #define	CC_fastcall		((unsigned char)0x08)
 #define	CC_interrupt	((unsigned char)0x0A)
 #define	CC_cocall		((unsigned char)0x0C)
+#define	CC_eabi			((unsigned char)0x0E)
+#define	CC_vectorcall	((unsigned char)0x10)
+#define	CC_swift_1		((unsigned char)0x12)
+#define	CC_swift_2		((unsigned char)0x14)
+#define	CC_swift_3		((unsigned char)0x16)
+
+#define	CC_last			((unsigned char)0x17)
 
 #define	CC_saveregs		((unsigned char)0x01)
 
@@ -284,6 +321,15 @@
 #define PDT_ex_function			'A'
 #define PDT_ex_other			'B'
 #define PDT_ex_qualified		'C'
+#define PDT_ex_rvalue_ref		'Q'
+#define PDT_ex_vol_rvalue_ref	'R'
+#define PDT_ex_nullptr			'S'
+#define PDT_ex_nullptr_t		'T'
+#define PDT_empty				'V'		// a pack expanded to nothing
+#define PDT_placeHolder			'W'
+#define PDT_packExpansion		'X'
+#define PDT_aliasTemplate		'Y'
+#define PDT_terminator			'Z'
 
 //	Values for com+ pointer types __gc and __pin
 
@@ -292,6 +338,8 @@
 
 //	Values for the 'basic-data-type'
 
+#define	BDT_void		'X'
+
 #define	BDT_unsigned	0x01
 
 #define	BDT_const		0x01
@@ -324,6 +372,14 @@
 #define	BDT_bool		'N'
 #define BDT_array		'O'
 #define	BDT_wchar_t		'W'
+#define	BDT_char8_t		'Q'
+#define	BDT_unknown		'R'
+#define	BDT_char16_t	'S'
+#define	BDT_char32_t	'U'
+#define	BDT_auto		'P'
+#define	BDT_decltypeAuto	'T'
+#define	BDT_explicit_object	'V'		// deduced 'this' parameter
+#define	BDT_boxed		'Z'		// '__Z': a boxed value type
 #if CC_COR
 #define BDT_coclass		'X'
 #define BDT_cointerface	'Y'
@@ -349,6 +405,11 @@
 #define	FIT_based	0x04
 
 
+//	Values for the 'function-type' suffixes, prefixed by '_'
+
+#define	FT_noexcept	'E'
+
+
 //	Values for the 'function-indirect-type'
 
 #define	AT_void			'X'
@@ -421,6 +482,30 @@
 #define TC_gptmf	'J'
 #define TC_nontype_dummy 'Q'
 
+//	Class type and floating point non-type template arguments
+
+#define	TC_value_object			'2'
+#define	TC_array_object			'3'
+#define	TC_address_of			'4'
+#define	TC_string_object		'5'
+#define	TC_member_access		'6'
+#define	TC_union_object			'7'
+#define	TC_array_access			'8'
+#define	TC_pointer_to_member	'9'
+#define	TC_float				'A'
+#define	TC_double				'B'
+#define	TC_lambda				'L'
+#define	TC_auto					'M'		// followed by the deduced type
+#define	TC_null_pointer_to_member	'N'
+#define	TC_empty				'S'		// an empty non-type pack
+
+//	Template and generic parameters referenced from a specialization
+
+#define	TC_generic_class_parameter		'R'
+#define	TC_template_type_parameter		'T'
+#define	TC_generic_method_parameter		'U'
+#define	TC_template_type_parameter_pack	'V'
+
 //
 // Encoding for special help function
 //
@@ -440,4 +525,6 @@
 #define SHF_CManagedILDLLImportData			'N'
 #define SHF_CManagedNativeDLLImportData		'O'
 #define SHF_AnyDLLImportMethod				'P'
-
+#define SHF_VtorDispThunkEx					'R'		// after '$', not '$$'
+#define MGD_AppDomain						'Q'
+#define SHF_Hybrid							'h'		// ARM64EC (CHPE) name
@@ -0,0 +1,783 @@
+//	The string composition support classes for the undecorator.
+//
+//	A DName is a (status, node) pair; the node is an immutable tree of the
+//	pieces of text making up the name.  Appending to a DName never modifies
+//	an existing node, it allocates a 'pairNode' joining the old tree with the
+//	new piece, so DNames may be copied shallowly and shared freely.  All of
+//	the nodes live in the heap of the undecoration running on this thread,
+//	and go away with it.
+//
+//	Appending builds left-deep trees (one level per append), so the walks
+//	over them are iterative along the left spine; recursion only follows the
+//	right-hand branches, whose depth is bounded by the nesting of the name.
+
+
+#define TruncationMessage		" ?? "
+#define TruncationMessageLength	4
+
+
+class pairNode;
+
+class DNameNode
+{
+public:
+	virtual int length() const PURE;
+	virtual char getLastChar() const PURE;
+
+	// Writes the first min(end - buf, length()) characters at 'buf' and
+	// returns the position after the last one written.
+	virtual pchar_t getString(pchar_t buf, pchar_t end) const PURE;
+
+	virtual const pairNode * asPair() const { return nullptr; }
+
+	// True if the length may still change, i.e. the tree refers to a DName
+	// that may still be assigned to.
+	virtual bool isIndirect() const { return false; }
+};
+
+
+class charNode : public DNameNode
+{
+private:
+	char me;
+
+public:
+	explicit charNode(char ch) : me(ch) {}
+
+	int length() const override { return 1; }
+	char getLastChar() const override { return me; }
+
+	pchar_t getString(pchar_t buf, pchar_t end) const override
+	{
+		if (buf < end)
+			*buf++ = me;
+
+		return buf;
+	}
+};
+
+
+class pcharNode : public DNameNode
+{
+private:
+	pcchar_t me;
+	int myLen;
+
+public:
+	pcharNode(pcchar_t str, int len) : me(str), myLen(len) {}
+
+	int length() const override { return myLen; }
+	char getLastChar() const override { return myLen ? me[myLen - 1] : '\0'; }
+
+	pchar_t getString(pchar_t buf, pchar_t end) const override
+	{
+		int len = myLen;
+		if (len > end - buf)
+			len = static_cast<int>(end - buf);
+
+		if (len > 0)
+		{
+			und_memcpy(buf, me, static_cast<unsigned int>(len));
+			buf += len;
+		}
+
+		return buf;
+	}
+};
+
+
+class pDNameNode : public DNameNode
+{
+private:
+	DName * me;
+
+public:
+	explicit pDNameNode(DName * pName) : me(pName) {}
+
+	int length() const override { return me->length(); }
+	char getLastChar() const override { return me->getLastChar(); }
+	pchar_t getString(pchar_t buf, pchar_t end) const override { return me->getString(buf, end); }
+	bool isIndirect() const override { return true; }
+};
+
+
+class DNameStatusNode : public DNameNode
+{
+private:
+	DNameStatus me;
+	int myLen;
+
+public:
+	explicit DNameStatusNode(DNameStatus stat)
+		: me(stat), myLen((stat == DN_truncated) ? TruncationMessageLength : 0)
+	{
+	}
+
+	int length() const override { return myLen; }
+	char getLastChar() const override { return myLen ? TruncationMessage[myLen - 1] : '\0'; }
+
+	pchar_t getString(pchar_t buf, pchar_t end) const override
+	{
+		for (int i = 0; i < myLen && buf < end; ++i)
+			*buf++ = TruncationMessage[i];
+
+		return buf;
+	}
+};
+
+
+class pairNode : public DNameNode
+{
+private:
+	const DNameNode * left;
+	const DNameNode * right;
+	int myLen;				// Only meaningful if !indirect
+	bool indirect;
+
+public:
+	pairNode(const DNameNode * l, const DNameNode * r)
+		: left(l), right(r), myLen(0), indirect(l->isIndirect() || r->isIndirect())
+	{
+		//	Neither side can change, and the left side already knows its
+		//	length, so this is O(1) except for right-hand indirections
+
+		if (!indirect)
+			myLen = l->length() + r->length();
+	}
+
+	int length() const override
+	{
+		int len = 0;
+		const DNameNode * pNode = this;
+
+		while (const pairNode * pPair = pNode->asPair())
+		{
+			if (!pPair->indirect)
+				return len + pPair->myLen;
+
+			len += pPair->right->length();
+			pNode = pPair->left;
+		}
+
+		return len + pNode->length();
+	}
+
+	char getLastChar() const override
+	{
+		const DNameNode * pNode = this;
+
+		while (const pairNode * pPair = pNode->asPair())
+		{
+			if (pPair->right->length())
+				return pPair->right->getLastChar();
+
+			pNode = pPair->left;
+		}
+
+		return pNode->getLastChar();
+	}
+
+	pchar_t getString(pchar_t buf, pchar_t end) const override
+	{
+		//	Fill from the right: each right-hand piece lands after everything
+		//	on its left, and is clipped (or skipped) if it falls past 'end'
+
+		int curLen = length();
+		int limit = static_cast<int>(end - buf);
+		if (limit > curLen)
+			limit = curLen;
+
+		pchar_t const result = buf + limit;
+		const DNameNode * pNode = this;
+
+		while (const pairNode * pPair = pNode->asPair())
+		{
+			int const leftLen = curLen - pPair->right->length();
+
+			if (limit > leftLen)
+			{
+				pPair->right->getString(buf + leftLen, buf + limit);
+				limit = leftLen;
+			}
+
+			curLen = leftLen;
+			pNode = pPair->left;
+		}
+
+		pNode->getString(buf, buf + limit);
+
+		return result;
+	}
+
+	const pairNode * asPair() const override { return this; }
+	bool isIndirect() const override { return indirect; }
+};
+
+
+
+//	The 'DName' constructors
+
+inline DName::DName()
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+}
+
+inline DName::DName(const DName & rd)
+{
+	node = rd.node;
+	value = rd.value;
+}
+
+inline DName::DName(char ch)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	if (ch)
+		doPchar(ch);
+}
+
+inline DName::DName(const StringLiteral & s)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	doPchar<StringLife::Persistent>(s.str, s.len);
+}
+
+template<StringLife life>
+inline DName::DName(pcchar_t s, StringLifeSelector<life>)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	if (s)
+		doPchar<life>(s, static_cast<int>(und_strlen(s)));
+}
+
+DName::DName(pcchar_t & name, char terminator, bool fCheckIdentChars)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	if (!name)
+	{
+		stat = DN_invalid;
+		return;
+	}
+
+	if (!*name)
+	{
+		stat = DN_truncated;
+		return;
+	}
+
+	//	Measure the fragment, checking the characters on the way
+
+	pcchar_t const s = name;
+	int len = 0;
+
+	for (; *name && (*name != terminator); ++name, ++len)
+	{
+		if (fCheckIdentChars && !isValidIdentChar(*name))
+		{
+			stat = DN_invalid;
+			return;
+		}
+	}
+
+	//	The input outlives the undecoration, so refer to it in place
+
+	doPchar<StringLife::Persistent>(s, len);
+
+	//	Now gobble the terminator if present
+
+	if (*name)
+		++name;
+	elif (status() == DN_valid)
+		stat = DN_truncated;
+}
+
+inline DName::DName(DNameStatus st)
+{
+	node = 0;
+	value = 0;
+	stat = st;
+
+	if (st == DN_truncated)
+		append(gnew DNameStatusNode(st));
+}
+
+inline DName::DName(DName * pd)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	if (pd)
+		append(gnew pDNameNode(pd));
+}
+
+DName::DName(unsigned __int64 num)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	char buf[21];
+	pchar_t pBuf = buf + _countof(buf);
+
+	do
+	{
+		*--pBuf = static_cast<char>((num % 10) + '0');
+		num /= 10;
+	} while (num);
+
+	doPchar<StringLife::Temporary>(pBuf, static_cast<int>(buf + _countof(buf) - pBuf));
+}
+
+DName::DName(__int64 num)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	char buf[21];
+	pchar_t pBuf = buf + _countof(buf);
+
+	//	Work with the magnitude as unsigned so that the most negative value works
+
+	unsigned __int64 magnitude = (num < 0) ? (0 - static_cast<unsigned __int64>(num)) : static_cast<unsigned __int64>(num);
+
+	do
+	{
+		*--pBuf = static_cast<char>((magnitude % 10) + '0');
+		magnitude /= 10;
+	} while (magnitude);
+
+	if (num < 0)
+		*--pBuf = '-';
+
+	doPchar<StringLife::Temporary>(pBuf, static_cast<int>(buf + _countof(buf) - pBuf));
+}
+
+
+
+//	Now the member functions for 'DName'
+
+inline int DName::isValid() const { return ((status() == DN_valid) || (status() == DN_truncated)); }
+inline int DName::isEmpty() const { return ((node == 0) || !isValid()); }
+inline DNameStatus DName::status() const { return static_cast<DNameStatus>(stat); }
+inline void DName::clearStatus() { stat = DN_valid; }
+
+inline DName & DName::setPtrRef() { isIndir = 1; return *this; }
+inline int DName::isPtrRef() const { return isIndir; }
+inline int DName::isUDC() const { return (!isEmpty() && isAUDC); }
+inline void DName::setIsUDC() { if (!isEmpty()) isAUDC = TRUE; }
+inline int DName::isUDTThunk() const { return (!isEmpty() && isAUDTThunk); }
+inline void DName::setIsUDTThunk() { if (!isEmpty()) isAUDTThunk = TRUE; }
+inline int DName::isArray() const { return isArrayType; }
+inline void DName::setIsArray() { isArrayType = 1; }
+inline int DName::isNoTE() const { return NoTE; }
+inline void DName::setIsNoTE() { NoTE = TRUE; }
+inline int DName::isPinPtr() const { return pinPtr; }
+inline void DName::setIsPinPtr() { pinPtr = TRUE; }
+inline int DName::isComArray() const { return comArray; }
+inline void DName::setIsComArray() { comArray = TRUE; }
+inline int DName::isVCallThunk() const { return vcallThunk; }
+inline void DName::setIsVCallThunk() { vcallThunk = TRUE; }
+
+int DName::length() const
+{
+	return isEmpty() ? 0 : node->length();
+}
+
+char DName::getLastChar() const
+{
+	return isEmpty() ? '\0' : node->getLastChar();
+}
+
+pchar_t DName::getString(_Inout_z_cap_(max) pchar_t buf, int max) const
+{
+	if (!isEmpty())
+	{
+		//	Does the caller want a buffer allocated ?
+
+		if (!buf)
+		{
+			max = length() + 1;
+			buf = gnew char[max];
+		}
+
+		//	If memory allocation failure, then return no buffer
+
+		if (buf && (max > 0))
+			*node->getString(buf, buf + max - 1) = '\0';
+	}
+	elif (buf && (max > 0))
+		*buf = '\0';
+
+	return buf;
+}
+
+pchar_t DName::getString(_In_z_ pchar_t buf, _In_ pchar_t end) const
+{
+	return isEmpty() ? buf : node->getString(buf, end);
+}
+
+
+//	Composition never revives a DName that has gone bad, so that an error
+//	anywhere in a name propagates to the final result
+
+DName DName::operator + (const StringLiteral & s) const
+{
+	DName local(*this);
+
+	local += s;
+
+	return local;
+}
+
+DName DName::operator + (const DName & rd) const
+{
+	DName local(*this);
+
+	local += rd;
+
+	return local;
+}
+
+DName DName::operator + (char ch) const
+{
+	DName local(*this);
+
+	local += ch;
+
+	return local;
+}
+
+DName DName::operator + (DName * pd) const
+{
+	DName local(*this);
+
+	local += pd;
+
+	return local;
+}
+
+DName DName::operator + (DNameStatus st) const
+{
+	DName local(*this);
+
+	local += st;
+
+	return local;
+}
+
+
+DName & DName::operator += (char ch)
+{
+	if (ch && isValid())
+	{
+		if (isEmpty())
+			*this = ch;
+		else
+			doPchar(ch);
+	}
+
+	return *this;
+}
+
+DName & DName::operator += (const StringLiteral & s)
+{
+	if (s.len && isValid())
+	{
+		if (isEmpty())
+			*this = s;
+		else
+			doPchar<StringLife::Persistent>(s.str, s.len);
+	}
+
+	return *this;
+}
+
+DName & DName::operator += (DName * pd)
+{
+	if (pd && isValid())
+	{
+		if (isEmpty())
+			*this = pd;
+		elif (pd->isValid())
+			append(gnew pDNameNode(pd));
+		else
+			*this += pd->status();
+	}
+
+	return *this;
+}
+
+DName & DName::operator += (DNameStatus st)
+{
+	if (!isValid())
+	{
+		if (st == DN_error)
+			stat = DN_error;
+	}
+	elif (isEmpty() || (st == DN_invalid) || (st == DN_error))
+		*this = st;
+	elif (st == DN_truncated)
+		append(gnew DNameStatusNode(st));
+
+	return *this;
+}
+
+DName & DName::operator += (const DName & rd)
+{
+	if (rd.isEmpty())
+		*this += rd.status();
+	elif (!isValid())
+		;
+	elif (isEmpty())
+		*this = rd;
+	else
+		append(rd.node);
+
+	return *this;
+}
+
+
+DName & DName::operator |= (const DName & rd)
+{
+	//	Attenuate the error status.  Always becomes worse.  Don't propagate truncation
+
+	if ((status() != DN_error) && !rd.isValid())
+		stat = rd.status();
+
+	return *this;
+}
+
+
+//	Assignment replaces the text, the status and the flags
+
+DName & DName::operator = (const StringLiteral & s)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	doPchar<StringLife::Persistent>(s.str, s.len);
+
+	return *this;
+}
+
+DName & DName::operator = (const DName & rd)
+{
+	node = rd.node;
+	value = rd.value;
+
+	return *this;
+}
+
+DName & DName::operator = (char ch)
+{
+	node = 0;
+	value = 0;
+	stat = DN_valid;
+
+	if (ch)
+		doPchar(ch);
+
+	return *this;
+}
+
+DName & DName::operator = (DName * pd)
+{
+	node = 0;
+	value = 0;
+
+	if (pd)
+	{
+		stat = DN_valid;
+		append(gnew pDNameNode(pd));
+	}
+	else
+		stat = DN_error;
+
+	return *this;
+}
+
+DName & DName::operator = (DNameStatus st)
+{
+	node = 0;
+	value = 0;
+	stat = st;
+
+	if (st == DN_truncated)
+		append(gnew DNameStatusNode(st));
+
+	return *this;
+}
+
+
+//	Private implementation functions for 'DName'
+
+template<typename T>
+void DName::append(const T * newRight)
+{
+	if (!newRight)
+	{
+		node = 0;
+		stat = DN_error;		// Oh-oh!  Memory allocation failure
+		return;
+	}
+
+	if (!node)
+	{
+		node = newRight;
+		return;
+	}
+
+	const DNameNode * pNew = gnew pairNode(node, newRight);
+
+	if (pNew)
+		node = pNew;
+	else
+	{
+		node = 0;
+		stat = DN_error;
+	}
+}
+
+void DName::doPchar(char ch)
+{
+	append(gnew charNode(ch));
+}
+
+template<StringLife life>
+void DName::doPchar(pcchar_t str, int len)
+{
+	if (!str || (len <= 0))
+		return;
+
+	if (len == 1)
+	{
+		doPchar(*str);
+		return;
+	}
+
+	if constexpr (life != StringLife::Persistent)
+	{
+		//	Take a copy; the caller's storage goes away before the result is composed
+
+		pchar_t copy = gnew char[len];
+		if (!copy)
+		{
+			node = 0;
+			stat = DN_error;
+			return;
+		}
+
+		und_memcpy(copy, str, static_cast<unsigned int>(len));
+		str = copy;
+	}
+
+	append(gnew pcharNode(str, len));
+}
+
+
+//	Friends of 'DName'
+
+DName operator + (const StringLiteral & s, const DName & rd)
+{
+	return DName(s) + rd;
+}
+
+DName operator + (char ch, const DName & rd)
+{
+	return DName(ch) + rd;
+}
+
+DName operator + (DNameStatus st, const DName & rd)
+{
+	return DName(st) + rd;
+}
+
+
+
+//	The 'Replicator' keeps the (up to ten) names that later parts of the
+//	decorated name may refer back to by index
+
+inline Replicator::Replicator()
+{
+	index = -1;
+}
+
+inline int Replicator::isFull() const
+{
+	return (index == 9);
+}
+
+Replicator & Replicator::operator += (const DName & rd)
+{
+	if (!isFull() && !rd.isEmpty())
+	{
+		DName * pNew = gnew DName(rd);
+
+		//	Don't update if failed
+
+		if (pNew)
+			dNameBuffer[++index] = pNew;
+	}
+
+	return *this;
+}
+
+DName Replicator::operator [] (int x) const
+{
+	if ((x < 0) || (x > 9))
+		return DName(DN_error);
+	elif ((index == -1) || (x > index))
+		return DName(DN_invalid);
+	else
+		return *dNameBuffer[x];
+}
+
+
+
+//	Local string helpers, so as not to depend on the library being built
+
+static unsigned int und_strlen(pcchar_t str)
+{
+	unsigned int len;
+
+	for (len = 0; *str; str++)
+		len++;
+
+	return len;
+}
+
+static void und_memcpy(_Out_bytecap_(len) pchar_t dst, pcchar_t src, unsigned int len)
+{
+	while (len--)
+		*dst++ = *src++;
+}
+
+static unsigned int und_strncmp(pcchar_t first, pcchar_t last, unsigned int count)
+{
+	if (!count)
+		return 0;
+
+	while (--count && *first && *first == *last)
+	{
+		first++;
+		last++;
+	}
+
+	return (*(unsigned char *)first - *(unsigned char *)last);
+}
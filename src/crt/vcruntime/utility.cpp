@@ -6,6 +6,8 @@
 // Common functionality shared by both the EXE and DLL startup code.
 //
 #include <vcstartup_internal.h>
+#include <vcruntime_internal.h>
+#include <kext/kstartup.h>
 #include <limits.h>
 
 
@@ -165,11 +167,13 @@ extern "C" bool __cdecl __scrt_initialize_crt()
         return false;
     }
 
+    LONGLONG const acrt_start = __scrt_startup_phase_begin();
     if (!__acrt_initialize())
     {
         __vcrt_uninitialize(false);
         return false;
     }
+    __scrt_startup_phase_end(__ucxxrt_phase_initialize_acrt, acrt_start);
 
     return true;
 }
@@ -71,6 +71,47 @@ bool __cdecl __vcrt_uninitialize_ptd(void);
 bool __cdecl __vcrt_initialize_locks(void);
 bool __cdecl __vcrt_uninitialize_locks(void);
 
+bool __cdecl __vcrt_initialize_thread_safe_statics(void);
+
+bool __cdecl __vcrt_initialize_eh_cache(void);
+bool __cdecl __vcrt_uninitialize_eh_cache(void);
+
+bool __cdecl __vcrt_initialize_eh_telemetry(void);
+bool __cdecl __vcrt_uninitialize_eh_telemetry(void);
+
+
+
+//-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//
+// Startup Timing
+//
+//-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Phases are the __ucxxrt_startup_phase enumerators of kext/kstartup.h.
+extern bool __scrt_startup_timing;
+
+void __cdecl __scrt_initialize_startup_timing(void);
+void __cdecl __scrt_record_startup_phase(int _Phase, LONGLONG _Start);
+void __cdecl __scrt_record_initializer(void const* _Function, LONGLONG _Start);
+void __cdecl __scrt_report_startup_timing(void);
+void __cdecl __scrt_finish_startup_timing(void);
+
+int  __cdecl __scrt_initterm_e(_PIFV* _First, _PIFV* _Last);
+void __cdecl __scrt_initterm(_PVFV* _First, _PVFV* _Last);
+
+// Returns the start of a phase, or zero if timing is off.
+static __forceinline LONGLONG __cdecl __scrt_startup_phase_begin(void)
+{
+    return __scrt_startup_timing ? KeQueryPerformanceCounter(NULL).QuadPart : 0;
+}
+
+static __forceinline void __cdecl __scrt_startup_phase_end(int const _Phase, LONGLONG const _Start)
+{
+    if (_Start != 0)
+    {
+        __scrt_record_startup_phase(_Phase, _Start);
+    }
+}
+
 
 
 //-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -232,6 +273,25 @@ BOOL __cdecl _ValidateImageBase(PBYTE pImageBase);
 PIMAGE_SECTION_HEADER __cdecl _FindPESection(PBYTE pImageBase, DWORD_PTR rva);
 BOOL __cdecl _IsNonwritableInCurrentImage(void const* pTarget);
 
+#if defined _M_X64 || defined _M_ARM || defined _M_ARM64 || defined _M_HYBRID
+    // Cached RtlLookupFunctionEntry / RtlPcToFileHeader / dynamic_cast / type name hashes (ehcache.cpp)
+    PRUNTIME_FUNCTION __cdecl __vcrt_lookup_function_entry(_In_ ULONG_PTR ControlPc, _Out_ PULONG_PTR ImageBase);
+    PVOID __cdecl __vcrt_pc_to_file_header(_In_ PVOID PcValue, _Out_ PVOID* BaseOfImage);
+    bool __cdecl __vcrt_lookup_cast(_In_ void const* Locator, _In_ void const* Source, _In_ void const* Target,
+        _In_ ptrdiff_t SourceOffset, _Out_ void** BaseClass, _Out_ long* Generation);
+    void __cdecl __vcrt_remember_cast(_In_ void const* Locator, _In_ void const* Source, _In_ void const* Target,
+        _In_ ptrdiff_t SourceOffset, _In_opt_ void* BaseClass, _In_ long Generation);
+    size_t __cdecl __vcrt_type_name_hash(_In_z_ char const* Name, _Out_opt_ size_t* Length);
+#endif
+
+// Hash of a decorated type name, as returned by std::type_info::hash;
+// uncached (std_type_info.cpp)
+size_t __cdecl __vcrt_hash_type_name(_In_z_ char const* Name, _Out_opt_ size_t* Length);
+
+// Decorated type name equality; rejects mismatches by a cached hash and
+// length where available (ehcache.cpp)
+bool __cdecl __vcrt_type_names_equal(_In_z_ char const* Lhs, _In_z_ char const* Rhs);
+
 
 
 // Type info stuff
@@ -241,6 +301,8 @@ BOOL __cdecl _IsNonwritableInCurrentImage(void const* pTarget);
         _SLIST_HEADER _Header;
     };
 
+    extern __type_info_node __type_info_root_node;
+
     void __cdecl __std_type_info_destroy_list(__type_info_node* _RootNode);
 #endif
 
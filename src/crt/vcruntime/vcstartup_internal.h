@@ -11,6 +11,7 @@
 #include <internal_shared.h>
 #include <intrin.h>
 #include <vcruntime_startup.h>
+#include <kext/kinitializer.h>
 
 
 
@@ -101,6 +102,14 @@ extern "C" DRIVER_INITIALIZE DriverMain;
 extern "C" int  __cdecl _get_startup_new_mode();
 extern "C" bool __cdecl __scrt_is_nonwritable_in_current_image(void const* target);
 
+extern "C" _CRTALLOC(".CRT$XCZPA") __ucxxrt_parallel_initializer const* const __xcp_a[]; // First Parallel C++ Initializer
+extern "C" _CRTALLOC(".CRT$XCZPZ") __ucxxrt_parallel_initializer const* const __xcp_z[]; // Last Parallel C++ Initializer
+
+extern "C" int __cdecl _initterm_parallel(
+    __ucxxrt_parallel_initializer const* const* first,
+    __ucxxrt_parallel_initializer const* const* last
+    );
+
 
 
 //-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -3,9 +3,12 @@
 //
 //      Copyright (c) Microsoft Corporation. All rights reserved.
 //
-// _initterm and _initterm_e functions used during dynamic initialization.
+// _initterm and _initterm_e functions used during dynamic initialization, and
+// _initterm_parallel for the initializers registered with kext/kinitializer.h.
 //
 #include <corecrt_internal.h>
+#include <process.h>
+#include <kext/kinitializer.h>
 
 
 
@@ -44,3 +47,267 @@ extern "C" int __cdecl _initterm_e(_PIFV* const first, _PIFV* const last)
 
     return 0;
 }
+
+
+
+// Parallel initializers (see kext/kinitializer.h).  The calling thread and up
+// to parallel_worker_limit - 1 system threads each pick any initializer whose
+// dependencies have all returned and run it; the fast mutex is held only while
+// picking.  A thread that finds nothing ready sleeps until the next initializer
+// returns.  The graph is checked before anything runs, so that a missing
+// dependency or a cycle cannot leave the threads waiting forever.
+enum : unsigned
+{
+    parallel_worker_limit = 8
+};
+
+// Startup timing (kext/kstartup.h), in the VCRuntime startup code.  While it
+// is on, each initializer is recorded with the sequential ones.
+extern "C" bool __scrt_startup_timing;
+extern "C" void __cdecl __scrt_record_initializer(void const* function, LONGLONG start);
+
+enum : unsigned char
+{
+    parallel_pending,
+    parallel_running,
+    parallel_done
+};
+
+struct parallel_item
+{
+    __ucxxrt_parallel_initializer const* initializer;
+    size_t const*                        dependencies; // indices of the items this one waits for
+    unsigned char                        state;
+};
+
+struct parallel_run
+{
+    FAST_MUTEX     lock;
+    KSEMAPHORE     wake;
+    long           sleepers; // threads about to wait on wake
+    parallel_item* items;
+    size_t         count;
+    size_t         done;
+};
+
+static size_t __cdecl find_parallel_item(
+    parallel_item const*                 const items,
+    size_t                               const count,
+    __ucxxrt_parallel_initializer const* const initializer
+    ) throw()
+{
+    for (size_t i = 0; i != count; ++i)
+    {
+        if (items[i].initializer == initializer)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+static bool __cdecl is_parallel_item_ready(parallel_item const* const items, size_t const index) throw()
+{
+    parallel_item const& item = items[index];
+    for (unsigned i = 0; i != item.initializer->dependency_count; ++i)
+    {
+        if (items[item.dependencies[i]].state != parallel_done)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns false if some item can never become ready.  Uses the state field as
+// scratch space, and leaves every item pending.
+static bool __cdecl is_parallel_graph_acyclic(parallel_item* const items, size_t const count) throw()
+{
+    size_t resolved = 0;
+    for (bool progress = true; progress && resolved != count; )
+    {
+        progress = false;
+        for (size_t i = 0; i != count; ++i)
+        {
+            if (items[i].state == parallel_pending && is_parallel_item_ready(items, i))
+            {
+                items[i].state = parallel_done;
+                ++resolved;
+                progress = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i != count; ++i)
+    {
+        if (items[i].state != parallel_done)
+        {
+            DbgPrintEx(DPFLTR_DEFAULT_ID, DPFLTR_ERROR_LEVEL,
+                "ucxxrt: parallel initializer %s is part of a dependency cycle\n", items[i].initializer->name);
+        }
+
+        items[i].state = parallel_pending;
+    }
+
+    return resolved == count;
+}
+
+static void __cdecl run_parallel_items(parallel_run& run) throw()
+{
+    ExAcquireFastMutex(&run.lock);
+
+    while (run.done != run.count)
+    {
+        size_t index = run.count;
+        for (size_t i = 0; i != run.count; ++i)
+        {
+            if (run.items[i].state == parallel_pending && is_parallel_item_ready(run.items, i))
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if (index == run.count)
+        {
+            // Every remaining initializer waits for one that is still running
+            ++run.sleepers;
+            ExReleaseFastMutex(&run.lock);
+            KeWaitForSingleObject(&run.wake, Executive, KernelMode, FALSE, nullptr);
+            ExAcquireFastMutex(&run.lock);
+            continue;
+        }
+
+        parallel_item& item = run.items[index];
+        item.state = parallel_running;
+        ExReleaseFastMutex(&run.lock);
+
+        LONGLONG const start = __scrt_startup_timing ? KeQueryPerformanceCounter(nullptr).QuadPart : 0;
+        item.initializer->function();
+
+        if (start != 0)
+        {
+            __scrt_record_initializer(reinterpret_cast<void const*>(item.initializer->function), start);
+        }
+
+        ExAcquireFastMutex(&run.lock);
+        item.state = parallel_done;
+        ++run.done;
+
+        if (run.sleepers != 0)
+        {
+            KeReleaseSemaphore(&run.wake, IO_NO_INCREMENT, run.sleepers, FALSE);
+            run.sleepers = 0;
+        }
+    }
+
+    ExReleaseFastMutex(&run.lock);
+}
+
+static unsigned __stdcall parallel_worker(void* const context) throw()
+{
+    run_parallel_items(*static_cast<parallel_run*>(context));
+    return 0;
+}
+
+// Runs every initializer in [first, last), concurrently where their
+// dependencies allow, and returns once all of them have returned.  Returns
+// zero on success; nonzero, without running any of them, if a dependency is
+// not in the range, if the dependencies form a cycle, or if memory runs out.
+extern "C" int __cdecl _initterm_parallel(
+    __ucxxrt_parallel_initializer const* const* const first,
+    __ucxxrt_parallel_initializer const* const* const last
+    )
+{
+    size_t count = 0;
+    size_t dependency_count = 0;
+    for (__ucxxrt_parallel_initializer const* const* it = first; it != last; ++it)
+    {
+        if (*it == nullptr)
+            continue;
+
+        ++count;
+        dependency_count += (*it)->dependency_count;
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    auto const items        = _calloc_crt_t(parallel_item, count);
+    auto const dependencies = _calloc_crt_t(size_t, dependency_count + 1);
+    if (!items || !dependencies)
+    {
+        return ENOMEM;
+    }
+
+    size_t next = 0;
+    for (__ucxxrt_parallel_initializer const* const* it = first; it != last; ++it)
+    {
+        if (*it == nullptr)
+            continue;
+
+        items.get()[next++].initializer = *it;
+    }
+
+    size_t* slot = dependencies.get();
+    for (size_t i = 0; i != count; ++i)
+    {
+        parallel_item& item = items.get()[i];
+        item.dependencies = slot;
+
+        for (unsigned d = 0; d != item.initializer->dependency_count; ++d)
+        {
+            size_t const index = find_parallel_item(items.get(), count, item.initializer->dependencies[d]);
+            if (index == count)
+            {
+                DbgPrintEx(DPFLTR_DEFAULT_ID, DPFLTR_ERROR_LEVEL,
+                    "ucxxrt: parallel initializer %s depends on one that is not registered\n",
+                    item.initializer->name);
+                return EINVAL;
+            }
+
+            *slot++ = index;
+        }
+    }
+
+    if (!is_parallel_graph_acyclic(items.get(), count))
+    {
+        return EINVAL;
+    }
+
+    parallel_run run{};
+    ExInitializeFastMutex(&run.lock);
+    KeInitializeSemaphore(&run.wake, 0, MAXLONG);
+    run.items = items.get();
+    run.count = count;
+
+    // The calling thread is one of the workers.  If a system thread cannot be
+    // created, the threads that were run everything.
+    HANDLE   threads[parallel_worker_limit - 1];
+    unsigned thread_count = 0;
+    unsigned const workers = __min(KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS),
+        static_cast<unsigned>(__min(count, static_cast<size_t>(parallel_worker_limit))));
+
+    while (thread_count + 1 < workers)
+    {
+        uintptr_t const thread = _beginthreadex(nullptr, 0, parallel_worker, &run, 0, nullptr);
+        if (thread == 0)
+            break;
+
+        threads[thread_count++] = reinterpret_cast<HANDLE>(thread);
+    }
+
+    run_parallel_items(run);
+
+    for (unsigned i = 0; i != thread_count; ++i)
+    {
+        (void)ZwWaitForSingleObject(threads[i], FALSE, nullptr);
+        (void)ZwClose(threads[i]);
+    }
+
+    return 0;
+}
@@ -37,16 +37,299 @@ enum : size_t
 
 
 
+// Registrations in the two global tables do not take the exit lock.  Each
+// processor appends to its own chain of blocks, claiming a slot with an atomic
+// bump index, and every entry is stamped with a global sequence number.  The
+// executor merges the chains back into registration order.  The _first/_last/
+// _end members of the global tables stay empty.
+enum : size_t
+{
+    onexit_block_capacity = 127,
+    onexit_shard_count    = 64
+};
+
+struct onexit_entry
+{
+    __int64 sequence;
+    _PVFV   function; // encoded; cleared once called when out of memory at exit
+};
+
+struct onexit_block
+{
+    onexit_block*  next;     // older block of the same shard
+    long volatile  count;    // slots claimed; may run past the capacity
+    onexit_entry   entries[onexit_block_capacity];
+};
+
+struct __declspec(align(SYSTEM_CACHE_ALIGNMENT_SIZE)) onexit_shard
+{
+    onexit_block* volatile head;
+    long volatile          busy; // registrations that may still touch head
+};
+
+struct onexit_registry
+{
+    onexit_shard     shards[onexit_shard_count];
+    __int64 volatile sequence;
+};
+
+static onexit_registry atexit_registry;
+static onexit_registry at_quick_exit_registry;
+
+
+
+static onexit_registry* __cdecl select_registry(_onexit_table_t* const table) throw()
+{
+    if (table == &__acrt_atexit_table)
+    {
+        return &atexit_registry;
+    }
+
+    if (table == &__acrt_at_quick_exit_table)
+    {
+        return &at_quick_exit_registry;
+    }
+
+    return nullptr;
+}
+
+static int __cdecl register_sharded(onexit_registry& registry, _onexit_t const function) throw()
+{
+    __int64 const sequence = _InterlockedIncrement64(&registry.sequence);
+    _PVFV   const encoded  = reinterpret_cast<_PVFV>(__crt_fast_encode_pointer(function));
+
+    onexit_shard& shard = registry.shards[KeGetCurrentProcessorNumberEx(nullptr) % onexit_shard_count];
+    _InterlockedIncrement(&shard.busy);
+
+    int result = -1;
+    for (;;)
+    {
+        onexit_block* const block = __crt_interlocked_read_pointer(&shard.head);
+        if (block)
+        {
+            size_t const index = static_cast<size_t>(_InterlockedIncrement(&block->count)) - 1;
+            if (index < onexit_block_capacity)
+            {
+                // The executor reads the entry only after busy drops back to zero
+                block->entries[index].sequence = sequence;
+                block->entries[index].function = encoded;
+                result = 0;
+                break;
+            }
+        }
+
+        // The shard is empty or its newest block is full; push a new block
+        // that already holds this entry:
+        onexit_block* const new_block = _calloc_crt_t(onexit_block, 1).detach();
+        if (!new_block)
+        {
+            break;
+        }
+
+        new_block->next                = block;
+        new_block->count               = 1;
+        new_block->entries[0].sequence = sequence;
+        new_block->entries[0].function = encoded;
+
+        if (__crt_interlocked_compare_exchange_pointer(&shard.head, new_block, block) == block)
+        {
+            result = 0;
+            break;
+        }
+
+        _free_crt(new_block); // Another registration pushed first; use its block
+    }
+
+    _InterlockedDecrement(&shard.busy);
+    return result;
+}
+
+static size_t __cdecl block_used(onexit_block const* const block) throw()
+{
+    size_t const count = static_cast<size_t>(block->count);
+    return count < onexit_block_capacity ? count : onexit_block_capacity;
+}
+
+static bool __cdecl has_pending_registrations(onexit_registry& registry) throw()
+{
+    for (onexit_shard& shard : registry.shards)
+    {
+        if (__crt_interlocked_read_pointer(&shard.head))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void __cdecl sift_down_by_sequence(onexit_entry* const entries, size_t root, size_t const count) throw()
+{
+    // Min-heap on the sequence, so that heap sort leaves the newest entry first
+    for (size_t child; (child = 2 * root + 1) < count; root = child)
+    {
+        if (child + 1 < count && entries[child + 1].sequence < entries[child].sequence)
+        {
+            ++child;
+        }
+
+        if (entries[root].sequence <= entries[child].sequence)
+        {
+            break;
+        }
+
+        onexit_entry const temp = entries[root];
+        entries[root]  = entries[child];
+        entries[child] = temp;
+    }
+}
+
+static void __cdecl sort_newest_first(onexit_entry* const entries, size_t const count) throw()
+{
+    for (size_t i = count / 2; i-- != 0; )
+    {
+        sift_down_by_sequence(entries, i, count);
+    }
+
+    for (size_t last = count; last-- > 1; )
+    {
+        onexit_entry const temp = entries[0];
+        entries[0]    = entries[last];
+        entries[last] = temp;
+
+        sift_down_by_sequence(entries, 0, last);
+    }
+}
+
+static void __cdecl call_entry(onexit_registry& registry, onexit_entry const& entry) throw();
+
+static void __cdecl execute_sharded(onexit_registry& registry) throw()
+{
+    for (;;)
+    {
+        // Detach every chain, then wait out the registrations that read a head
+        // before it was detached.  Later registrations start new chains.
+        onexit_block* chains[onexit_shard_count];
+        for (size_t i = 0; i != onexit_shard_count; ++i)
+        {
+            chains[i] = __crt_interlocked_exchange_pointer(&registry.shards[i].head, nullptr);
+        }
+
+        for (onexit_shard& shard : registry.shards)
+        {
+            while (__crt_interlocked_read(&shard.busy) != 0)
+            {
+                YieldProcessor();
+            }
+        }
+
+        size_t count = 0;
+        for (onexit_block* const chain : chains)
+        {
+            for (onexit_block* block = chain; block; block = block->next)
+            {
+                count += block_used(block);
+            }
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto const merged = _malloc_crt_t(onexit_entry, count);
+        if (merged)
+        {
+            size_t next = 0;
+            for (onexit_block* const chain : chains)
+            {
+                for (onexit_block* block = chain; block; block = block->next)
+                {
+                    size_t const used = block_used(block);
+                    for (size_t i = 0; i != used; ++i)
+                    {
+                        merged.get()[next++] = block->entries[i];
+                    }
+                }
+            }
+
+            sort_newest_first(merged.get(), count);
+
+            for (size_t i = 0; i != count; ++i)
+            {
+                call_entry(registry, merged.get()[i]);
+            }
+        }
+        else
+        {
+            // Out of memory: pick the newest remaining entry by scanning
+            for (;;)
+            {
+                onexit_entry* newest = nullptr;
+                for (onexit_block* const chain : chains)
+                {
+                    for (onexit_block* block = chain; block; block = block->next)
+                    {
+                        size_t const used = block_used(block);
+                        for (size_t i = 0; i != used; ++i)
+                        {
+                            onexit_entry& entry = block->entries[i];
+                            if (entry.function && (!newest || newest->sequence < entry.sequence))
+                            {
+                                newest = &entry;
+                            }
+                        }
+                    }
+                }
+
+                if (!newest)
+                {
+                    break;
+                }
+
+                onexit_entry const entry = *newest;
+                newest->function = nullptr;
+                call_entry(registry, entry);
+            }
+        }
+
+        for (onexit_block* const chain : chains)
+        {
+            for (onexit_block* block = chain; block; )
+            {
+                onexit_block* const next = block->next;
+                _free_crt(block);
+                block = next;
+            }
+        }
+    }
+}
+
+static void __cdecl call_entry(onexit_registry& registry, onexit_entry const& entry) throw()
+{
+    _PVFV const function = __crt_fast_decode_pointer(entry.function);
+    function();
+
+    // Functions registered by the call are newer than every entry still
+    // waiting, so they run first:
+    if (has_pending_registrations(registry))
+    {
+        execute_sharded(registry);
+    }
+}
+
+
+
 // Registers a function to be executed on exit.  This function modifies the global
 // onexit table.
 extern "C" int __cdecl _crt_atexit(_PVFV const function)
 {
-    return _register_onexit_function(&__acrt_atexit_table, reinterpret_cast<_onexit_t>(function));
+    return register_sharded(atexit_registry, reinterpret_cast<_onexit_t>(function));
 }
 
 extern "C" int __cdecl _crt_at_quick_exit(_PVFV const function)
 {
-    return _register_onexit_function(&__acrt_at_quick_exit_table, reinterpret_cast<_onexit_t>(function));
+    return register_sharded(at_quick_exit_registry, reinterpret_cast<_onexit_t>(function));
 }
 
 
@@ -79,6 +362,11 @@ extern "C" int __cdecl _initialize_onexit_table(_onexit_table_t* const table)
 // in calling code.
 extern "C" int __cdecl _register_onexit_function(_onexit_table_t* const table, _onexit_t const function)
 {
+    if (onexit_registry* const registry = select_registry(table))
+    {
+        return register_sharded(*registry, function);
+    }
+
     return __acrt_lock_and_call(__acrt_select_exit_lock(), [&]
     {
         if (!table)
@@ -162,6 +450,12 @@ extern "C" int __cdecl _execute_onexit_table(_onexit_table_t* const table)
             return -1;
         }
 
+        if (onexit_registry* const registry = select_registry(table))
+        {
+            execute_sharded(*registry);
+            return 0;
+        }
+
         _PVFV* first = __crt_fast_decode_pointer(table->_first);
         _PVFV* last  = __crt_fast_decode_pointer(table->_last);
         if (!first || first == reinterpret_cast<_PVFV*>(-1))
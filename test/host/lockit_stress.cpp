@@ -0,0 +1,227 @@
+//
+// lockit_stress.cpp
+//
+// Stress test and benchmark of the lock core behind std::_Lockit and
+// std::kshared_lockit (src/crt/stl/xmtx.cpp), run on a development host:
+//
+//     g++ -std=c++17 -O2 -g -pthread -Wno-unknown-pragmas -Ishim \
+//         lockit_stress.cpp -o lockit_stress
+//     ./lockit_stress [threads] [iterations]
+//
+// Each thread mixes exclusive acquisitions, recursive ones, shared ones
+// taken inside exclusive ones and released in either order, and plain
+// shared acquisitions, and checks that writers exclude everyone and that
+// readers never see a half-written update.  The benchmark then compares
+// uncontended and contended acquisitions with std::recursive_mutex and
+// std::shared_mutex.  Build with -fsanitize=thread to check the orderings.
+//
+#include "../../src/crt/stl/xmtx.cpp"
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <shared_mutex>
+#include <vector>
+
+namespace
+{
+    _Rmtx lock;
+
+    std::atomic<int> readers;
+    std::atomic<int> writers;
+    long             data[8];
+
+    void fail(char const* const what)
+    {
+        fprintf(stderr, "FAILED: %s\n", what);
+        abort();
+    }
+
+    void update()
+    {
+        if (writers.fetch_add(1) != 0 || readers.load() != 0)
+        {
+            fail("exclusive owner is not alone");
+        }
+
+        // Yield half way, so that a broken lock lets others in even on one processor
+        for (int i = 0; i != 8; ++i)
+        {
+            ++data[i];
+            if (i == 3)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        writers.fetch_sub(1);
+    }
+
+    void check()
+    {
+        readers.fetch_add(1);
+        if (writers.load() != 0)
+        {
+            fail("shared owner alongside the exclusive owner");
+        }
+
+        long const first = data[0];
+        std::this_thread::yield();
+        for (long const d : data)
+        {
+            if (d != first)
+            {
+                fail("shared owner saw a partial update");
+            }
+        }
+
+        if (writers.load() != 0)
+        {
+            fail("shared owner alongside the exclusive owner");
+        }
+
+        readers.fetch_sub(1);
+    }
+
+    void run_thread(int const seed, int const iterations)
+    {
+        std::mt19937 random(seed);
+        for (int i = 0; i != iterations; ++i)
+        {
+            switch (random() % 10)
+            {
+            case 0: // recursive
+                _Mtxlock(&lock);
+                _Mtxlock(&lock);
+                update();
+                _Mtxunlock(&lock);
+                _Mtxunlock(&lock);
+                break;
+
+            case 1: // shared inside exclusive, released inside out
+                _Mtxlock(&lock);
+                _Mtxlock_shared(&lock);
+                update();
+                _Mtxunlock_shared(&lock);
+                _Mtxunlock(&lock);
+                break;
+
+            case 2: // shared inside exclusive, the exclusive released first
+                _Mtxlock(&lock);
+                _Mtxlock_shared(&lock);
+                _Mtxunlock(&lock);
+                update();
+                _Mtxlock(&lock);
+                _Mtxunlock_shared(&lock);
+                update();
+                _Mtxunlock(&lock);
+                break;
+
+            case 3:
+                _Mtxlock(&lock);
+                _Mtxlock_shared(&lock);
+                _Mtxunlock(&lock);
+                update();
+                _Mtxunlock_shared(&lock);
+                break;
+
+            default:
+                _Mtxlock_shared(&lock);
+                check();
+                if (random() % 4 == 0)
+                {
+                    std::this_thread::yield();
+                }
+                _Mtxunlock_shared(&lock);
+                break;
+            }
+        }
+    }
+
+    template <class Lock, class Unlock>
+    void benchmark(char const* const name, Lock lock_, Unlock unlock_)
+    {
+        int const iterations = 10000000;
+
+        auto const begin = std::chrono::steady_clock::now();
+        for (int i = 0; i != iterations; ++i)
+        {
+            lock_();
+            unlock_();
+        }
+
+        auto const elapsed = std::chrono::steady_clock::now() - begin;
+        printf("%-38s %6.2f ns\n", name, std::chrono::duration<double, std::nano>(elapsed).count() / iterations);
+    }
+
+    template <class Lock, class Unlock>
+    void benchmark_contended(char const* const name, int const threads, Lock lock_, Unlock unlock_)
+    {
+        int const iterations = 200000;
+
+        auto const begin = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t != threads; ++t)
+        {
+            workers.emplace_back([=]
+            {
+                for (int i = 0; i != iterations; ++i)
+                {
+                    lock_();
+                    unlock_();
+                }
+            });
+        }
+
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        auto const elapsed = std::chrono::steady_clock::now() - begin;
+        printf("%-38s %6.1f ms\n", name, std::chrono::duration<double, std::milli>(elapsed).count());
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    int const threads    = argc > 1 ? atoi(argv[1]) : 8;
+    int const iterations = argc > 2 ? atoi(argv[2]) : 20000;
+
+    _Mtxinit(&lock);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t != threads; ++t)
+    {
+        workers.emplace_back(run_thread, t, iterations);
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (lock._State != 0 || lock._Owner != nullptr || lock._Owner_exclusive != 0 || lock._Owner_shared != 0)
+    {
+        fail("lock not free at the end");
+    }
+
+    printf("stress: %d threads, %llu exclusive, %lld shared, %lld contended, %lld sleeps\n",
+        threads, lock._Exclusive, lock._Shared, lock._Contended, lock._Sleeps);
+
+    static std::recursive_mutex recursive;
+    static std::shared_mutex    shared;
+
+    benchmark("_Mtxlock", [] { _Mtxlock(&lock); }, [] { _Mtxunlock(&lock); });
+    benchmark("_Mtxlock_shared", [] { _Mtxlock_shared(&lock); }, [] { _Mtxunlock_shared(&lock); });
+    benchmark("std::recursive_mutex", [] { recursive.lock(); }, [] { recursive.unlock(); });
+    benchmark("std::shared_mutex, shared", [] { shared.lock_shared(); }, [] { shared.unlock_shared(); });
+
+    benchmark_contended("4 threads, _Mtxlock", 4, [] { _Mtxlock(&lock); }, [] { _Mtxunlock(&lock); });
+    benchmark_contended("4 threads, _Mtxlock_shared", 4, [] { _Mtxlock_shared(&lock); }, [] { _Mtxunlock_shared(&lock); });
+    benchmark_contended("4 threads, std::recursive_mutex", 4, [] { recursive.lock(); }, [] { recursive.unlock(); });
+    benchmark_contended("4 threads, std::shared_mutex, shared", 4, [] { shared.lock_shared(); }, [] { shared.unlock_shared(); });
+
+    return 0;
+}
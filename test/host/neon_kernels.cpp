@@ -0,0 +1,190 @@
+//
+// neon_kernels.cpp
+//
+// Test of the ARM64 section of src/crt/stl/vector_algorithms.cpp, run on a
+// development host against shim/arm_neon.h:
+//
+//     g++ -std=c++17 -O2 -g -Wall -Wextra -Werror -Wno-unknown-pragmas -Ishim neon_kernels.cpp -o neon_kernels
+//     ./neon_kernels
+//
+// The stand-in header has the MSVC shape, with one type for all 128-bit
+// vectors, so this build type-checks the section as MSVC would see it; it
+// does not replace an ARM64 build, which also checks the intrinsics' real
+// signatures and code generation.  Each kernel is compared with a scalar
+// loop for every element size, signed and unsigned, at every misalignment,
+// with lengths past the portions after which the lane counters and indices
+// would wrap.
+//
+#include <vcruntime_internal.h>
+
+#undef _M_X64
+#define _M_ARM64 1
+#include "../../src/crt/stl/vector_algorithms.cpp"
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    int failures;
+
+    void check(bool const condition, char const* const what, size_t const size, size_t const length)
+    {
+        if (!condition)
+        {
+            printf("%zu-byte elements, length %zu: %s\n", size, length, what);
+            ++failures;
+        }
+    }
+
+    template <size_t Size>
+    struct kernels;
+
+    #define HOST_KERNELS(Size)                                                       \
+        template <>                                                                  \
+        struct kernels<Size>                                                         \
+        {                                                                            \
+            static constexpr auto reverse = __std_reverse_trivially_swappable_##Size; \
+            static constexpr auto find    = __std_find_trivial_##Size;               \
+            static constexpr auto unsized = __std_find_trivial_unsized_##Size;       \
+            static constexpr auto count   = __std_count_trivial_##Size;              \
+            static constexpr auto min     = __std_min_element_##Size;                \
+            static constexpr auto max     = __std_max_element_##Size;                \
+            static constexpr auto minmax  = __std_minmax_element_##Size;             \
+        };
+
+    HOST_KERNELS(1)
+    HOST_KERNELS(2)
+    HOST_KERNELS(4)
+    HOST_KERNELS(8)
+
+    #undef HOST_KERNELS
+
+    // The first minimum, the first maximum and the last maximum, as <algorithm> defines them
+    template <class T>
+    void check_minmax(std::vector<T> const& data, size_t const first, size_t const length, bool const is_signed)
+    {
+        using kernel = kernels<sizeof(T)>;
+        using signed_t = std::make_signed_t<T>;
+
+        T const* const begin = data.data() + first;
+        T const* const end   = begin + length;
+
+        auto const less = [is_signed](T const a, T const b)
+        {
+            return is_signed ? static_cast<signed_t>(a) < static_cast<signed_t>(b) : a < b;
+        };
+
+        T const* const min      = std::min_element(begin, end, less);
+        T const* const max      = std::max_element(begin, end, less);
+        T const* const last_max = std::minmax_element(begin, end, less).second;
+
+        check(kernel::min(begin, end, is_signed) == min, "min_element", sizeof(T), length);
+        check(kernel::max(begin, end, is_signed) == max, "max_element", sizeof(T), length);
+
+        _Min_max_element_t const both = kernel::minmax(begin, end, is_signed);
+        check(both._Min == min && both._Max == last_max, "minmax_element", sizeof(T), length);
+    }
+
+    template <class T>
+    void check_length(std::mt19937_64& random, size_t const length, T const range)
+    {
+        using kernel = kernels<sizeof(T)>;
+
+        for (size_t first = 0; first != 16 / sizeof(T) + 1; ++first)
+        {
+            // Whole vectors, so that the unsized find may read to the end of the piece holding its match
+            std::vector<T> data((first + length + 1 + 16) / 16 * 16 + 16);
+            for (T& element : data)
+            {
+                element = static_cast<T>(random() % range);
+            }
+
+            // Values near the top of the range test the signed and unsigned comparisons; a range of
+            // one value leaves every element equal, so that each lane counter and index reaches its limit
+            for (T& element : data)
+            {
+                if (range != 1 && random() % 8 == 0)
+                {
+                    element = static_cast<T>(~element);
+                }
+            }
+
+            T* const begin = data.data() + first;
+            T* const end   = begin + length;
+
+            T const value = static_cast<T>(random() % range);
+            check(kernel::find(begin, end, value) == std::find(begin, end, value), "find", sizeof(T), length);
+            check(kernel::count(begin, end, value) == static_cast<size_t>(std::count(begin, end, value)), "count",
+                sizeof(T), length);
+
+            T const saved = *end;
+            *end = value;
+            check(kernel::unsized(begin, value) == std::find(begin, end + 1, value), "unsized find", sizeof(T), length);
+            *end = saved;
+
+            check_minmax(data, first, length, false);
+            check_minmax(data, first, length, true);
+
+            std::vector<T> expected(data);
+            std::reverse(expected.begin() + static_cast<ptrdiff_t>(first),
+                expected.begin() + static_cast<ptrdiff_t>(first + length));
+            kernel::reverse(begin, end);
+            check(data == expected, "reverse", sizeof(T), length);
+
+            std::vector<T> other(data.size());
+            for (T& element : other)
+            {
+                element = static_cast<T>(random());
+            }
+
+            std::vector<T> const before(data), other_before(other);
+            __std_swap_ranges_trivially_swappable_noalias(begin, end, other.data() + first);
+            bool swapped = true;
+            for (size_t i = 0; i != data.size(); ++i)
+            {
+                bool const inside = i >= first && i < first + length;
+                swapped = swapped && data[i] == (inside ? other_before[i] : before[i])
+                                  && other[i] == (inside ? before[i] : other_before[i]);
+            }
+
+            check(swapped, "swap_ranges", sizeof(T), length);
+        }
+    }
+
+    template <class T>
+    void check_size(std::mt19937_64& random)
+    {
+        for (size_t length = 0; length != 300; ++length)
+        {
+            check_length<T>(random, length, 4);
+            check_length<T>(random, length, static_cast<T>(~T{0}));
+        }
+
+        // Past the portions of 255 and 65,535 vectors that count and of 256 and
+        // 65,536 vectors that min and max keep their lane indices for
+        for (size_t const length : {4096 + 37, 70000, 65536 * 8 + 19, 65536 * 16 + 5})
+        {
+            if (length * sizeof(T) <= 65536 * 16 * 2)
+            {
+                check_length<T>(random, length, 3);
+                check_length<T>(random, length, 1);
+            }
+        }
+    }
+}
+
+int main()
+{
+    std::mt19937_64 random(1);
+
+    check_size<uint8_t>(random);
+    check_size<uint16_t>(random);
+    check_size<uint32_t>(random);
+    check_size<uint64_t>(random);
+
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,251 @@
+//
+// onexit_stress.cpp
+//
+// Stress test and benchmark of the sharded atexit registry
+// (src/ucrt/startup/onexit.cpp), run on a development host:
+//
+//     g++ -std=c++17 -O2 -g -pthread -Ishim onexit_stress.cpp -o onexit_stress
+//     ./onexit_stress [bench]
+//
+// The stress passes check that:
+//
+//  * registrations from four threads on scattered processors run newest
+//    first, in the order a lock held around each registration gave them,
+//    with the merge buffer allocated and with the allocation failing;
+//  * a function registered while the table executes runs before every
+//    older entry;
+//  * 800,000 registrations from eight threads, several to a processor, all
+//    run exactly once, also while another thread executes the table in a
+//    loop.
+//
+// The benchmark compares registering through _crt_atexit with registering
+// on a table of its own, which takes the exit lock each time.  Build with
+// -fsanitize=thread to check the lock-free paths.
+//
+#include "../../src/ucrt/startup/onexit.cpp"
+
+#include <array>
+#include <atomic>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    int failures;
+
+    void check(bool const condition, char const* const what, int const line)
+    {
+        if (!condition)
+        {
+            printf("line %d: %s\n", line, what);
+            ++failures;
+        }
+    }
+
+    #define CHECK(condition) check((condition), #condition, __LINE__)
+
+    std::vector<int>  executed;   // written by the executing thread only
+    std::atomic<long> calls;
+
+    template <int N>
+    void __cdecl record()
+    {
+        executed.push_back(N);
+    }
+
+    template <int... N>
+    constexpr std::array<_PVFV, sizeof...(N)> make_recorders(std::integer_sequence<int, N...>)
+    {
+        return {{&record<N>...}};
+    }
+
+    std::array<_PVFV, 256> const recorders = make_recorders(std::make_integer_sequence<int, 256>{});
+
+    void __cdecl count_call()
+    {
+        calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void __cdecl register_while_executing()
+    {
+        executed.push_back(1000);
+        _crt_atexit(recorders[1]);
+        _crt_atexit(recorders[2]);
+    }
+
+    void check_order(bool const fail_merge_allocation)
+    {
+        std::vector<int> registered;
+        std::mutex order_lock;
+
+        executed.clear();
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t != 4; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                std::mt19937 random(t);
+                for (int i = 0; i != 5000; ++i)
+                {
+                    host_processor_number = random() % 97;
+                    int const n = static_cast<int>(random() % recorders.size());
+
+                    std::lock_guard<std::mutex> const hold(order_lock);
+                    CHECK(_crt_atexit(recorders[n]) == 0);
+                    registered.push_back(n);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        host_fail_allocations = fail_merge_allocation;
+        _execute_onexit_table(&__acrt_atexit_table);
+        host_fail_allocations = false;
+
+        CHECK(executed == std::vector<int>(registered.rbegin(), registered.rend()));
+
+        // The table is empty once executed
+        _execute_onexit_table(&__acrt_atexit_table);
+        CHECK(executed.size() == registered.size());
+    }
+
+    void check_reentrant_registration()
+    {
+        executed.clear();
+
+        host_processor_number = 0;
+        _crt_atexit(recorders[7]);
+        host_processor_number = 5;
+        _crt_atexit(register_while_executing);
+        host_processor_number = 9;
+        _crt_atexit(recorders[8]);
+
+        _execute_onexit_table(&__acrt_atexit_table);
+        CHECK((executed == std::vector<int>{8, 1000, 2, 1, 7}));
+    }
+
+    void check_concurrent(int const round)
+    {
+        calls = 0;
+
+        std::atomic<long> registered{0};
+        std::atomic<bool> go{false};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t != 8; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                std::mt19937 random(t * 7 + round);
+                while (!go)
+                {
+                }
+
+                for (int i = 0; i != 100000; ++i)
+                {
+                    host_processor_number = random() % 8 == 0 ? random() % 200 : t % 3;
+                    if (_crt_atexit(count_call) == 0)
+                    {
+                        ++registered;
+                    }
+                }
+            });
+        }
+
+        go = true;
+        if (round % 2 != 0)
+        {
+            for (int i = 0; i != 50; ++i)
+            {
+                _execute_onexit_table(&__acrt_atexit_table);
+                std::this_thread::yield();
+            }
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        _execute_onexit_table(&__acrt_atexit_table);
+        CHECK(registered == 800000);
+        CHECK(calls == 800000);
+    }
+
+    template <typename Register>
+    double time_registrations(int const thread_count, Register const register_one)
+    {
+        int const count = 200000;
+
+        std::vector<std::thread> threads;
+        auto const start = std::chrono::steady_clock::now();
+        for (int t = 0; t != thread_count; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                host_processor_number = t;
+                for (int i = 0; i != count; ++i)
+                {
+                    register_one();
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count() / (static_cast<double>(count) * thread_count);
+    }
+
+    void bench()
+    {
+        printf("ns per registration   sharded    locked\n");
+        for (int const thread_count : {1, 2, 4, 8})
+        {
+            double const sharded = time_registrations(thread_count, [] { _crt_atexit(count_call); });
+            _execute_onexit_table(&__acrt_atexit_table);
+
+            _onexit_table_t table{};
+            _initialize_onexit_table(&table);
+            double const locked = time_registrations(thread_count, [&]
+            {
+                _register_onexit_function(&table, reinterpret_cast<_onexit_t>(count_call));
+            });
+            _execute_onexit_table(&table);
+
+            printf("%d thread%s %19.1f %9.1f\n", thread_count, thread_count == 1 ? " " : "s", sharded, locked);
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    _initialize_onexit_table(&__acrt_atexit_table);
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    check_order(false);
+    check_order(true);
+    check_reentrant_registration();
+
+    for (int round = 0; round != 6; ++round)
+    {
+        check_concurrent(round);
+    }
+
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
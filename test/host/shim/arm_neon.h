@@ -0,0 +1,244 @@
+//
+// arm_neon.h (host stand-in)
+//
+// Scalar versions of the Advanced SIMD intrinsics the ARM64 section of
+// vector_algorithms.cpp uses.  The types follow the MSVC header rather than
+// the ACLE one: every 128-bit vector type is the one __n128 union and every
+// 64-bit vector type the one __n64 union, and the reinterpret casts are
+// no-ops, so code that overloads or specializes on the vector types fails
+// here as it would under MSVC.
+//
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+typedef union __n128
+{
+    uint64_t n128_u64[2];
+    uint32_t n128_u32[4];
+    uint16_t n128_u16[8];
+    uint8_t  n128_u8[16];
+    int64_t  n128_i64[2];
+    int32_t  n128_i32[4];
+    int16_t  n128_i16[8];
+    int8_t   n128_i8[16];
+} __n128;
+
+typedef union __n64
+{
+    uint64_t n64_u64[1];
+    uint32_t n64_u32[2];
+    uint16_t n64_u16[4];
+    uint8_t  n64_u8[8];
+} __n64;
+
+typedef __n128 uint8x16_t;
+typedef __n128 uint16x8_t;
+typedef __n128 uint32x4_t;
+typedef __n128 uint64x2_t;
+typedef __n128 int8x16_t;
+typedef __n128 int16x8_t;
+typedef __n128 int32x4_t;
+typedef __n128 int64x2_t;
+typedef __n64  uint8x8_t;
+typedef __n64  uint64x1_t;
+
+namespace host_neon
+{
+    template <class T>
+    constexpr int lanes = static_cast<int>(16 / sizeof(T));
+
+    template <class T>
+    T get(__n128 const& v, int const i)
+    {
+        T value;
+        memcpy(&value, v.n128_u8 + i * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    template <class T>
+    void put(__n128& v, int const i, T const value)
+    {
+        memcpy(v.n128_u8 + i * sizeof(T), &value, sizeof(T));
+    }
+
+    template <class T>
+    T mask(bool const condition)
+    {
+        return condition ? static_cast<T>(~T{0}) : T{0};
+    }
+
+    template <class T, class F>
+    __n128 map(__n128 const a, __n128 const b, F const f)
+    {
+        __n128 r;
+        for (int i = 0; i != lanes<T>; ++i)
+        {
+            put<T>(r, i, f(get<T>(a, i), get<T>(b, i)));
+        }
+
+        return r;
+    }
+
+    template <class T>
+    __n128 load(T const* const p)
+    {
+        __n128 r;
+        memcpy(&r, p, 16);
+        return r;
+    }
+
+    template <class T>
+    __n128 dup(T const value)
+    {
+        __n128 r;
+        for (int i = 0; i != lanes<T>; ++i)
+        {
+            put<T>(r, i, value);
+        }
+
+        return r;
+    }
+
+    template <class T>
+    __n128 rev64(__n128 const v)
+    {
+        __n128 r;
+        int const half = lanes<T> / 2;
+        for (int i = 0; i != lanes<T>; ++i)
+        {
+            put<T>(r, i, get<T>(v, i / half * half + (half - 1 - i % half)));
+        }
+
+        return r;
+    }
+
+    template <class T, class Acc = T, class F>
+    Acc fold(__n128 const v, F const f)
+    {
+        Acc acc = get<T>(v, 0);
+        for (int i = 1; i != lanes<T>; ++i)
+        {
+            acc = f(acc, static_cast<Acc>(get<T>(v, i)));
+        }
+
+        return acc;
+    }
+
+    template <class T>
+    T min(T const a, T const b)
+    {
+        return b < a ? b : a;
+    }
+
+    template <class T>
+    T max(T const a, T const b)
+    {
+        return a < b ? b : a;
+    }
+
+    template <class T>
+    T add(T const a, T const b)
+    {
+        return static_cast<T>(a + b);
+    }
+}
+
+#define HOST_NEON_Q(T, S)                                                                                           \
+    inline __n128 vld1q_##S(T const* const p) { return host_neon::load(p); }                                     \
+    inline __n128 vdupq_n_##S(T const value) { return host_neon::dup<T>(value); }                                \
+    inline __n128 vaddq_##S(__n128 const a, __n128 const b)                                                      \
+    {                                                                                                            \
+        return host_neon::map<T>(a, b, [](T const x, T const y) { return static_cast<T>(x + y); });              \
+    }                                                                                                            \
+    inline __n128 vsubq_##S(__n128 const a, __n128 const b)                                                      \
+    {                                                                                                            \
+        return host_neon::map<T>(a, b, [](T const x, T const y) { return static_cast<T>(x - y); });              \
+    }                                                                                                            \
+    inline __n128 vceqq_##S(__n128 const a, __n128 const b)                                                      \
+    {                                                                                                            \
+        return host_neon::map<T>(a, b, [](T const x, T const y) { return host_neon::mask<T>(x == y); });         \
+    }                                                                                                            \
+    inline __n128 vcgtq_##S(__n128 const a, __n128 const b)                                                      \
+    {                                                                                                            \
+        return host_neon::map<T>(a, b, [](T const x, T const y) { return host_neon::mask<T>(x > y); });          \
+    }                                                                                                            \
+    inline __n128 vbslq_##S(__n128 const m, __n128 const a, __n128 const b)                                      \
+    {                                                                                                            \
+        return host_neon::map<uint64_t>(host_neon::map<uint64_t>(m, a, [](uint64_t const x, uint64_t const y)    \
+            { return x & y; }), host_neon::map<uint64_t>(m, b, [](uint64_t const x, uint64_t const y)            \
+            { return ~x & y; }), [](uint64_t const x, uint64_t const y) { return x | y; });                      \
+    }
+
+HOST_NEON_Q(uint8_t,  u8)
+HOST_NEON_Q(uint16_t, u16)
+HOST_NEON_Q(uint32_t, u32)
+HOST_NEON_Q(uint64_t, u64)
+HOST_NEON_Q(int8_t,   s8)
+HOST_NEON_Q(int16_t,  s16)
+HOST_NEON_Q(int32_t,  s32)
+HOST_NEON_Q(int64_t,  s64)
+
+#undef HOST_NEON_Q
+
+#define HOST_NEON_ACROSS(T, S)                                                                                      \
+    inline T vminvq_##S(__n128 const v) { return host_neon::fold<T>(v, host_neon::min<T>); }                     \
+    inline T vmaxvq_##S(__n128 const v) { return host_neon::fold<T>(v, host_neon::max<T>); }
+
+HOST_NEON_ACROSS(uint8_t,  u8)
+HOST_NEON_ACROSS(uint16_t, u16)
+HOST_NEON_ACROSS(uint32_t, u32)
+HOST_NEON_ACROSS(int8_t,   s8)
+HOST_NEON_ACROSS(int16_t,  s16)
+HOST_NEON_ACROSS(int32_t,  s32)
+
+#undef HOST_NEON_ACROSS
+
+inline uint16_t vaddlvq_u8(__n128 const v) { return host_neon::fold<uint8_t, uint16_t>(v, host_neon::add<uint16_t>); }
+inline uint32_t vaddlvq_u16(__n128 const v) { return host_neon::fold<uint16_t, uint32_t>(v, host_neon::add<uint32_t>); }
+inline uint64_t vaddlvq_u32(__n128 const v) { return host_neon::fold<uint32_t, uint64_t>(v, host_neon::add<uint64_t>); }
+inline uint64_t vaddvq_u64(__n128 const v) { return host_neon::fold<uint64_t>(v, host_neon::add<uint64_t>); }
+
+inline void vst1q_u8(uint8_t* const p, __n128 const v) { memcpy(p, &v, 16); }
+
+inline __n128 vrev64q_u8(__n128 const v) { return host_neon::rev64<uint8_t>(v); }
+inline __n128 vrev64q_u16(__n128 const v) { return host_neon::rev64<uint16_t>(v); }
+inline __n128 vrev64q_u32(__n128 const v) { return host_neon::rev64<uint32_t>(v); }
+
+inline __n128 vextq_u8(__n128 const a, __n128 const b, int const n)
+{
+    __n128 r;
+    for (int i = 0; i != 16; ++i)
+    {
+        r.n128_u8[i] = i + n < 16 ? a.n128_u8[i + n] : b.n128_u8[i + n - 16];
+    }
+
+    return r;
+}
+
+inline __n64 vshrn_n_u16(__n128 const v, int const n)
+{
+    __n64 r;
+    for (int i = 0; i != 8; ++i)
+    {
+        r.n64_u8[i] = static_cast<uint8_t>(v.n128_u16[i] >> n);
+    }
+
+    return r;
+}
+
+inline uint64_t vget_lane_u64(__n64 const v, int const lane) { return v.n64_u64[lane]; }
+inline uint64_t vgetq_lane_u64(__n128 const v, int const lane) { return v.n128_u64[lane]; }
+
+// As in the MSVC header, the reinterpret casts leave the operand as it is
+#define vreinterpret_u64_u8(v)    (v)
+#define vreinterpretq_u8_u16(v)   (v)
+#define vreinterpretq_u8_u32(v)   (v)
+#define vreinterpretq_u8_u64(v)   (v)
+#define vreinterpretq_u16_u8(v)   (v)
+#define vreinterpretq_u32_u8(v)   (v)
+#define vreinterpretq_s8_u8(v)    (v)
+#define vreinterpretq_s16_u16(v)  (v)
+#define vreinterpretq_s32_u32(v)  (v)
+#define vreinterpretq_s64_u64(v)  (v)
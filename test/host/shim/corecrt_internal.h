@@ -0,0 +1,139 @@
+//
+// corecrt_internal.h (host stand-in)
+//
+// The UCRT internals used by the runtime sources that the host harnesses in
+// test/host compile as is.  The processor number is whatever the harness
+// says it is, so that a test can put any number of threads on one shard;
+// the exit lock is a recursive mutex; pointers are encoded with a fixed
+// cookie; and the CRT heap is malloc, whose failures a test can force.
+//
+#pragma once
+
+#include <vcruntime_internal.h>
+
+typedef void (__cdecl* _PVFV)(void);
+typedef int  (__cdecl* _onexit_t)(void);
+
+struct _onexit_table_t
+{
+    _PVFV* _first;
+    _PVFV* _last;
+    _PVFV* _end;
+};
+
+// What KeGetCurrentProcessorNumberEx returns on the calling thread
+inline thread_local unsigned long host_processor_number;
+
+inline unsigned long KeGetCurrentProcessorNumberEx(void*)
+{
+    return host_processor_number;
+}
+
+// Pointer encoding
+constexpr uintptr_t host_pointer_cookie = 0x5a5a1234abcdULL;
+
+template <typename T>
+T __crt_fast_encode_pointer(T const p)
+{
+    return reinterpret_cast<T>(reinterpret_cast<uintptr_t>(p) ^ host_pointer_cookie);
+}
+
+struct host_encoded_nullptr
+{
+    template <typename T>
+    operator T*() const
+    {
+        return reinterpret_cast<T*>(host_pointer_cookie);
+    }
+};
+
+inline host_encoded_nullptr __crt_fast_encode_pointer(decltype(nullptr))
+{
+    return {};
+}
+
+template <typename T>
+T __crt_fast_decode_pointer(T const p)
+{
+    return reinterpret_cast<T>(reinterpret_cast<uintptr_t>(p) ^ host_pointer_cookie);
+}
+
+// Interlocked operations
+template <typename T>
+T* __crt_interlocked_read_pointer(T* const volatile* const target)
+{
+    return __atomic_load_n(const_cast<T**>(target), __ATOMIC_SEQ_CST);
+}
+
+template <typename T>
+T __crt_interlocked_read(T const volatile* const target)
+{
+    return __atomic_load_n(const_cast<T*>(target), __ATOMIC_SEQ_CST);
+}
+
+template <typename T, typename V>
+T* __crt_interlocked_exchange_pointer(T* const volatile* const target, V const value)
+{
+    return __atomic_exchange_n(const_cast<T**>(target), static_cast<T*>(value), __ATOMIC_SEQ_CST);
+}
+
+template <typename T, typename E, typename C>
+T* __crt_interlocked_compare_exchange_pointer(T* const volatile* const target, E const exchange, C const comparand)
+{
+    T* expected = static_cast<T*>(comparand);
+    __atomic_compare_exchange_n(const_cast<T**>(target), &expected, static_cast<T*>(exchange), false,
+        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+}
+
+// The CRT heap; _malloc_crt_t fails while host_fail_allocations is set
+inline bool host_fail_allocations;
+
+template <typename T>
+class __crt_unique_heap_ptr
+{
+public:
+    explicit __crt_unique_heap_ptr(T* const p = nullptr) throw() : _p(p) { }
+    __crt_unique_heap_ptr(__crt_unique_heap_ptr&& other) throw() : _p(other.detach()) { }
+    ~__crt_unique_heap_ptr() throw() { free(_p); }
+
+    __crt_unique_heap_ptr(__crt_unique_heap_ptr const&) = delete;
+    __crt_unique_heap_ptr& operator=(__crt_unique_heap_ptr const&) = delete;
+
+    T* detach() throw()
+    {
+        T* const p = _p;
+        _p = nullptr;
+        return p;
+    }
+
+    T* get() const throw() { return _p; }
+    explicit operator bool() const throw() { return _p != nullptr; }
+
+private:
+    T* _p;
+};
+
+#define _calloc_crt_t(t, n)      (__crt_unique_heap_ptr<t>(static_cast<t*>(calloc((n), sizeof(t)))))
+#define _malloc_crt_t(t, n)      (__crt_unique_heap_ptr<t>(static_cast<t*>(host_fail_allocations ? nullptr : malloc((n) * sizeof(t)))))
+#define _recalloc_crt_t(t, p, n) (__crt_unique_heap_ptr<t>(static_cast<t*>(realloc((p), (n) * sizeof(t)))))
+#define _free_crt                free
+
+// The exit lock
+inline std::recursive_mutex host_exit_lock;
+
+inline int __acrt_select_exit_lock() throw()
+{
+    return 0;
+}
+
+template <typename Action>
+auto __acrt_lock_and_call(int, Action&& action) throw() -> decltype(action())
+{
+    std::lock_guard<std::recursive_mutex> const hold(host_exit_lock);
+    return action();
+}
+
+extern "C" int __cdecl _initialize_onexit_table(_onexit_table_t*);
+extern "C" int __cdecl _register_onexit_function(_onexit_table_t*, _onexit_t);
+extern "C" int __cdecl _execute_onexit_table(_onexit_table_t*);
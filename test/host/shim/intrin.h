@@ -0,0 +1,51 @@
+//
+// intrin.h (host stand-in)
+//
+// The MSVC intrinsics the runtime's STL sources use, on x64 hosts.
+//
+#pragma once
+
+#include <vcruntime_internal.h>
+
+#include <immintrin.h>
+
+inline unsigned long long _umul128(unsigned long long a, unsigned long long b, unsigned long long* high)
+{
+    unsigned __int128 const product = static_cast<unsigned __int128>(a) * b;
+    *high = static_cast<unsigned long long>(product >> 64);
+    return static_cast<unsigned long long>(product);
+}
+
+inline unsigned char _BitScanForward(unsigned long* index, unsigned long mask)
+{
+    *index = mask == 0 ? 0 : __builtin_ctzl(mask);
+    return mask != 0;
+}
+
+inline unsigned char _BitScanReverse(unsigned long* index, unsigned long mask)
+{
+    *index = mask == 0 ? 0 : 63 - __builtin_clzl(mask);
+    return mask != 0;
+}
+
+inline unsigned char _BitScanForward64(unsigned long* index, unsigned long long mask)
+{
+    *index = mask == 0 ? 0 : __builtin_ctzll(mask);
+    return mask != 0;
+}
+
+inline unsigned char _BitScanReverse64(unsigned long* index, unsigned long long mask)
+{
+    *index = mask == 0 ? 0 : 63 - __builtin_clzll(mask);
+    return mask != 0;
+}
+
+inline unsigned int __popcnt(unsigned int value)
+{
+    return static_cast<unsigned int>(__builtin_popcount(value));
+}
+
+inline unsigned long long __popcnt64(unsigned long long value)
+{
+    return static_cast<unsigned long long>(__builtin_popcountll(value));
+}
@@ -0,0 +1,9 @@
+//
+// intrin0.h (host stand-in)
+//
+// The subset of the intrinsics that MSVC declares for the STL headers; here,
+// the same stand-ins as intrin.h.
+//
+#pragma once
+
+#include <intrin.h>
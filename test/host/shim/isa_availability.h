@@ -0,0 +1,18 @@
+//
+// isa_availability.h (host stand-in)
+//
+// The bits of __isa_enabled; a harness sets __isa_enabled itself to pick the
+// instruction set tier.
+//
+#pragma once
+
+enum ISA_AVAILABILITY
+{
+    __ISA_AVAILABLE_X86     = 0,
+    __ISA_AVAILABLE_SSE2    = 1,
+    __ISA_AVAILABLE_SSE42   = 2,
+    __ISA_AVAILABLE_AVX     = 3,
+    __ISA_AVAILABLE_ENFSTRG = 4,
+    __ISA_AVAILABLE_AVX2    = 5,
+    __ISA_AVAILABLE_AVX512  = 6,
+};
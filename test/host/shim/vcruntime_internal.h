@@ -0,0 +1,246 @@
+//
+// vcruntime_internal.h (host stand-in)
+//
+// The kernel routines and intrinsics used by the runtime sources that the
+// host harnesses in test/host compile as is.  Each maps onto the nearest
+// user-mode equivalent:  threads are std::thread, interlocked operations are
+// sequentially consistent builtins, and dispatcher objects are built from a
+// mutex and a condition variable.
+//
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// The harnesses build for x64 hosts, as the x64 driver
+#define _M_X64 1
+#define _WIN64 1
+
+#define __cdecl
+#define __stdcall
+#define __forceinline inline
+#define _CRTIMP
+
+#define __declspec(x)          __declspec_##x
+#define __declspec_align(n)    __attribute__((aligned(n)))
+#define __declspec_noinline    __attribute__((noinline))
+#define __declspec_noalias
+
+#define SYSTEM_CACHE_ALIGNMENT_SIZE 64
+
+// Structured exception handling: only the path without an exception runs
+// here, on which the __finally block follows the __try block.  __try is the
+// spelling libstdc++ gives it too.
+#ifndef __try
+#define __try try
+#endif
+#define __finally catch (...) { throw; }
+
+// SAL annotations
+#define _In_
+#define _In_z_
+#define _In_opt_
+#define _In_range_(lo, hi)
+#define _In_reads_(n)
+#define _Out_
+#define _Out_opt_
+#define _Inout_
+#define _Inout_z_cap_(n)
+#define _Out_bytecap_(n)
+#define _Out_opt_z_cap_(n)
+#define _Out_writes_(n)
+#define _Out_writes_opt_z_(n)
+#define _Out_writes_bytes_opt_(n)
+#define _Out_writes_to_(n, c)
+#define _Out_writes_to_ptr_(p)
+#define _Success_(e)
+#define _When_(e, a)
+#define _Analysis_assume_(e)
+#define _Analysis_assume_nullterminated_(p)
+
+// LP64: long is the 64-bit type that uint64_t and int64_t name
+#define __int64 long
+
+#ifndef _countof
+#define _countof(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+inline int sprintf_s(char* const buffer, size_t const count, char const* const format, ...)
+{
+    va_list arglist;
+    va_start(arglist, format);
+    int const result = vsnprintf(buffer, count, format, arglist);
+    va_end(arglist);
+    return result;
+}
+
+#define TRUE  1
+#define FALSE 0
+
+typedef int       LONG; // 32 bits, as on Windows
+typedef long long LONGLONG;
+
+union LARGE_INTEGER
+{
+    LONGLONG QuadPart;
+};
+
+inline LARGE_INTEGER KeQueryPerformanceCounter(LARGE_INTEGER* const frequency)
+{
+    if (frequency)
+    {
+        frequency->QuadPart = 1000000000;
+    }
+
+    LARGE_INTEGER counter;
+    counter.QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return counter;
+}
+
+// One distinct address per thread
+inline void* KeGetCurrentThread()
+{
+    alignas(64) static thread_local char thread[64];
+    return thread;
+}
+
+inline unsigned KeQueryActiveProcessorCountEx(unsigned short)
+{
+    return std::thread::hardware_concurrency();
+}
+
+#define ALL_PROCESSOR_GROUPS 0xffff
+
+inline void KeEnterCriticalRegion() {}
+inline void KeLeaveCriticalRegion() {}
+
+inline void YieldProcessor()
+{
+    sched_yield();
+}
+
+template <class T> inline T    ReadNoFence(T const volatile* p)         { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+template <class T> inline T    ReadNoFence64(T const volatile* p)       { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+template <class T> inline T    ReadAcquire(T const volatile* p)         { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+inline void* ReadPointerNoFence(void* volatile const* p)                { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+inline void  WritePointerNoFence(void* volatile* p, void* v)            { __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+inline void  WritePointerRelease(void* volatile* p, void* v)            { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+inline unsigned long long ReadULong64NoFence(unsigned long long const volatile* p) { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+
+template <class T> inline T _InterlockedIncrement(T volatile* p)        { return __atomic_add_fetch(p, 1, __ATOMIC_SEQ_CST); }
+template <class T> inline T _InterlockedDecrement(T volatile* p)        { return __atomic_sub_fetch(p, 1, __ATOMIC_SEQ_CST); }
+template <class T> inline T _InterlockedIncrement64(T volatile* p)      { return __atomic_add_fetch(p, 1, __ATOMIC_SEQ_CST); }
+// The operand type comes from the target alone, so that enumerators and
+// literals of other types convert to it
+template <class T> struct host_operand { using type = T; };
+template <class T> using  host_operand_t = typename host_operand<T>::type;
+
+template <class T> inline T _InterlockedExchange(T volatile* p, host_operand_t<T> v)    { return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST); }
+template <class T> inline T _InterlockedExchangeAdd(T volatile* p, host_operand_t<T> v) { return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST); }
+template <class T> inline T _InterlockedOr(T volatile* p, host_operand_t<T> v)          { return __atomic_fetch_or(p, v, __ATOMIC_SEQ_CST); }
+template <class T> inline T _InterlockedAnd(T volatile* p, host_operand_t<T> v)         { return __atomic_fetch_and(p, v, __ATOMIC_SEQ_CST); }
+
+template <class T> inline T _InterlockedCompareExchange(T volatile* p, host_operand_t<T> exchange, host_operand_t<T> comparand)
+{
+    __atomic_compare_exchange_n(p, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return comparand;
+}
+
+inline void* InterlockedCompareExchangePointer(void* volatile* p, void* exchange, void* comparand)
+{
+    __atomic_compare_exchange_n(p, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return comparand;
+}
+
+#define InterlockedIncrement            _InterlockedIncrement
+#define InterlockedDecrement            _InterlockedDecrement
+#define InterlockedExchange             _InterlockedExchange
+#define InterlockedCompareExchange      _InterlockedCompareExchange
+
+// KSEMAPHORE
+enum { Executive, KernelMode, IO_NO_INCREMENT };
+
+#define MAXLONG 0x7fffffff
+
+struct KSEMAPHORE
+{
+    std::mutex*              lock;
+    std::condition_variable* signal;
+    long                     count;
+};
+
+inline void KeInitializeSemaphore(KSEMAPHORE* const semaphore, long const count, long)
+{
+    semaphore->lock   = new std::mutex;
+    semaphore->signal = new std::condition_variable;
+    semaphore->count  = count;
+}
+
+inline long KeWaitForSingleObject(KSEMAPHORE* const semaphore, int, int, int, void*)
+{
+    std::unique_lock<std::mutex> hold(*semaphore->lock);
+    semaphore->signal->wait(hold, [=] { return semaphore->count > 0; });
+    --semaphore->count;
+    return 0;
+}
+
+inline long KeReleaseSemaphore(KSEMAPHORE* const semaphore, int, long const adjustment, int)
+{
+    std::lock_guard<std::mutex> hold(*semaphore->lock);
+    long const previous = semaphore->count;
+    semaphore->count += adjustment;
+    semaphore->signal->notify_all();
+    return previous;
+}
+
+// Interlocked singly linked lists, behind one lock
+struct SLIST_ENTRY
+{
+    SLIST_ENTRY* Next;
+};
+
+typedef SLIST_ENTRY* PSLIST_ENTRY;
+
+struct _SLIST_HEADER
+{
+    SLIST_ENTRY* First;
+};
+
+inline std::mutex host_slist_lock;
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(_SLIST_HEADER* const header, PSLIST_ENTRY const entry)
+{
+    std::lock_guard<std::mutex> hold(host_slist_lock);
+    PSLIST_ENTRY const first = header->First;
+    entry->Next   = first;
+    header->First = entry;
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedFlushSList(_SLIST_HEADER* const header)
+{
+    std::lock_guard<std::mutex> hold(host_slist_lock);
+    PSLIST_ENTRY const first = header->First;
+    header->First = nullptr;
+    return first;
+}
+
+// Type info stuff
+struct __type_info_node
+{
+    _SLIST_HEADER _Header;
+};
+
+extern "C" size_t __cdecl __vcrt_type_name_hash(_In_z_ char const* Name, _Out_opt_ size_t* Length);
+extern "C" size_t __cdecl __vcrt_hash_type_name(_In_z_ char const* Name, _Out_opt_ size_t* Length);
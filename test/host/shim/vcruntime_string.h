@@ -0,0 +1,6 @@
+//
+// vcruntime_string.h (host stand-in)
+//
+#pragma once
+
+#include <string.h>
@@ -0,0 +1,12 @@
+//
+// vcruntime_typeinfo.h (host stand-in)
+//
+// The layout of the data behind a std::type_info, as the compiler emits it.
+//
+#pragma once
+
+struct __std_type_info_data
+{
+    char const* _UndecoratedName;
+    char const  _DecoratedName[1];
+};
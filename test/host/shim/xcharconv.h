@@ -0,0 +1,9 @@
+//
+// xcharconv.h (host stand-in)
+//
+// std::chars_format and std::to_chars_result, which the host library declares
+// in <charconv> with the same values as the MSVC header.
+//
+#pragma once
+
+#include <charconv>
@@ -0,0 +1,58 @@
+//
+// ymath.h (host stand-in)
+//
+// The floating-point layout macros of the runtime's math sources, for IEEE 754
+// little-endian hosts, and the helpers the header declares.
+//
+#pragma once
+
+#include <yvals.h>
+
+#define _DOFF   4
+#define _DFRAC  ((unsigned short) ((1 << _DOFF) - 1))
+#define _DMASK  ((unsigned short) (0x7fff & ~_DFRAC))
+#define _DMAX   ((unsigned short) ((1 << (15 - _DOFF)) - 1))
+#define _DSIGN  ((unsigned short) 0x8000)
+#define _DBIAS  0x3fe
+
+#define _FOFF   7
+#define _FFRAC  ((unsigned short) ((1 << _FOFF) - 1))
+#define _FMASK  ((unsigned short) (0x7fff & ~_FFRAC))
+#define _FMAX   ((unsigned short) ((1 << (15 - _FOFF)) - 1))
+#define _FSIGN  ((unsigned short) 0x8000)
+#define _FBIAS  0x7e
+
+#define _LOFF   _DOFF
+#define _LFRAC  _DFRAC
+#define _LMASK  _DMASK
+#define _LMAX   _DMAX
+#define _LSIGN  _DSIGN
+#define _LBIAS  _DBIAS
+
+#define _DENORM  (-2)
+#define _FINITE  (-1)
+#define _INFCODE 1
+#define _NANCODE 2
+
+#define _FE_INVALID   0x01
+#define _FE_DIVBYZERO 0x04
+#define _FE_OVERFLOW  0x08
+#define _FE_UNDERFLOW 0x10
+
+_EXTERN_C
+short __cdecl _Dtest(double*);
+short __cdecl _FDtest(float*);
+short __cdecl _LDtest(long double*);
+
+short __cdecl _Exp(double*, double, short);
+short __cdecl _FExp(float*, float, short);
+short __cdecl _LExp(long double*, long double, short);
+
+double      __cdecl _Cosh(double, double);
+float       __cdecl _FCosh(float, float);
+long double __cdecl _LCosh(long double, long double);
+
+double      __cdecl _Sinh(double, double);
+float       __cdecl _FSinh(float, float);
+long double __cdecl _LSinh(long double, long double);
+_END_EXTERN_C
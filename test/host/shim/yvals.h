@@ -0,0 +1,35 @@
+//
+// yvals.h (host stand-in)
+//
+// The STL configuration macros the runtime's STL sources use, for the host
+// harnesses in test/host.
+//
+#pragma once
+
+#include <vcruntime_internal.h>
+
+#define _STD_BEGIN namespace std {
+#define _STD_END   }
+#define _STD       ::std::
+#define _CSTD      ::
+
+#define _EXTERN_C_UNLESS_PURE     extern "C" {
+#define _END_EXTERN_C_UNLESS_PURE }
+
+#define _EXTERN_C     extern "C" {
+#define _END_EXTERN_C }
+
+#define __CLRCALL_PURE_OR_CDECL
+#define _MRTIMP2
+#define _CRTIMP2_PURE
+#define _NODISCARD [[nodiscard]]
+
+#define _TRY_BEGIN try {
+#define _CATCH_ALL } catch (...) {
+#define _RERAISE   throw
+#define _CATCH_END }
+
+#define _CRT_PACKING 8
+
+#include <assert.h>
+#define _STL_ASSERT(cond, mesg) assert((cond) && (mesg))
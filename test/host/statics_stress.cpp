@@ -0,0 +1,175 @@
+//
+// statics_stress.cpp
+//
+// Stress test and benchmark of std::kstatic (kext/kstatic.h) and the guard
+// helpers behind it (src/crt/vcruntime/thread_safe_statics.cpp), run on a
+// development host:
+//
+//     g++ -std=c++17 -O2 -g -pthread -Ishim statics_stress.cpp -o statics_stress
+//     ./statics_stress [bench]
+//
+// Sixteen threads race through 2,000 statics, more than the wait slots, so
+// that many guards share a slot.  Some constructors sleep, so that threads
+// wait on their guard, and some throw the first two times they run, so that
+// a waiter takes over.  Every static must be constructed exactly once, hold
+// the value its constructor gave it, and leave its guard at INT_MIN.  The
+// benchmark times get() once the static is constructed.  Build with
+// -fsanitize=thread to check the orderings.
+//
+// The guard helpers treat int and long as the same size, as they are in the
+// driver, so the source is compiled with long meaning int.
+//
+#include <yvals.h>
+
+#include <atomic>
+#include <vector>
+
+#include "../../kext/kstatic.h"
+
+#define long int
+#include "../../src/crt/vcruntime/thread_safe_statics.cpp"
+#undef long
+
+namespace
+{
+    int const static_count = 2000;
+    int const thread_count = 16;
+
+    int failures;
+
+    void check(bool const condition, char const* const what, int const index)
+    {
+        if (!condition)
+        {
+            printf("static %d: %s\n", index, what);
+            ++failures;
+        }
+    }
+
+    std::atomic<int> constructions[static_count];
+    std::atomic<int> attempts[static_count];
+
+    struct value
+    {
+        explicit value(int const index) : index(index), square(index * index)
+        {
+            if (index % 7 == 0 && attempts[index]++ < 2)
+            {
+                throw index;
+            }
+
+            if (index % 5 == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
+            ++constructions[index];
+        }
+
+        int index;
+        int square;
+    };
+
+    // Guard and storage, as the class lays them out
+    struct kstatic_layout
+    {
+        int guard;
+    };
+
+    void run_round(std::vector<std::kstatic<value>>& statics, int const round)
+    {
+        std::atomic<bool> go{false};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t != thread_count; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                while (!go)
+                {
+                    std::this_thread::yield();
+                }
+
+                // Half the threads walk forward and half backward, from different places
+                for (int n = 0; n != static_count; ++n)
+                {
+                    int const i = t % 2 == 0
+                        ? (n + t * 131 + round) % static_count
+                        : (static_count - 1) - (n + t * 67 + round) % static_count;
+
+                    for (;;)
+                    {
+                        try
+                        {
+                            value const& v = statics[i].get(i);
+                            check(v.index == i && v.square == i * i, "wrong value", i);
+                            break;
+                        }
+                        catch (int const thrown)
+                        {
+                            check(thrown == i, "wrong exception", i);
+                        }
+                    }
+                }
+            });
+        }
+
+        go = true;
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (int i = 0; i != static_count; ++i)
+        {
+            check(constructions[i] == 1, "not constructed exactly once", i);
+            check(reinterpret_cast<kstatic_layout const&>(statics[i]).guard == INT_MIN, "guard not completed", i);
+        }
+    }
+
+    void bench()
+    {
+        static std::kstatic<value> constructed;
+        constructed.get(1);
+
+        int const count = 100000000;
+        int sum = 0;
+
+        auto const start = std::chrono::steady_clock::now();
+        for (int i = 0; i != count; ++i)
+        {
+            sum += constructed.get(1).square;
+            __asm__ volatile("" : "+r"(sum));
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        printf("ns per get() once constructed: %.2f\n",
+            std::chrono::duration<double, std::nano>(stop - start).count() / count);
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    __vcrt_initialize_thread_safe_statics();
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    for (int round = 0; round != 20; ++round)
+    {
+        for (int i = 0; i != static_count; ++i)
+        {
+            constructions[i] = 0;
+            attempts[i]      = 0;
+        }
+
+        std::vector<std::kstatic<value>> statics(static_count);
+        run_round(statics, round);
+    }
+
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,359 @@
+//
+// stod_diff.cpp
+//
+// Differential test of the Eisel-Lemire fast path of _Stodx and _Stofx
+// (src/crt/stl/xxstod.hpp and xeisel.cpp) against the extended-precision
+// Xp_* path it bypasses, run on a development host:
+//
+//     S=../../src/crt/stl
+//     g++ -std=c++17 -O2 -g -w -mlong-double-64 -Ishim stod_diff.cpp \
+//         $S/xstod.cpp $S/xstof.cpp $S/xstopfx.cpp $S/xstoflt.cpp $S/xstoxflt.cpp $S/xeisel.cpp \
+//         $S/xdtento.cpp $S/xfdtento.cpp $S/xprec.cpp $S/xfprec.cpp $S/xdscale.cpp $S/xfdscale.cpp \
+//         $S/xdnorm.cpp $S/xfdnorm.cpp $S/xdint.cpp $S/xfdint.cpp $S/xdunscal.cpp $S/xfdunsca.cpp \
+//         $S/xdtest.cpp $S/xfdtest.cpp $S/xvalues.cpp $S/xfvalues.cpp $S/xferaise.cpp -o stod_diff
+//     ./stod_diff [count [seed]]
+//     ./stod_diff bench
+//
+// This file compiles _Stodx and _Stofx a second time with the fast path
+// disabled, which is the conversion as it was before the fast path.  Every
+// input goes through both, and through the C library's correctly rounded
+// strtod and strtof.  The two must stop at the same character and report
+// the same range error, and where their values differ the fast path must be
+// the one that is correctly rounded.  Inputs are shortest and %.17g
+// representations, random digit strings of up to 25 digits with exponents
+// across the whole range, exact halfway cases, and strings with trailing
+// junk, incomplete exponents and no digits at all.
+//
+// The benchmark times both paths and strtod on short, %.6g and %.17g
+// decimals.
+//
+#include <ymath.h>
+
+#include <charconv>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../src/crt/stl/xmath.hpp"
+
+#define _Eisel_lemire(w, q, rounded, x, perr)  false
+#define _FEisel_lemire(w, q, rounded, x, perr) false
+
+#define _Stodx _Stodx_xp
+#define _Stod  _Stod_xp
+#include "../../src/crt/stl/xstod.cpp"
+#undef _Stodx
+#undef _Stod
+
+#undef FTYPE
+#undef FBITS
+#undef FMAXEXP
+#undef FFUN
+#undef FNAME
+#undef FCONST
+#undef FLIT
+#undef FPMSW
+#undef FSIGNBIT
+#undef FISNEG
+#undef FNEGATE
+#undef ACSIZE
+#undef D16TO7
+#undef D10TO9
+#undef NLONG
+
+#define _Stofx _Stofx_xp
+#define _Stof  _Stof_xp
+#include "../../src/crt/stl/xstof.cpp"
+#undef _Stofx
+#undef _Stof
+
+extern "C" double _Stodx(const char*, char**, long, int*);
+extern "C" float  _Stofx(const char*, char**, long, int*);
+
+namespace
+{
+    struct totals
+    {
+        long inputs;
+        long fixed;         // the fast path is right where the Xp_* path is not
+        long inherited;     // both are wrong the same way, on inputs that take the Xp_* path
+        long failures;
+    };
+
+    totals double_totals;
+    totals float_totals;
+
+    template <class T, class U>
+    U bits_of(T const value)
+    {
+        U bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    template <class T>
+    void report(char const* const kind, std::string const& text, char const* const what, T const fast, T const xp, T const reference)
+    {
+        printf("%s \"%s\": %s\n    fast path: %a\n    Xp_*:      %a\n    reference: %a\n",
+            kind, text.c_str(), what, static_cast<double>(fast), static_cast<double>(xp), static_cast<double>(reference));
+    }
+
+    template <class T, class Convert, class Reference>
+    void check_one(char const* const kind, totals& total, std::string const& text,
+        Convert const fast_convert, Convert const xp_convert, Reference const reference_convert)
+    {
+        using bits_t = std::conditional_t<sizeof(T) == 8, unsigned long long, unsigned int>;
+
+        char* fast_end = nullptr;
+        char* xp_end   = nullptr;
+        int fast_error = 0;
+        int xp_error   = 0;
+
+        T const fast      = fast_convert(text.c_str(), &fast_end, 0, &fast_error);
+        T const xp        = xp_convert(text.c_str(), &xp_end, 0, &xp_error);
+        T const reference = reference_convert(text.c_str(), nullptr);
+
+        ++total.inputs;
+        if (fast_end != xp_end)
+        {
+            if (total.failures++ < 20)
+            {
+                printf("%s \"%s\": stops at %td, Xp_* path at %td\n",
+                    kind, text.c_str(), fast_end - text.c_str(), xp_end - text.c_str());
+            }
+            return;
+        }
+
+        bits_t const fast_bits      = bits_of<T, bits_t>(fast);
+        bits_t const xp_bits        = bits_of<T, bits_t>(xp);
+        bits_t const reference_bits = bits_of<T, bits_t>(reference);
+
+        // A NaN's payload is not compared
+        if (fast != fast && xp != xp)
+        {
+            return;
+        }
+
+        if (fast_bits == xp_bits)
+        {
+            if (fast_error != xp_error && total.failures++ < 20)
+            {
+                report(kind, text, "range error differs", fast, xp, reference);
+            }
+
+            if (fast_bits != reference_bits)
+            {
+                ++total.inherited;
+            }
+        }
+        else if (fast_bits == reference_bits)
+        {
+            ++total.fixed;
+        }
+        else if (total.failures++ < 20)
+        {
+            report(kind, text, "fast path is not correctly rounded", fast, xp, reference);
+        }
+    }
+
+    void check(std::string const& text)
+    {
+        check_one<double>("double", double_totals, text, _Stodx, _Stodx_xp, strtod);
+        check_one<float>("float", float_totals, text, _Stofx, _Stofx_xp, strtof);
+    }
+
+    std::string format(char const* const format, double const value)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), format, value);
+        return buffer;
+    }
+
+    template <class T>
+    std::string shortest(T const value)
+    {
+        char buffer[64];
+        return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+    }
+
+    std::string random_digits(std::mt19937_64& random, int const count)
+    {
+        std::string digits;
+        for (int i = 0; i != count; ++i)
+        {
+            digits += static_cast<char>('0' + random() % 10);
+        }
+
+        return digits;
+    }
+
+    // A decimal of up to 25 digits, with the point and exponent anywhere
+    std::string random_decimal(std::mt19937_64& random)
+    {
+        std::string text = random() % 4 == 0 ? "-" : "";
+        std::string digits = random_digits(random, 1 + static_cast<int>(random() % 25));
+
+        size_t const point = random() % (digits.size() + 1);
+        if (point != digits.size())
+        {
+            digits.insert(point, ".");
+        }
+
+        text += digits;
+        if (random() % 4 != 0)
+        {
+            text += format("e%.0f", static_cast<double>(static_cast<long>(random() % 700) - 360));
+        }
+
+        return text;
+    }
+
+    // The decimal halfway between a value and the next one up, exactly, for
+    // values whose halfway point fits the digits of the fast path
+    template <class T>
+    void check_halfway(std::mt19937_64& random)
+    {
+        constexpr int mantissa_digits = sizeof(T) == 8 ? 53 : 24;
+
+        unsigned long long const mantissa = (random() >> (64 - mantissa_digits)) | (1ULL << (mantissa_digits - 1));
+        int const shift = static_cast<int>(random() % (62 - mantissa_digits));
+
+        // (2m + 1) * 2^(shift - 1), an integer below 2^63
+        unsigned long long const halfway = (2 * mantissa + 1) << shift >> 1;
+        if (shift != 0)
+        {
+            check(std::to_string(halfway));
+            check(std::to_string(halfway - 1));
+            check(std::to_string(halfway + 1));
+        }
+
+        // And scaled down by a power of ten that keeps it exact: x.5 and x.25
+        check(std::to_string(mantissa) + ".5");
+        check(std::to_string(mantissa >> 1) + ".25");
+    }
+
+    void check_special()
+    {
+        static char const* const texts[] = {
+            "0", "-0", "0.0", "0e999999999", "1e-400", "1e400", "-1e400", "2.4703282292062327e-324",
+            "2.4703282292062328e-324", "4.9406564584124654e-324", "2.2250738585072011e-308",
+            "2.2250738585072014e-308", "1.7976931348623157e308", "1.7976931348623158e308",
+            "1.7976931348623159e308", "1.4e-45", "7e-46", "3.4028235e38", "3.4028236e38", "1.17549435e-38",
+            "9007199254740993", "9007199254740992.5", "16777217", "16777216.5", "123456789012345678",
+            "1234567890123456789", "0.1", "0.3", "1e23", "8.589973e9", "1.00000005960464477539",
+            "1.5e", "1.5e+", "1.5e-x", "1.5ex", ".5", "5.", ".", "-", "+.e1", "e5", "  12", "\t-3.25e2x",
+            "0x1p3", "0x1.8p-1", "inf", "-infinity", "nan", "nan(12)", "1,5", "00000000000000000000001",
+            "0.000000000000000000000000000000000000000000001", "100000000000000000000000000000000",
+            "999999999999999999", "9999999999999999999", "4.35679e-10", "1e-45", "1e-46", "3e38", "4e38",
+        };
+
+        for (char const* const text : texts)
+        {
+            check(text);
+        }
+    }
+
+    void fuzz(long const count, unsigned long long const seed)
+    {
+        std::mt19937_64 random(seed);
+        check_special();
+
+        for (long i = 0; i != count; ++i)
+        {
+            unsigned long long const bits = random();
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            float const narrow = static_cast<float>(value);
+
+            check(shortest(value));
+            check(shortest(narrow));
+            check(format("%.17g", value));
+            check(format("%.9g", narrow));
+            check(format("%.6g", value));
+            check(format("%.3f", static_cast<double>(random() % 100000000) / 1000));
+            check(random_decimal(random));
+            check_halfway<double>(random);
+            check_halfway<float>(random);
+
+            // Trailing junk and incomplete exponents
+            std::string junk = random_decimal(random);
+            junk += "e+-x."[random() % 5];
+            check(junk);
+        }
+    }
+
+    template <class Convert>
+    double time_ns(Convert const convert, std::vector<std::string> const& texts)
+    {
+        double sum = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass != 10; ++pass)
+        {
+            for (std::string const& text : texts)
+            {
+                sum += convert(text.c_str());
+            }
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        if (sum == 1.5)
+        {
+            puts("");
+        }
+
+        return std::chrono::duration<double, std::nano>(stop - start).count() / (10.0 * texts.size());
+    }
+
+    void bench()
+    {
+        std::mt19937_64 random(1);
+        std::vector<std::string> short_texts, g6_texts, g17_texts;
+        for (int i = 0; i != 100000; ++i)
+        {
+            double const value = static_cast<double>(random() % 10000000) / 1000;
+            short_texts.push_back(format("%.3f", value));
+
+            unsigned long long const bits = (random() & 0x3FFFFFFFFFFFFFFFULL) | 0x3000000000000000ULL;
+            double scattered;
+            memcpy(&scattered, &bits, sizeof(scattered));
+            g6_texts.push_back(format("%.6g", scattered));
+            g17_texts.push_back(format("%.17g", scattered));
+        }
+
+        struct
+        {
+            char const*                      name;
+            std::vector<std::string> const*  texts;
+        } const sets[] = {{"\"1234.567\"", &short_texts}, {"%.6g", &g6_texts}, {"%.17g", &g17_texts}};
+
+        printf("ns per value     fast path      Xp_*    strtod\n");
+        for (auto const& set : sets)
+        {
+            double const fast = time_ns([](char const* s) { return _Stodx(s, nullptr, 0, nullptr); }, *set.texts);
+            double const xp   = time_ns([](char const* s) { return _Stodx_xp(s, nullptr, 0, nullptr); }, *set.texts);
+            double const libc = time_ns([](char const* s) { return strtod(s, nullptr); }, *set.texts);
+            printf("%-12s %13.1f %9.1f %9.1f\n", set.name, fast, xp, libc);
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    long const               count = argc > 1 ? atol(argv[1]) : 200000;
+    unsigned long long const seed  = argc > 2 ? strtoull(argv[2], nullptr, 0) : 42;
+    fuzz(count, seed);
+
+    for (auto const& [kind, total] : {std::pair<char const*, totals&>{"double", double_totals}, {"float", float_totals}})
+    {
+        printf("%s: %ld inputs, %ld corrected by the fast path, %ld still misrounded by the Xp_* path, %ld failures\n",
+            kind, total.inputs, total.fixed, total.inherited, total.failures);
+    }
+
+    return double_totals.failures != 0 || float_totals.failures != 0;
+}
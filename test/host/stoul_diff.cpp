@@ -0,0 +1,278 @@
+//
+// stoul_diff.cpp
+//
+// Differential test of the word-at-a-time digit scanning of _Stoulx,
+// _Stoullx, _Stoflt and _WStoflt (src/crt/stl/xdigits.hpp) against the
+// character-at-a-time loops it bypasses, run on a development host:
+//
+//     g++ -std=c++17 -O2 -g -w -fshort-wchar -Ishim stoul_diff.cpp -o stoul_diff
+//     ./stoul_diff [count [seed]]
+//
+// This file compiles each parser twice, the second time with _Digits_scan
+// and _Digits_copy replaced by 0, which leaves the loops the parsers had
+// before them.  Every input goes through both, which must agree on the
+// value, the end pointer, *perr and errno.  Inputs mix white space, signs,
+// 0 and 0x prefixes, runs of 0 to 45 digits, letters, exponents, points,
+// and bytes and wide characters outside ASCII, with the bases 0, 2, 8, 10,
+// 16 and 36 and some invalid ones.  Each input is copied so that its null
+// ends a page and the next page is inaccessible:  a scan that reads past
+// the page of the null faults.  Do not build it with AddressSanitizer,
+// which turns the scanning off.
+//
+// unsigned long has 64 bits here, so _Stoulx is compared at that width
+// rather than the 32 bits it has in the driver.  wchar_t is made 16 bits
+// wide, as in the driver, by -fshort-wchar.
+//
+#include <yvals.h>
+
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <clocale>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../../src/crt/stl/xdigits.hpp"
+#include "../../src/crt/stl/xmath.hpp"
+
+static_assert(sizeof(wchar_t) == 2, "build with -fshort-wchar");
+
+namespace swar_ul
+{
+    #include "../../src/crt/stl/xstoul.cpp"
+}
+
+namespace swar_ull
+{
+    #include "../../src/crt/stl/xstoull.cpp"
+}
+
+namespace swar_flt
+{
+    #include "../../src/crt/stl/xstoflt.cpp"
+}
+
+namespace swar_wflt
+{
+    #include "../../src/crt/stl/xwstoflt.cpp"
+}
+
+#define _Digits_scan(ptr, max, val) 0
+#define _Digits_copy(ptr, max, buf) 0
+
+#define _Stoulx   _Stoulx_bytes
+#define _Stoul    _Stoul_bytes
+#define _Stoullx  _Stoullx_bytes
+#define _Stoull   _Stoull_bytes
+#define _Stoflt   _Stoflt_bytes
+#define _WStoflt  _WStoflt_bytes
+
+namespace bytes_ul
+{
+    #include "../../src/crt/stl/xstoul.cpp"
+}
+
+namespace bytes_ull
+{
+    #include "../../src/crt/stl/xstoull.cpp"
+}
+
+namespace bytes_flt
+{
+    #include "../../src/crt/stl/xstoflt.cpp"
+}
+
+namespace bytes_wflt
+{
+    #include "../../src/crt/stl/xwstoflt.cpp"
+}
+
+#undef _Stoulx
+#undef _Stoul
+#undef _Stoullx
+#undef _Stoull
+#undef _Stoflt
+#undef _WStoflt
+
+namespace
+{
+    long inputs;
+    long failures;
+
+    // Two pages, the second inaccessible
+    char* guarded_page;
+    size_t page_size;
+
+    void map_guarded_page()
+    {
+        page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        void* const pages = mmap(nullptr, 2 * page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED || mprotect(static_cast<char*>(pages) + page_size, page_size, PROT_NONE) != 0)
+        {
+            perror("mmap");
+            exit(2);
+        }
+
+        guarded_page = static_cast<char*>(pages);
+    }
+
+    // Copies the string, which ends in its null, to the end of the page or to its start
+    template <class CharT>
+    CharT* place(CharT const* const text, size_t const length, bool const at_end)
+    {
+        size_t const size = (length + 1) * sizeof(CharT);
+        CharT* const copy = reinterpret_cast<CharT*>(at_end ? guarded_page + page_size - size : guarded_page);
+        memcpy(copy, text, size);
+        return copy;
+    }
+
+    void fail(char const* const what, std::string const& text, int const base)
+    {
+        if (failures++ < 20)
+        {
+            printf("%s differs for \"%s\", base %d\n", what, text.c_str(), base);
+        }
+    }
+
+    template <class T, class Parse>
+    void check_integer(char const* const what, Parse const swar, Parse const bytes, std::string const& text, int const base, bool const at_end)
+    {
+        char const* const s = place(text.c_str(), text.size(), at_end);
+
+        char* swar_end  = nullptr;
+        char* bytes_end = nullptr;
+        int swar_error  = -1;
+        int bytes_error = -1;
+
+        errno = 0;
+        T const swar_value = swar(s, &swar_end, base, &swar_error);
+        int const swar_errno = errno;
+
+        errno = 0;
+        T const bytes_value = bytes(s, &bytes_end, base, &bytes_error);
+        int const bytes_errno = errno;
+
+        ++inputs;
+        if (swar_value != bytes_value || swar_end != bytes_end || swar_error != bytes_error || swar_errno != bytes_errno)
+        {
+            fail(what, text, base);
+        }
+    }
+
+    template <class CharT, class Parse>
+    void check_float(char const* const what, Parse const swar, Parse const bytes, std::vector<CharT> const& text,
+        std::string const& narrow, int const maxsig, bool const at_end)
+    {
+        CharT const* const s = place(text.data(), text.size() - 1, at_end);
+
+        long swar_lo[5]  = {};
+        long bytes_lo[5] = {};
+        CharT* swar_end  = nullptr;
+        CharT* bytes_end = nullptr;
+
+        int const swar_words  = swar(s, s, &swar_end, swar_lo, maxsig);
+        int const bytes_words = bytes(s, s, &bytes_end, bytes_lo, maxsig);
+
+        ++inputs;
+        if (swar_words != bytes_words || swar_end != bytes_end
+            || memcmp(swar_lo, bytes_lo, (swar_words + 1) * sizeof(long)) != 0)
+        {
+            fail(what, narrow, maxsig);
+        }
+    }
+
+    std::string random_input(std::mt19937_64& random)
+    {
+        static char const* const pieces[] = {
+            " ", "\t", "-", "+", "0", "0x", "0X", "00", ".", "e", "E", "e-", "e+", "x", "a", "F", "z", "Z", "/", ":",
+            "\x80", "\xb9", "\xff", "\xd9\xa3", "9", "07", "18446744073709551615", "18446744073709551616",
+            "4294967295", "4294967296", "99999999999999999999",
+        };
+
+        std::string text;
+        int const parts = 1 + static_cast<int>(random() % 6);
+        for (int part = 0; part != parts; ++part)
+        {
+            if (random() % 2 == 0)
+            {
+                int const digits = static_cast<int>(random() % 46);
+                int const range  = random() % 4 == 0 ? 2 : 10; // runs of zeros and ones as well
+                for (int i = 0; i != digits; ++i)
+                {
+                    text += static_cast<char>('0' + random() % range);
+                }
+            }
+            else
+            {
+                text += pieces[random() % (sizeof(pieces) / sizeof(pieces[0]))];
+            }
+        }
+
+        return text;
+    }
+
+    // The library's std::wstring has 32-bit characters, so wide strings are vectors
+    std::vector<wchar_t> widen(std::string const& text, std::mt19937_64& random)
+    {
+        std::vector<wchar_t> wide;
+        for (char const c : text)
+        {
+            unsigned char const byte = static_cast<unsigned char>(c);
+            if (byte < 0x80)
+            {
+                // A digit's low byte with a high byte set must not pass for the digit
+                wide.push_back(random() % 64 == 0 ? static_cast<wchar_t>(0x0100 | byte) : static_cast<wchar_t>(byte));
+            }
+            else
+            {
+                wide.push_back(static_cast<wchar_t>(0x0600 | byte)); // Arabic-Indic digits and their neighbours
+            }
+        }
+
+        wide.push_back(L'\0');
+        return wide;
+    }
+
+    void check(std::string const& text, std::mt19937_64& random)
+    {
+        static int const bases[] = {0, 10, 10, 10, 2, 8, 16, 36, 1, -1, 37, 7};
+        int const base = bases[random() % (sizeof(bases) / sizeof(bases[0]))];
+
+        std::vector<char> const chars(text.c_str(), text.c_str() + text.size() + 1);
+        std::vector<wchar_t> const wide = widen(text, random);
+        int const maxsig = 1 + static_cast<int>(random() % 4);
+
+        for (bool const at_end : {true, false})
+        {
+            check_integer<unsigned long>("_Stoulx", swar_ul::_Stoulx, bytes_ul::_Stoulx_bytes, text, base, at_end);
+            check_integer<unsigned long long>("_Stoullx", swar_ull::_Stoullx, bytes_ull::_Stoullx_bytes, text, base, at_end);
+            check_float<char>("_Stoflt", swar_flt::_Stoflt, bytes_flt::_Stoflt_bytes, chars, text, maxsig, at_end);
+            check_float<wchar_t>("_WStoflt", swar_wflt::_WStoflt, bytes_wflt::_WStoflt_bytes, wide, text, maxsig, at_end);
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    long const               count = argc > 1 ? atol(argv[1]) : 1000000;
+    unsigned long long const seed  = argc > 2 ? strtoull(argv[2], nullptr, 0) : 42;
+
+    map_guarded_page();
+
+    std::mt19937_64 random(seed);
+    for (long i = 0; i != count; ++i)
+    {
+        check(random_input(random), random);
+    }
+
+    printf("%ld comparisons, %ld failures\n", inputs, failures);
+    return failures != 0;
+}
@@ -0,0 +1,362 @@
+//
+// tochars_diff.cpp
+//
+// Differential test of __ucxxrt_to_chars_f, __ucxxrt_to_chars_d,
+// __ucxxrt_to_chars_u64 and __ucxxrt_to_chars_i64 (src/crt/stl/xtochars.cpp)
+// against the host library's std::to_chars, run on a development host:
+//
+//     g++ -std=c++17 -O2 -g -w -Ishim -I../.. tochars_diff.cpp -o tochars_diff
+//     ./tochars_diff [count [seed]]
+//     ./tochars_diff bench
+//
+// Each value is formatted by the plain overload, by each chars_format with
+// the shortest round-trip digits, and by each chars_format with a precision:
+// every precision from 0 to 20, and one drawn from up to 1,100, which is
+// past the longest exact expansion of a double.  Values are random bit
+// patterns, integers, short decimals, powers of two and ten and their
+// neighbours, subnormals, zeros, infinities and NaNs of both signs.  Both
+// must give the same text.  The text is then written again to a buffer of
+// exactly its size, which ends a page whose next page is inaccessible, and
+// to one a byte smaller, which must fail without writing past its end.
+// Integers are compared the same way in every base from 2 to 36.
+//
+// The benchmark times both on shortest, fixed with a precision of 6 and
+// scientific with a precision of 17.
+//
+#include <yvals.h>
+
+#include "../../src/crt/stl/xtochars.cpp"
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    long inputs;
+    long failures;
+
+    // Two pages, the second inaccessible
+    char* guarded_page;
+    size_t page_size;
+
+    void map_guarded_page()
+    {
+        page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        void* const pages = mmap(nullptr, 2 * page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED || mprotect(static_cast<char*>(pages) + page_size, page_size, PROT_NONE) != 0)
+        {
+            perror("mmap");
+            exit(2);
+        }
+
+        guarded_page = static_cast<char*>(pages);
+    }
+
+    char const* format_name(int const format)
+    {
+        switch (format)
+        {
+        case 0:
+            return "plain";
+        case static_cast<int>(std::chars_format::scientific):
+            return "scientific";
+        case static_cast<int>(std::chars_format::fixed):
+            return "fixed";
+        case static_cast<int>(std::chars_format::general):
+            return "general";
+        default:
+            return "hex";
+        }
+    }
+
+    template <class F>
+    void fail(char const* const what, F const value, int const format, int const precision, std::string const& expected,
+        std::string const& actual)
+    {
+        if (failures++ < 20)
+        {
+            printf("%s %a, %s, precision %d:\n    expected %.80s\n    actual   %.80s\n", what, static_cast<double>(value),
+                format_name(format), precision, expected.c_str(), actual.c_str());
+        }
+    }
+
+    // MSVC spells the default quiet NaN, which has the sign bit set, -nan(ind), and signaling NaNs
+    // nan(snan); the host library writes nan for all of them
+    template <class F>
+    std::string msvc_nan(F const value)
+    {
+        using limits = std::numeric_limits<F>;
+
+        unsigned long long bits = 0;
+        memcpy(&bits, &value, sizeof(value));
+        unsigned long long const quiet_bit = 1ULL << (limits::digits - 2);
+        unsigned long long const mantissa  = bits & ((quiet_bit << 1) - 1);
+        bool const negative = std::signbit(value);
+
+        std::string const sign = negative ? "-" : "";
+        if (negative && mantissa == quiet_bit)
+        {
+            return sign + "nan(ind)";
+        }
+
+        return sign + ((mantissa & quiet_bit) != 0 ? "nan" : "nan(snan)");
+    }
+
+    // Formats with the host library into a buffer that is large enough
+    template <class F>
+    std::string reference(F const value, int const format, int const precision)
+    {
+        if (std::isnan(value))
+        {
+            return msvc_nan(value);
+        }
+
+        char buffer[2048];
+        std::to_chars_result result;
+        if (format == 0)
+        {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        }
+        else if (precision < 0)
+        {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value, static_cast<std::chars_format>(format));
+        }
+        else
+        {
+            result = std::to_chars(
+                buffer, buffer + sizeof(buffer), value, static_cast<std::chars_format>(format), precision);
+        }
+
+        return result.ec == std::errc{} ? std::string(buffer, result.ptr) : std::string("(too large)");
+    }
+
+    char* runtime(char* const first, char* const last, float const value, int const format, int const precision)
+    {
+        return __ucxxrt_to_chars_f(first, last, value, format, precision);
+    }
+
+    char* runtime(char* const first, char* const last, double const value, int const format, int const precision)
+    {
+        return __ucxxrt_to_chars_d(first, last, value, format, precision);
+    }
+
+    template <class F>
+    void check(F const value, int const format, int const precision)
+    {
+        ++inputs;
+        std::string const expected = reference(value, format, precision);
+
+        char buffer[2048];
+        char* const end = runtime(buffer, buffer + sizeof(buffer), value, format, precision);
+        std::string const actual = end ? std::string(buffer, end) : std::string("(too large)");
+        if (actual != expected)
+        {
+            fail("formats", value, format, precision, expected, actual);
+            return;
+        }
+
+        // Exactly the room the text takes, and one byte less, against the inaccessible page
+        size_t const size = expected.size();
+        char* const exact = guarded_page + page_size - size;
+        char* const exact_end = runtime(exact, guarded_page + page_size, value, format, precision);
+        if (exact_end != guarded_page + page_size || memcmp(exact, expected.data(), size) != 0)
+        {
+            fail("does not fit its exact size", value, format, precision, expected,
+                exact_end ? std::string(exact, exact_end) : std::string("(too large)"));
+        }
+
+        if (size != 0 && runtime(exact + 1, guarded_page + page_size, value, format, precision) != nullptr)
+        {
+            fail("fits a byte less than its size", value, format, precision, expected, "");
+        }
+    }
+
+    template <class F>
+    void check_all_formats(F const value, std::mt19937_64& random)
+    {
+        static int const formats[] = {static_cast<int>(std::chars_format::scientific),
+            static_cast<int>(std::chars_format::fixed), static_cast<int>(std::chars_format::general),
+            static_cast<int>(std::chars_format::hex)};
+
+        check(value, 0, -1);
+        for (int const format : formats)
+        {
+            check(value, format, -1);
+            for (int precision = 0; precision <= 20; ++precision)
+            {
+                check(value, format, precision);
+            }
+
+            check(value, format, static_cast<int>(random() % 1101));
+        }
+    }
+
+    template <class F, class Bits>
+    F random_value(std::mt19937_64& random)
+    {
+        using limits = std::numeric_limits<F>;
+
+        Bits bits = static_cast<Bits>(random());
+        F value;
+        switch (random() % 8)
+        {
+        case 0:
+        case 1:
+        case 2: // any bit pattern
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        case 3: // an integer, which fixed writes in full
+            value = static_cast<F>(static_cast<long long>(random() >> (random() % 64)));
+            break;
+        case 4: // a short decimal, which the shortest digits must give back
+            value = static_cast<F>(static_cast<double>(random() % 100000) / std::pow(10.0, random() % 12));
+            break;
+        case 5: // a power of two or ten, or its neighbour, where the rounding interval is lopsided
+            value = random() % 2 == 0 ? std::ldexp(F{1}, static_cast<int>(random() % (limits::max_exponent
+                    - limits::min_exponent + limits::digits)) + limits::min_exponent - limits::digits)
+                                      : static_cast<F>(std::pow(10.0, static_cast<int>(random() % 80) - 40));
+            value = random() % 3 == 0 ? std::nextafter(value, F{0}) : random() % 2 == 0 ? std::nextafter(value, limits::infinity()) : value;
+            break;
+        case 6: // a subnormal
+            bits &= (Bits{1} << (limits::digits - 1)) - 1;
+            memcpy(&value, &bits, sizeof(value));
+            break;
+        default:
+        {
+            static F const specials[] = {F{0}, limits::min(), limits::max(), limits::denorm_min(), limits::infinity(),
+                limits::quiet_NaN(), limits::epsilon(), F{1}, F{0.5}, F{0.1}, F{9.5}, F{0.95}, F{999999.5}};
+            value = specials[random() % (sizeof(specials) / sizeof(specials[0]))];
+            break;
+        }
+        }
+
+        return random() % 2 == 0 ? -value : value;
+    }
+
+    void check_integer(unsigned long long const bits, int const base)
+    {
+        for (bool const is_signed : {false, true})
+        {
+            ++inputs;
+            char expected[72];
+            char actual[72];
+            std::to_chars_result const result = is_signed
+                ? std::to_chars(expected, expected + sizeof(expected), static_cast<long long>(bits), base)
+                : std::to_chars(expected, expected + sizeof(expected), bits, base);
+            size_t const size = static_cast<size_t>(result.ptr - expected);
+
+            char* const exact = guarded_page + page_size - size;
+            char* const end = is_signed
+                ? __ucxxrt_to_chars_i64(exact, guarded_page + page_size, static_cast<long long>(bits), base)
+                : __ucxxrt_to_chars_u64(exact, guarded_page + page_size, bits, base);
+            bool const same = end == guarded_page + page_size && memcmp(exact, expected, size) == 0;
+            memcpy(actual, exact, end ? static_cast<size_t>(end - exact) : 0);
+
+            // A call that fails may leave anything in the buffer, as std::to_chars may
+            char* const short_end = is_signed
+                ? __ucxxrt_to_chars_i64(exact + 1, guarded_page + page_size, static_cast<long long>(bits), base)
+                : __ucxxrt_to_chars_u64(exact + 1, guarded_page + page_size, bits, base);
+
+            if (!same || short_end != nullptr)
+            {
+                if (failures++ < 20)
+                {
+                    printf("%s %llx in base %d: expected %.*s, actual %.*s\n", is_signed ? "signed" : "unsigned",
+                        bits, base, static_cast<int>(size), expected, end ? static_cast<int>(end - exact) : 0, actual);
+                }
+            }
+        }
+    }
+
+    void fuzz(long const count, unsigned long long const seed)
+    {
+        std::mt19937_64 random(seed);
+        for (long i = 0; i != count; ++i)
+        {
+            check_all_formats(random_value<double, unsigned long long>(random), random);
+            check_all_formats(random_value<float, unsigned int>(random), random);
+
+            unsigned long long const bits = random() >> (random() % 64);
+            check_integer(bits, 2 + static_cast<int>(random() % 35));
+            check_integer(bits, 10);
+        }
+    }
+
+    template <class Format>
+    double time_ns(Format const format, std::vector<double> const& values)
+    {
+        char buffer[512];
+        size_t sum = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass != 10; ++pass)
+        {
+            for (double const value : values)
+            {
+                sum += static_cast<size_t>(format(buffer, buffer + sizeof(buffer), value) - buffer);
+            }
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        if (sum == 1)
+        {
+            puts("");
+        }
+
+        return std::chrono::duration<double, std::nano>(stop - start).count() / (10.0 * values.size());
+    }
+
+    void bench()
+    {
+        std::mt19937_64 random(1);
+        std::vector<double> values;
+        for (int i = 0; i != 200000; ++i)
+        {
+            unsigned long long const bits = (random() & 0x3FFFFFFFFFFFFFFFULL) | 0x3000000000000000ULL;
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            values.push_back(value);
+        }
+
+        constexpr int fixed      = static_cast<int>(std::chars_format::fixed);
+        constexpr int scientific = static_cast<int>(std::chars_format::scientific);
+
+        printf("ns per double        runtime   std::to_chars\n");
+        printf("%-18s %9.1f %15.1f\n", "shortest",
+            time_ns([](char* f, char* l, double v) { return __ucxxrt_to_chars_d(f, l, v, 0, -1); }, values),
+            time_ns([](char* f, char* l, double v) { return std::to_chars(f, l, v).ptr; }, values));
+        printf("%-18s %9.1f %15.1f\n", "fixed, 6",
+            time_ns([](char* f, char* l, double v) { return __ucxxrt_to_chars_d(f, l, v, fixed, 6); }, values),
+            time_ns([](char* f, char* l, double v) { return std::to_chars(f, l, v, std::chars_format::fixed, 6).ptr; },
+                values));
+        printf("%-18s %9.1f %15.1f\n", "scientific, 17",
+            time_ns([](char* f, char* l, double v) { return __ucxxrt_to_chars_d(f, l, v, scientific, 17); }, values),
+            time_ns([](char* f, char* l, double v) {
+                return std::to_chars(f, l, v, std::chars_format::scientific, 17).ptr;
+            }, values));
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    long const               count = argc > 1 ? atol(argv[1]) : 16000;
+    unsigned long long const seed  = argc > 2 ? strtoull(argv[2], nullptr, 0) : 42;
+
+    map_guarded_page();
+    fuzz(count, seed);
+
+    printf("%ld inputs, %ld failures\n", inputs, failures);
+    return failures != 0;
+}
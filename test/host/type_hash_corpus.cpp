@@ -0,0 +1,334 @@
+//
+// type_hash_corpus.cpp
+//
+// Collision count and throughput of __vcrt_hash_type_name
+// (src/crt/vcruntime/std_type_info.cpp) against the FNV-1a loop it
+// replaced, on decorated type names, run on a development host:
+//
+//     g++ -std=c++17 -O2 -g -w -Ishim -I../../src/crt/vcruntime type_hash_corpus.cpp -o type_hash_corpus
+//     ./type_hash_corpus [undname_corpus.txt [count]]
+//
+// The corpus is every name in undname_corpus.txt, and type_info names of
+// class templates from the standard library instantiated over one another
+// to a depth of three: vector, pair, unique_ptr, optional, tuple and map
+// over the basic types, pointers and a few user classes, spelled the way
+// MSVC decorates them.  A sample of the generated names goes through the
+// undecorator, so that the corpus is known to hold real decorations.  The
+// 64-bit hash, and the 32-bit one that x86 folds it to, are counted for
+// names that share a value, next to the count that a random function would
+// give.  Throughput is measured per band of name length, since template
+// names run to hundreds of bytes, on names that fit in the cache.
+//
+#define _VCRT_BUILD
+#include <vcruntime_internal.h>
+#include <corecrt_internal.h>
+#include <intrin.h>
+
+#include "../../src/crt/vcruntime/undname.cxx"
+#include "../../src/crt/vcruntime/std_type_info.cpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// The memo in ehcache.cpp, which is not built here
+extern "C" size_t __cdecl __vcrt_type_name_hash(char const* const name, size_t* const length)
+{
+    return __vcrt_hash_type_name(name, length);
+}
+
+namespace
+{
+    // __std_type_info_hash before __vcrt_hash_type_name, for x64
+    size_t fnv1a_type_name(char const* const name)
+    {
+        size_t const fnv_offset_basis = 14695981039346656037ULL;
+        size_t const fnv_prime        = 1099511628211ULL;
+
+        size_t value = fnv_offset_basis;
+        for (char const* it = name; *it != '\0'; ++it)
+        {
+            value ^= static_cast<size_t>(static_cast<unsigned char>(*it));
+            value *= fnv_prime;
+        }
+
+        value ^= value >> 32;
+        return value;
+    }
+
+    size_t new_type_name(char const* const name)
+    {
+        return __vcrt_hash_type_name(name, nullptr);
+    }
+
+    bool load_corpus(char const* const path, std::unordered_set<std::string>& names)
+    {
+        FILE* const file = fopen(path, "r");
+        if (!file)
+        {
+            perror(path);
+            return false;
+        }
+
+        char buffer[4096];
+        while (fgets(buffer, sizeof(buffer), file))
+        {
+            buffer[strcspn(buffer, "\t\r\n")] = '\0';
+            if (buffer[0] != '\0' && buffer[0] != '#')
+            {
+                names.insert(buffer);
+            }
+        }
+
+        fclose(file);
+        return true;
+    }
+
+    // A type as it appears in a template argument list, and whether it is a class type
+    struct type_code
+    {
+        std::string code;
+        bool        is_class;
+    };
+
+    type_code class_type(char const kind, std::string const& qualified_name)
+    {
+        return {kind + qualified_name, true};
+    }
+
+    std::string in_std(std::string const& name_and_arguments)
+    {
+        return "?$" + name_and_arguments + "@std@@";
+    }
+
+    // The class templates, each from the codes of its arguments
+    std::vector<type_code> instantiate(type_code const& t, type_code const& u, type_code const& v)
+    {
+        std::string const allocator = "V" + in_std("allocator@" + t.code);
+        std::string const pair_kv   = "U" + in_std("pair@$$CB" + t.code + u.code);
+
+        return {
+            class_type('V', in_std("vector@" + t.code + allocator)),
+            class_type('U', in_std("pair@" + t.code + u.code)),
+            class_type('V', in_std("unique_ptr@" + t.code + "U" + in_std("default_delete@" + t.code))),
+            class_type('V', in_std("optional@" + t.code)),
+            class_type('V', in_std("tuple@" + t.code + u.code + v.code)),
+            class_type('V', in_std("map@" + t.code + u.code + "U" + in_std("less@" + t.code) + "V"
+                + in_std("allocator@" + pair_kv))),
+        };
+    }
+
+    void generate(std::unordered_set<std::string>& names, size_t const count, std::mt19937_64& random)
+    {
+        std::vector<type_code> levels[3];
+        for (char const* const basic : {"H", "D", "E", "F", "G", "I", "J", "K", "M", "N", "_J", "_K", "_N", "_W",
+                 "PEAH", "PEBD", "PEAX", "PEBN"})
+        {
+            levels[0].push_back({basic, false});
+        }
+
+        for (char const* const user : {"widget@app@@", "gadget@detail@app@@", "node@@", "?$handle@H@io@@"})
+        {
+            levels[0].push_back(class_type('V', user));
+            levels[0].push_back(class_type('U', user));
+        }
+
+        auto const pick = [&random](std::vector<type_code> const& from) -> type_code const& {
+            return from[random() % from.size()];
+        };
+
+        // Each level instantiates the templates over types from the level below and the basic types
+        for (int level = 1; level != 3; ++level)
+        {
+            size_t const per_level = level == 1 ? 20000 : 8 * count;
+            while (levels[level].size() < per_level)
+            {
+                std::vector<type_code> const& below = levels[level - 1];
+                type_code const& t = random() % 2 == 0 ? pick(below) : pick(levels[0]);
+                for (type_code const& made : instantiate(t, pick(below), pick(levels[0])))
+                {
+                    levels[level].push_back(made);
+                    if (made.is_class)
+                    {
+                        names.insert(".?A" + made.code);
+                    }
+                }
+
+                if (names.size() >= count)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    // Generated names that the undecorator cannot read, out of every 64th
+    size_t check_sample(std::vector<std::string> const& names)
+    {
+        size_t unreadable = 0;
+        for (size_t i = 0; i < names.size(); i += 64)
+        {
+            if (names[i].compare(0, 3, ".?A") != 0)
+            {
+                continue;
+            }
+
+            char* const result = __unDNameEx(nullptr, names[i].c_str() + 1, 0, malloc, free, nullptr,
+                UNDNAME_32_BIT_DECODE | UNDNAME_TYPE_ONLY);
+            if (!result || strchr(result, '?') || strstr(result, "UNKNOWN"))
+            {
+                if (unreadable++ < 5)
+                {
+                    printf("unreadable: %s -> %s\n", names[i].c_str(), result ? result : "(null)");
+                }
+            }
+
+            free(result);
+        }
+
+        return unreadable;
+    }
+
+    // Names that share their value with an earlier name
+    size_t collisions(std::vector<size_t> values)
+    {
+        std::sort(values.begin(), values.end());
+        return static_cast<size_t>(values.end() - std::unique(values.begin(), values.end()));
+    }
+
+    template <class Hash>
+    void report_collisions(char const* const name, Hash const hash, std::vector<std::string> const& names)
+    {
+        std::vector<size_t> full, folded;
+        for (std::string const& text : names)
+        {
+            size_t const value = hash(text.c_str());
+            full.push_back(value);
+            folded.push_back(static_cast<uint32_t>(value ^ (value >> 32)));
+        }
+
+        printf("%-10s %14zu %14zu\n", name, collisions(full), collisions(folded));
+    }
+
+    template <class Hash>
+    double gbps(Hash const hash, std::vector<char const*> const& names, size_t const bytes)
+    {
+        if (names.empty())
+        {
+            return 0;
+        }
+
+        size_t const passes = std::max<size_t>(1, (size_t{1} << 30) / bytes);
+        volatile size_t sink = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass != passes; ++pass)
+        {
+            for (char const* const text : names)
+            {
+                sink = sink + hash(text);
+            }
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        return static_cast<double>(bytes) * passes / std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+
+    // Up to 2,000 names of each band, packed together so that they stay in the cache, as the names a
+    // program hashes over and over would
+    void report_throughput(std::vector<std::string> const& names, std::mt19937_64& random)
+    {
+        struct band
+        {
+            char const*              name;
+            size_t                   shortest;
+            size_t                   longest;
+            std::vector<char const*> texts;
+            size_t                   bytes;
+            std::vector<char>        packed;
+        };
+
+        band bands[] = {
+            {"1-16", 1, 16, {}, 0, {}},
+            {"17-64", 17, 64, {}, 0, {}},
+            {"65-256", 65, 256, {}, 0, {}},
+            {"257-", 257, SIZE_MAX, {}, 0, {}},
+            {"all", 1, SIZE_MAX, {}, 0, {}},
+        };
+
+        std::vector<std::string const*> shuffled;
+        for (std::string const& text : names)
+        {
+            shuffled.push_back(&text);
+        }
+
+        std::shuffle(shuffled.begin(), shuffled.end(), random);
+        for (band& b : bands)
+        {
+            std::vector<size_t> offsets;
+            for (std::string const* const text : shuffled)
+            {
+                if (text->size() >= b.shortest && text->size() <= b.longest && offsets.size() != 2000)
+                {
+                    offsets.push_back(b.packed.size());
+                    b.packed.insert(b.packed.end(), text->c_str(), text->c_str() + text->size() + 1);
+                    b.bytes += text->size();
+                }
+            }
+
+            for (size_t const offset : offsets)
+            {
+                b.texts.push_back(b.packed.data() + offset);
+            }
+        }
+
+        printf("\nGB/s        names     FNV-1a    new hash\n");
+        for (band const& b : bands)
+        {
+            printf("%-8s %8zu %10.2f %11.2f\n", b.name, b.texts.size(), gbps(fnv1a_type_name, b.texts, b.bytes),
+                gbps(new_type_name, b.texts, b.bytes));
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    char const* const path  = argc > 1 ? argv[1] : "undname_corpus.txt";
+    size_t const      count = argc > 2 ? strtoull(argv[2], nullptr, 0) : 2000000;
+
+    std::unordered_set<std::string> unique_names;
+    if (!load_corpus(path, unique_names))
+    {
+        return 2;
+    }
+
+    size_t const from_file = unique_names.size();
+    std::mt19937_64 random(1);
+    generate(unique_names, count, random);
+
+    std::vector<std::string> names(unique_names.begin(), unique_names.end());
+    std::sort(names.begin(), names.end());
+
+    size_t longest = 0, total = 0;
+    for (std::string const& text : names)
+    {
+        longest = std::max(longest, text.size());
+        total  += text.size();
+    }
+
+    size_t const unreadable = check_sample(names);
+    printf("%zu names, %zu from %s; %zu bytes on average, %zu at most; %zu of the sample unreadable\n\n",
+        names.size(), from_file, path, total / names.size(), longest, unreadable);
+
+    // n (n - 1) / 2 pairs, each colliding with probability 2^-bits
+    double const n = static_cast<double>(names.size());
+    printf("collisions     64-bit         32-bit\n");
+    report_collisions("FNV-1a", fnv1a_type_name, names);
+    report_collisions("new hash", new_type_name, names);
+    printf("%-10s %14.2g %14.1f\n", "random", n * (n - 1) / 2 / 18446744073709551616.0, n * (n - 1) / 2 / 4294967296.0);
+
+    report_throughput(names, random);
+    return unreadable != 0;
+}
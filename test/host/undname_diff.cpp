@@ -0,0 +1,415 @@
+//
+// undname_diff.cpp
+//
+// Differential test of the undecorator (src/crt/vcruntime/undname.cxx and
+// undname.inl) against a reference undecorator, run on a development host:
+//
+//     g++ -std=c++17 -O1 -g -pthread -Ishim -I../../src/crt/vcruntime \
+//         undname_diff.cpp -o undname_diff
+//     ./undname_diff undname_corpus.txt [llvm-undname]
+//
+// Each line of the corpus is a decorated name, optionally followed by a tab
+// and the undecoration MSVC produces.  Names without an expectation are
+// compared with the output of llvm-undname; the expectation is given where
+// llvm-undname prints a name differently from MSVC.  Lines that start with
+// '.' are type_info names, undecorated the way __std_type_info_name does;
+// their reference is the RTTI type descriptor of the same type.  Spacing
+// and __ptr64 are not compared.
+//
+// The corpus is then undecorated from eight threads at once, half of them
+// re-entering the undecorator from their allocator the way a type_info::name
+// call could, through an arena too small to hold anything.  As many threads
+// as the undecorator has slots then stop inside their allocators, and one
+// more undecoration must fail rather than wait.  Last, every prefix of every
+// name is undecorated to catch overruns on truncated input (build with
+// -fsanitize=address,undefined for that pass to mean something).
+//
+#define _VCRT_BUILD
+#include <vcruntime_internal.h>
+
+#include "../../src/crt/vcruntime/undname.cxx"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct corpus_entry
+    {
+        std::string decorated;
+        std::string expected;
+        bool        type_only;
+        int         line;
+    };
+
+    std::vector<corpus_entry> corpus;
+    std::vector<std::string>  undecorated;
+
+    unsigned long flags_for(corpus_entry const& entry)
+    {
+        return entry.type_only ? UNDNAME_32_BIT_DECODE | UNDNAME_TYPE_ONLY : UNDNAME_COMPLETE;
+    }
+
+    char const* input_for(corpus_entry const& entry)
+    {
+        return entry.decorated.c_str() + (entry.type_only ? 1 : 0);
+    }
+
+    std::string undecorate(corpus_entry const& entry)
+    {
+        char* const result = __unDNameEx(nullptr, input_for(entry), 0, malloc, free, nullptr, flags_for(entry));
+        std::string text = result ? result : "(null)";
+        free(result);
+        return text;
+    }
+
+    // Drops __ptr64 and the spaces around punctuation, which the two
+    // undecorators place differently
+    std::string normalize(std::string const& text)
+    {
+        std::string s = text;
+        for (size_t at; (at = s.find("__ptr64")) != std::string::npos; )
+        {
+            s.erase(at, 7);
+        }
+
+        auto const is_punctuation = [](char const c)
+        {
+            return strchr(",<>*&()[]", c) != nullptr;
+        };
+
+        std::string out;
+        for (size_t i = 0; i != s.size(); ++i)
+        {
+            if (s[i] == ' ')
+            {
+                bool const after  = !out.empty() && (out.back() == ' ' || is_punctuation(out.back()));
+                bool const before = i + 1 == s.size() || s[i + 1] == ' ' || is_punctuation(s[i + 1]);
+                if (out.empty() || after || before)
+                {
+                    continue;
+                }
+            }
+
+            out += s[i];
+        }
+
+        return out;
+    }
+
+    bool load_corpus(char const* const path)
+    {
+        FILE* const file = fopen(path, "r");
+        if (!file)
+        {
+            perror(path);
+            return false;
+        }
+
+        char buffer[4096];
+        for (int line = 1; fgets(buffer, sizeof(buffer), file); ++line)
+        {
+            buffer[strcspn(buffer, "\r\n")] = '\0';
+            if (buffer[0] == '\0' || buffer[0] == '#')
+            {
+                continue;
+            }
+
+            corpus_entry entry{};
+            entry.line      = line;
+            entry.type_only = buffer[0] == '.';
+
+            char* const tab = strchr(buffer, '\t');
+            if (tab)
+            {
+                *tab = '\0';
+                entry.expected = tab + 1;
+            }
+
+            entry.decorated = buffer;
+            corpus.push_back(entry);
+        }
+
+        fclose(file);
+        return true;
+    }
+
+    // Fills in the expectations left empty from the reference undecorator
+    bool run_reference(char const* const reference)
+    {
+        char input[] = "/tmp/undname_diff_XXXXXX";
+        int const fd = mkstemp(input);
+        if (fd < 0)
+        {
+            perror("mkstemp");
+            return false;
+        }
+
+        std::vector<corpus_entry*> pending;
+        FILE* const names = fdopen(fd, "w");
+        for (corpus_entry& entry : corpus)
+        {
+            if (!entry.expected.empty())
+            {
+                continue;
+            }
+
+            if (entry.type_only)
+            {
+                fprintf(names, "??_R0%s@8\n", input_for(entry));
+            }
+            else
+            {
+                fprintf(names, "%s\n", entry.decorated.c_str());
+            }
+
+            pending.push_back(&entry);
+        }
+        fclose(names);
+
+        std::string const command = std::string(reference) + " < " + input + " 2>/dev/null";
+        FILE* const output = popen(command.c_str(), "r");
+        if (!output)
+        {
+            perror(reference);
+            remove(input);
+            return false;
+        }
+
+        // Each name is echoed, then followed by its undecoration and a blank
+        // line, or by just the blank line when the reference rejects it
+        char buffer[4096];
+        size_t index = 0;
+        while (index != pending.size() && fgets(buffer, sizeof(buffer), output))
+        {
+            if (!fgets(buffer, sizeof(buffer), output))
+            {
+                break;
+            }
+
+            buffer[strcspn(buffer, "\r\n")] = '\0';
+
+            corpus_entry& entry = *pending[index++];
+            if (buffer[0] == '\0')
+            {
+                entry.expected = "(rejected by reference)";
+                continue;
+            }
+
+            entry.expected = buffer;
+            fgets(buffer, sizeof(buffer), output);
+
+            // The reference prints the type descriptor as the declarator of
+            // the type, inside any parentheses
+            if (entry.type_only)
+            {
+                static char const descriptor[] = "`RTTI Type Descriptor'";
+                size_t const at = entry.expected.find(descriptor);
+                if (at != std::string::npos)
+                {
+                    entry.expected.erase(at, sizeof(descriptor) - 1);
+                }
+            }
+        }
+
+        // The exit status is nonzero when any name was rejected
+        pclose(output);
+        remove(input);
+
+        if (index != pending.size())
+        {
+            fprintf(stderr, "%s: %zu of %zu names undecorated\n", reference, index, pending.size());
+            return false;
+        }
+
+        return true;
+    }
+
+
+
+    thread_local int nested_depth;
+
+    // Undecorates another name from inside the allocator
+    void* __cdecl nested_alloc(size_t const size)
+    {
+        if (nested_depth++ == 0)
+        {
+            size_t const i = size % corpus.size();
+            if (undecorate(corpus[i]) != undecorated[i])
+            {
+                fprintf(stderr, "line %d: nested undecoration differs\n", corpus[i].line);
+                abort();
+            }
+        }
+
+        --nested_depth;
+        return malloc(size);
+    }
+
+    int run_threads()
+    {
+        int failures = 0;
+
+        std::vector<std::thread> threads;
+        std::vector<int>         results(8);
+        for (int t = 0; t != 8; ++t)
+        {
+            threads.emplace_back([t, &results]
+            {
+                char arena[16];
+                for (int pass = 0; pass != 20; ++pass)
+                {
+                    for (size_t i = 0; i != corpus.size(); ++i)
+                    {
+                        char* const result = __unDNameInArena(
+                            nullptr, input_for(corpus[i]), 0, (t & 1) ? nested_alloc : malloc, free,
+                            nullptr, flags_for(corpus[i]), arena, sizeof(arena));
+
+                        if (!result || undecorated[i] != result)
+                        {
+                            ++results[t];
+                        }
+
+                        free(result);
+                    }
+                }
+            });
+        }
+
+        for (size_t t = 0; t != threads.size(); ++t)
+        {
+            threads[t].join();
+            failures += results[t];
+        }
+
+        return failures;
+    }
+
+    std::mutex              holding_lock;
+    std::condition_variable holding_changed;
+    unsigned                holding;
+    bool                    holding_released;
+
+    // Keeps the undecoration running until the slots have all been tried
+    void* __cdecl holding_alloc(size_t const size)
+    {
+        std::unique_lock<std::mutex> lock(holding_lock);
+        if (!holding_released)
+        {
+            ++holding;
+            holding_changed.notify_all();
+            holding_changed.wait(lock, [] { return holding_released; });
+        }
+
+        return malloc(size);
+    }
+
+    // Undecorations past the last slot fail, and the slots are free again once
+    // the undecorations holding them complete
+    int run_exhaustion()
+    {
+        int failures = 0;
+
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t != currentHeapSlots; ++t)
+        {
+            threads.emplace_back([]
+            {
+                char arena[16];
+                free(__unDNameInArena(nullptr, input_for(corpus[0]), 0, holding_alloc, free,
+                    nullptr, flags_for(corpus[0]), arena, sizeof(arena)));
+            });
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(holding_lock);
+            holding_changed.wait(lock, [] { return holding == currentHeapSlots; });
+        }
+
+        char* const refused = __unDNameEx(nullptr, input_for(corpus[0]), 0, malloc, free, nullptr,
+            flags_for(corpus[0]));
+        if (refused)
+        {
+            printf("undecoration succeeded with every slot taken\n");
+            free(refused);
+            ++failures;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(holding_lock);
+            holding_released = true;
+        }
+
+        holding_changed.notify_all();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (undecorate(corpus[0]) != undecorated[0])
+        {
+            printf("undecoration differs after the slots were released\n");
+            ++failures;
+        }
+
+        return failures;
+    }
+
+    void run_prefixes()
+    {
+        char output[64];
+        for (corpus_entry const& entry : corpus)
+        {
+            std::string const name = input_for(entry);
+            for (size_t length = 0; length != name.size(); ++length)
+            {
+                std::string const prefix = name.substr(0, length);
+                free(__unDNameEx(nullptr, prefix.c_str(), 0, malloc, free, nullptr, flags_for(entry)));
+
+                // And into a user buffer that is too small
+                __unDNameEx(output, prefix.c_str(), sizeof(output), malloc, free, nullptr, flags_for(entry));
+            }
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    char const* const path      = argc > 1 ? argv[1] : "undname_corpus.txt";
+    char const* const reference = argc > 2 ? argv[2] : "llvm-undname";
+
+    if (!load_corpus(path) || corpus.empty() || !run_reference(reference))
+    {
+        return 2;
+    }
+
+    int mismatches = 0;
+    for (corpus_entry const& entry : corpus)
+    {
+        std::string const result = undecorate(entry);
+        undecorated.push_back(result);
+
+        if (normalize(result) != normalize(entry.expected))
+        {
+            printf("line %d: %s\n    undname:   %s\n    expected:  %s\n",
+                entry.line, entry.decorated.c_str(), result.c_str(), entry.expected.c_str());
+            ++mismatches;
+        }
+    }
+
+    int const thread_failures = run_threads();
+    if (thread_failures != 0)
+    {
+        printf("%d undecorations differ under concurrency\n", thread_failures);
+    }
+
+    int const exhaustion_failures = run_exhaustion();
+
+    run_prefixes();
+
+    printf("%zu names, %d mismatches\n", corpus.size(), mismatches);
+    return mismatches != 0 || thread_failures != 0 || exhaustion_failures != 0;
+}
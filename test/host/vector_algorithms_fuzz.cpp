@@ -0,0 +1,567 @@
+//
+// vector_algorithms_fuzz.cpp
+//
+// Differential fuzzer of the x86 section of src/crt/stl/vector_algorithms.cpp
+// against <algorithm>, run on a development host at each instruction set tier:
+//
+//     g++ -std=c++17 -O2 -g -w -march=native -Ishim vector_algorithms_fuzz.cpp -o vector_algorithms_fuzz
+//     ./vector_algorithms_fuzz [seed]
+//     ./vector_algorithms_fuzz bench
+//
+// The kernels pick their code path from __isa_enabled, which this file
+// defines, so each input runs with it set for AVX-512, AVX2, SSE4.2 and
+// SSE2 in turn; tiers the host does not have are skipped.  Every range is
+// copied so that it either starts right after an inaccessible page or ends
+// right before one:  a kernel that reads outside the range it was given
+// faults.  Small alphabets make matches, near misses and repeated elements
+// common; the integer min/max kernels are run signed and unsigned, and the
+// floating ones with zeros of both signs and infinities.  Lengths run past
+// the portions after which the lane counters and indices would wrap.  The
+// benchmark times each kernel at each tier against the <algorithm> loop on
+// ranges of 64 KB.
+//
+#include <vcruntime_internal.h>
+
+#include "../../src/crt/stl/vector_algorithms.cpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+extern "C" long __isa_enabled = 0;
+
+namespace
+{
+    struct tier
+    {
+        char const* name;
+        long        isa_enabled;
+        bool        available;
+    };
+
+    tier tiers[] = {
+        {"AVX-512", 0x7F, false},
+        {"AVX2",    0x3F, false},
+        {"SSE4.2",  0x1F, false},
+        {"SSE2",    0x03, true},
+    };
+
+    char const* current_tier;
+    long        failures;
+
+    void check(bool const condition, char const* const what, size_t const size, size_t const length)
+    {
+        if (!condition && failures++ < 20)
+        {
+            printf("%s, %zu-byte elements, length %zu: %s\n", current_tier, size, length, what);
+        }
+    }
+
+    // Pages for a range of up to 8 MB, with an inaccessible page on each side
+    class guarded_buffer
+    {
+    public:
+        static constexpr size_t capacity = 1 << 23;
+
+        guarded_buffer()
+        {
+            size_t const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            void* const pages = mmap(nullptr, capacity + 2 * page_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (pages == MAP_FAILED
+                || mprotect(pages, page_size, PROT_NONE) != 0
+                || mprotect(static_cast<char*>(pages) + page_size + capacity, page_size, PROT_NONE) != 0)
+            {
+                perror("mmap");
+                exit(2);
+            }
+
+            _data = static_cast<char*>(pages) + page_size;
+        }
+
+        guarded_buffer(guarded_buffer const&) = delete;
+        guarded_buffer& operator=(guarded_buffer const&) = delete;
+
+        // Copies the elements to the start or the end of the pages
+        template <class T>
+        T* place(std::vector<T> const& elements, bool const at_end)
+        {
+            size_t const size = elements.size() * sizeof(T);
+            T* const copy = reinterpret_cast<T*>(at_end ? _data + capacity - size : _data);
+            if (size != 0)
+            {
+                memcpy(copy, elements.data(), size);
+            }
+
+            return copy;
+        }
+
+    private:
+        char* _data;
+    };
+
+    guarded_buffer haystack_pages;
+    guarded_buffer needle_pages;
+
+    template <class T>
+    std::vector<T> random_elements(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        std::vector<T> elements(length);
+        for (T& element : elements)
+        {
+            element = static_cast<T>(random() % range);
+        }
+
+        return elements;
+    }
+
+    // The needle is usually a copy of part of the haystack, often with one element changed; some are long
+    // enough to take the paths for needles, and sets of elements, that do not fit a vector register
+    template <class T>
+    std::vector<T> random_needle(std::mt19937_64& random, std::vector<T> const& haystack,
+        unsigned long long const range)
+    {
+        size_t const length = random() % 8 == 0 ? random() % 300 : random() % 40;
+        if (haystack.size() < length || random() % 4 == 0)
+        {
+            return random_elements<T>(random, length, range);
+        }
+
+        size_t const first = random() % (haystack.size() - length + 1);
+        std::vector<T> needle(haystack.begin() + static_cast<ptrdiff_t>(first),
+            haystack.begin() + static_cast<ptrdiff_t>(first + length));
+        if (length != 0 && random() % 2 == 0)
+        {
+            needle[random() % length] = static_cast<T>(random() % range);
+        }
+
+        return needle;
+    }
+
+    template <size_t Size>
+    struct search_kernels;
+
+    #define HOST_SEARCH_KERNELS(Size)                                                \
+        template <>                                                                  \
+        struct search_kernels<Size>                                                  \
+        {                                                                            \
+            static constexpr auto search        = __std_search_##Size;               \
+            static constexpr auto find_end      = __std_find_end_##Size;             \
+            static constexpr auto find_first_of = __std_find_first_of_trivial_##Size; \
+        };
+
+    HOST_SEARCH_KERNELS(1)
+    HOST_SEARCH_KERNELS(2)
+
+    #undef HOST_SEARCH_KERNELS
+
+    template <class T>
+    void check_search(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        using kernel = search_kernels<sizeof(T)>;
+
+        std::vector<T> const haystack_elements = random_elements<T>(random, length, range);
+        std::vector<T> const needle_elements   = random_needle(random, haystack_elements, range);
+
+        T const* const first = haystack_pages.place(haystack_elements, random() % 2 == 0);
+        T const* const last  = first + length;
+        T const* const needle      = needle_pages.place(needle_elements, random() % 2 == 0);
+        T const* const needle_last = needle + needle_elements.size();
+
+        check(kernel::search(first, last, needle, needle_elements.size())
+                  == std::search(first, last, needle, needle_last),
+            "search", sizeof(T), length);
+        check(kernel::find_end(first, last, needle, needle_elements.size())
+                  == std::find_end(first, last, needle, needle_last),
+            "find_end", sizeof(T), length);
+        check(kernel::find_first_of(first, last, needle, needle_last)
+                  == std::find_first_of(first, last, needle, needle_last),
+            "find_first_of", sizeof(T), length);
+    }
+
+    template <size_t Size>
+    struct mismatch_kernel;
+
+    #define HOST_MISMATCH_KERNEL(Size)                                               \
+        template <>                                                                  \
+        struct mismatch_kernel<Size>                                                 \
+        {                                                                            \
+            static constexpr auto mismatch = __std_mismatch_##Size;                  \
+        };
+
+    HOST_MISMATCH_KERNEL(1)
+    HOST_MISMATCH_KERNEL(2)
+    HOST_MISMATCH_KERNEL(4)
+    HOST_MISMATCH_KERNEL(8)
+
+    #undef HOST_MISMATCH_KERNEL
+
+    // The second range is a copy of the first with no element changed, or with one or two; the change may
+    // differ from the original in a single bit, so that no lane can be compared by a part of its bytes
+    template <class T>
+    void check_mismatch(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        std::vector<T> const left_elements = random_elements<T>(random, length, range);
+        std::vector<T> right_elements(left_elements);
+        for (unsigned int changes = random() % 3; changes != 0 && length != 0; --changes)
+        {
+            T& element = right_elements[random() % length];
+            element = static_cast<T>(element ^ (T{1} << random() % (8 * sizeof(T))));
+        }
+
+        T const* const left  = haystack_pages.place(left_elements, random() % 2 == 0);
+        T const* const right = needle_pages.place(right_elements, random() % 2 == 0);
+
+        check(mismatch_kernel<sizeof(T)>::mismatch(left, right, length)
+                  == static_cast<size_t>(std::mismatch(left, left + length, right).first - left),
+            "mismatch", sizeof(T), length);
+    }
+
+    template <size_t Size>
+    struct find_kernels;
+
+    #define HOST_FIND_KERNELS(Size)                                                  \
+        template <>                                                                  \
+        struct find_kernels<Size>                                                    \
+        {                                                                            \
+            static constexpr auto find    = __std_find_trivial_##Size;               \
+            static constexpr auto unsized = __std_find_trivial_unsized_##Size;       \
+            static constexpr auto count   = __std_count_trivial_##Size;              \
+            static constexpr auto min     = __std_min_element_##Size;                \
+            static constexpr auto max     = __std_max_element_##Size;                \
+            static constexpr auto minmax  = __std_minmax_element_##Size;             \
+        };
+
+    HOST_FIND_KERNELS(1)
+    HOST_FIND_KERNELS(2)
+    HOST_FIND_KERNELS(4)
+    HOST_FIND_KERNELS(8)
+
+    #undef HOST_FIND_KERNELS
+
+    // The first minimum, the first maximum and the last maximum, as <algorithm> defines them
+    template <class T, class Kernel, class Less>
+    void check_minmax(T const* const first, size_t const length, Kernel const& kernel, Less const less,
+        bool const is_signed, char const* const what)
+    {
+        T const* const last = first + length;
+
+        T const* const min      = std::min_element(first, last, less);
+        T const* const max      = std::max_element(first, last, less);
+        T const* const last_max = std::minmax_element(first, last, less).second;
+
+        check(kernel.min(first, last, is_signed) == min, what, sizeof(T), length);
+        check(kernel.max(first, last, is_signed) == max, what, sizeof(T), length);
+
+        _Min_max_element_t const both = kernel.minmax(first, last, is_signed);
+        check(both._Min == min && both._Max == last_max, what, sizeof(T), length);
+    }
+
+    template <class T>
+    void check_find(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        using kernel   = find_kernels<sizeof(T)>;
+        using signed_t = std::make_signed_t<T>;
+
+        // One more element than the range, for the unsized find to stop at; values near the top of the
+        // range test the signed and unsigned comparisons, but a range of one value leaves every element
+        // equal, so that each lane counter and index reaches its limit
+        std::vector<T> elements = random_elements<T>(random, length + 1, range);
+        for (T& element : elements)
+        {
+            if (range != 1 && random() % 8 == 0)
+            {
+                element = static_cast<T>(~element);
+            }
+        }
+
+        T const value = static_cast<T>(random() % range);
+        elements[length] = value;
+
+        T const* const first = haystack_pages.place(elements, random() % 2 == 0);
+        T const* const last  = first + length;
+
+        check(kernel::find(first, last, value) == std::find(first, last, value), "find", sizeof(T), length);
+        check(kernel::unsized(first, value) == std::find(first, last + 1, value), "unsized find", sizeof(T), length);
+        check(kernel::count(first, last, value) == static_cast<size_t>(std::count(first, last, value)), "count",
+            sizeof(T), length);
+
+        check_minmax(first, length, kernel{}, std::less<T>{}, false, "unsigned min/max");
+        check_minmax(first, length, kernel{},
+            [](T const a, T const b) { return static_cast<signed_t>(a) < static_cast<signed_t>(b); }, true,
+            "signed min/max");
+    }
+
+    struct float_kernels
+    {
+        static constexpr auto min    = __std_min_element_f;
+        static constexpr auto max    = __std_max_element_f;
+        static constexpr auto minmax = __std_minmax_element_f;
+    };
+
+    struct double_kernels
+    {
+        static constexpr auto min    = __std_min_element_d;
+        static constexpr auto max    = __std_max_element_d;
+        static constexpr auto minmax = __std_minmax_element_d;
+    };
+
+    // No NaNs, which <algorithm> leaves unordered; zeros of both signs, which compare equal, and infinities
+    template <class F, class Kernel>
+    void check_floating(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        static constexpr F specials[] = {F{0}, -F{0}, std::numeric_limits<F>::infinity(),
+            -std::numeric_limits<F>::infinity(), std::numeric_limits<F>::max(), std::numeric_limits<F>::lowest(),
+            std::numeric_limits<F>::denorm_min(), -std::numeric_limits<F>::denorm_min()};
+
+        std::vector<F> elements(length);
+        for (F& element : elements)
+        {
+            element = random() % 16 == 0 ? specials[random() % std::size(specials)]
+                                         : static_cast<F>(static_cast<long long>(random() % range) - 2) / 4;
+        }
+
+        F const* const first = haystack_pages.place(elements, random() % 2 == 0);
+        check_minmax(first, length, Kernel{}, std::less<F>{}, false, "floating min/max");
+    }
+
+    template <class T>
+    void check_length(std::mt19937_64& random, size_t const length, unsigned long long const range)
+    {
+        check_find<T>(random, length, range);
+        if constexpr (sizeof(T) == 4)
+        {
+            check_floating<float, float_kernels>(random, length, range);
+        }
+        else if constexpr (sizeof(T) == 8)
+        {
+            check_floating<double, double_kernels>(random, length, range);
+        }
+
+        if constexpr (sizeof(T) <= 2)
+        {
+            check_search<T>(random, length, range);
+        }
+
+        check_mismatch<T>(random, length, range);
+    }
+
+    template <class T>
+    void check_size(std::mt19937_64& random)
+    {
+        for (size_t length = 0; length != 300; ++length)
+        {
+            for (int pass = 0; pass != 20; ++pass)
+            {
+                for (unsigned long long const range : {2ULL, 5ULL, 0ULL})
+                {
+                    check_length<T>(random, length, range == 0 ? ~0ULL : range);
+                }
+            }
+        }
+
+        for (size_t const length : {1000, 4096 + 37, 70000})
+        {
+            for (int pass = 0; pass != 8; ++pass)
+            {
+                check_length<T>(random, length, 3);
+            }
+        }
+
+        // Past the portions of 256 and 65,536 pieces that count, min and max keep their lane counters and
+        // indices for, with pieces of 16, 32 and 64 bytes
+        for (size_t const bytes : {65536 * 16 + 38, 65536 * 32 + 38, 65536 * 64 + 38})
+        {
+            size_t const length = bytes / sizeof(T);
+            check_find<T>(random, length, 3);
+            check_find<T>(random, length, 1);
+        }
+    }
+
+    void fuzz(unsigned long long const seed)
+    {
+        for (tier const& t : tiers)
+        {
+            if (!t.available)
+            {
+                printf("%s: not available on this host\n", t.name);
+                continue;
+            }
+
+            current_tier  = t.name;
+            __isa_enabled = t.isa_enabled;
+
+            // The same inputs at every tier
+            std::mt19937_64 random(seed);
+            check_size<uint8_t>(random);
+            check_size<uint16_t>(random);
+            check_size<uint32_t>(random);
+            check_size<uint64_t>(random);
+            printf("%s: done\n", t.name);
+        }
+    }
+
+    // Gigabytes of haystack per second
+    template <class Run>
+    double time_gbps(Run const run, size_t const bytes)
+    {
+        constexpr int passes = 2000;
+
+        volatile size_t sink = 0;
+        auto const start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass != passes; ++pass)
+        {
+            sink = sink + run();
+        }
+
+        auto const stop = std::chrono::steady_clock::now();
+        return static_cast<double>(bytes) * passes / std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+
+    // A haystack without the needle, any element of the set or the value found, so that each call scans all
+    // of it, and an equal copy of it
+    struct bench_input
+    {
+        uint8_t const* first;
+        uint8_t const* last;
+        uint8_t const* copy;
+    };
+
+    constexpr uint8_t bench_needle[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'z'};
+    constexpr uint8_t bench_set[]    = {'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6'};
+
+    template <class Found>
+    size_t offset(bench_input const& in, Found const* const found)
+    {
+        return static_cast<size_t>(static_cast<uint8_t const*>(static_cast<void const*>(found)) - in.first);
+    }
+
+    void bench()
+    {
+        constexpr size_t length = 65536;
+        std::vector<uint8_t> haystack(length);
+        std::mt19937_64 random(1);
+        for (uint8_t& element : haystack)
+        {
+            element = static_cast<uint8_t>('a' + random() % 16);
+        }
+
+        std::vector<uint8_t> const copy(haystack);
+        bench_input const in = {haystack.data(), haystack.data() + length, copy.data()};
+
+        struct
+        {
+            char const* name;
+            size_t (*kernel)(bench_input const&);
+            size_t (*scalar)(bench_input const&);
+        } const rows[] = {
+            {"search_1",
+                [](bench_input const& in) { return offset(in, __std_search_1(in.first, in.last, bench_needle, 8)); },
+                [](bench_input const& in) {
+                    return offset(in, std::search(in.first, in.last, bench_needle, bench_needle + 8));
+                }},
+            {"find_end_1",
+                [](bench_input const& in) { return offset(in, __std_find_end_1(in.first, in.last, bench_needle, 8)); },
+                [](bench_input const& in) {
+                    return offset(in, std::find_end(in.first, in.last, bench_needle, bench_needle + 8));
+                }},
+            {"find_first_of_1",
+                [](bench_input const& in) {
+                    return offset(in, __std_find_first_of_trivial_1(in.first, in.last, bench_set, bench_set + 11));
+                },
+                [](bench_input const& in) {
+                    return offset(in, std::find_first_of(in.first, in.last, bench_set, bench_set + 11));
+                }},
+            {"mismatch_1",
+                [](bench_input const& in) { return __std_mismatch_1(in.first, in.copy, length); },
+                [](bench_input const& in) { return offset(in, std::mismatch(in.first, in.last, in.copy).first); }},
+            {"find_1",
+                [](bench_input const& in) { return offset(in, __std_find_trivial_1(in.first, in.last, 'z')); },
+                [](bench_input const& in) { return offset(in, std::find(in.first, in.last, 'z')); }},
+            {"count_1",
+                [](bench_input const& in) { return __std_count_trivial_1(in.first, in.last, 'a'); },
+                [](bench_input const& in) { return static_cast<size_t>(std::count(in.first, in.last, 'a')); }},
+            {"minmax_element_1",
+                [](bench_input const& in) {
+                    _Min_max_element_t const both = __std_minmax_element_1(in.first, in.last, false);
+                    return offset(in, both._Min) ^ offset(in, both._Max);
+                },
+                [](bench_input const& in) {
+                    auto const both = std::minmax_element(in.first, in.last);
+                    return offset(in, both.first) ^ offset(in, both.second);
+                }},
+            {"minmax_element_4",
+                [](bench_input const& in) {
+                    _Min_max_element_t const both = __std_minmax_element_4(in.first, in.last, false);
+                    return offset(in, both._Min) ^ offset(in, both._Max);
+                },
+                [](bench_input const& in) {
+                    auto const first = reinterpret_cast<uint32_t const*>(in.first);
+                    auto const both  = std::minmax_element(first, first + length / 4);
+                    return offset(in, both.first) ^ offset(in, both.second);
+                }},
+        };
+
+        printf("GB/s              ");
+        for (tier const& t : tiers)
+        {
+            printf("%9s", t.name);
+        }
+
+        printf("  <algorithm>\n");
+        for (auto const& row : rows)
+        {
+            printf("%-18s", row.name);
+            for (tier const& t : tiers)
+            {
+                if (!t.available)
+                {
+                    printf("%9s", "-");
+                    continue;
+                }
+
+                __isa_enabled = t.isa_enabled;
+                if (row.kernel(in) != row.scalar(in))
+                {
+                    printf("\n%s differs from <algorithm>\n", row.name);
+                    exit(1);
+                }
+
+                printf("%9.2f", time_gbps([&] { return row.kernel(in); }, length));
+            }
+
+            printf("%13.2f\n", time_gbps([&] { return row.scalar(in); }, length));
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    __builtin_cpu_init();
+    tiers[0].available = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+                      && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")
+                      && __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("bmi2");
+    tiers[1].available = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+    tiers[2].available = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    unsigned long long const seed = argc > 1 ? strtoull(argv[1], nullptr, 0) : 1;
+    fuzz(seed);
+
+    printf("%ld failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,453 @@
+//
+// vector_math_sweep.cpp
+//
+// Error sweep of the Estrin-order _Poly and _LPoly (src/crt/stl/xpoly.cpp,
+// xlpoly.cpp), the hand-split cubic of _FSinh, and the batch kernels
+// __std_exp_array, __std_sinh_array and __std_cosh_array
+// (src/crt/stl/vector_math.cpp), run on a development host:
+//
+//     S=../../src/crt/stl
+//     g++ -std=c++17 -O2 -g -w -mavx2 -ffp-contract=off -mlong-double-64 -Ishim vector_math_sweep.cpp \
+//         $S/vector_math.cpp $S/xsinh.cpp $S/xlsinh.cpp $S/xcosh.cpp $S/xexp.cpp $S/xfexp.cpp \
+//         $S/xpoly.cpp $S/xlpoly.cpp $S/xdtest.cpp $S/xfdtest.cpp $S/xldtest.cpp $S/xdscale.cpp \
+//         $S/xfdscale.cpp $S/xldscale.cpp $S/xdnorm.cpp $S/xfdnorm.cpp $S/xlexp.cpp $S/xvalues.cpp \
+//         $S/xfvalues.cpp $S/xlvalues.cpp $S/xferaise.cpp -lquadmath -o vector_math_sweep
+//     ./vector_math_sweep [count [seed]]
+//     ./vector_math_sweep bench
+//
+// _Sinh and _LSinh, the only callers of _Poly and _LPoly, are compiled a
+// second time against the Horner loop _Poly had before, and every input is
+// evaluated both ways; _FSinh is compared with the Horner form of its cubic
+// over every float in [0, 1).  The two orders must never be more than 1 ulp
+// apart.  The batch kernels run on random arrays, with special values,
+// unaligned starts and in place, with __isa_enabled set for AVX2, for SSE2
+// and for neither; their output must match the scalar helpers bit for bit.
+// Errors are measured against __float128 and reported, not checked:  for the
+// two orders, where they differ, and for the batch kernels, which are the
+// scalar helpers'.
+//
+// -mlong-double-64 makes long double the double it is in the driver, and
+// -ffp-contract=off keeps the compiler from fusing the multiply-adds whose
+// order is under test.
+//
+// The benchmark times a dependent chain of degree-5 _Poly calls in both
+// orders, and the batch kernels against the scalar helpers.
+//
+#include <intrin.h>
+#include <isa_availability.h>
+#include <ymath.h>
+
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <quadmath.h>
+
+#include "../../src/crt/stl/xmath.hpp"
+#include "../../kext/kmath.h"
+
+static_assert(sizeof(long double) == sizeof(double), "build with -mlong-double-64");
+
+extern "C" long __isa_enabled;
+long __isa_enabled;
+
+// _Poly and _LPoly as they were
+extern "C" double _Poly_horner(double x, const double* tab, int n) noexcept
+{
+    double y;
+    for (y = *tab; 0 <= --n;)
+    {
+        y = y * x + *++tab;
+    }
+
+    return y;
+}
+
+extern "C" long double _LPoly_horner(long double x, const long double* tab, int n) noexcept
+{
+    long double y;
+    for (y = *tab; 0 <= --n;)
+    {
+        y = y * x + *++tab;
+    }
+
+    return y;
+}
+
+#define _Poly  _Poly_horner
+#define _LPoly _LPoly_horner
+#define _Sinh  _Sinh_horner
+#define _LSinh _LSinh_horner
+
+namespace horner_sinh
+{
+    #include "../../src/crt/stl/xsinh.cpp"
+}
+
+namespace horner_lsinh
+{
+    #include "../../src/crt/stl/xlsinh.cpp"
+}
+
+#undef _Poly
+#undef _LPoly
+#undef _Sinh
+#undef _LSinh
+
+// The coefficients of _FSinh's cubic, for its Horner form
+namespace float_sinh
+{
+    #include "../../src/crt/stl/xfsinh.cpp"
+}
+
+namespace
+{
+    long failures;
+
+    // Distance in representable values
+    long long ordinal(double const value)
+    {
+        long long bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits < 0 ? LLONG_MIN - bits : bits;
+    }
+
+    long long ordinal(float const value)
+    {
+        int bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits < 0 ? INT_MIN - static_cast<long long>(bits) : bits;
+    }
+
+    long long ordinal(long double const value)
+    {
+        return ordinal(static_cast<double>(value));
+    }
+
+    template <class T>
+    long long ulps_apart(T const left, T const right)
+    {
+        return llabs(ordinal(left) - ordinal(right));
+    }
+
+    // Error of value in ulps of the correctly rounded result
+    template <class T>
+    double error_of(T const value, __float128 const reference)
+    {
+        T const rounded = static_cast<T>(reference);
+        if (std::isinf(rounded) || rounded == 0)
+        {
+            return value == rounded ? 0.0 : HUGE_VAL;
+        }
+
+        T const magnitude = std::fabs(rounded);
+        __float128 const ulp = static_cast<__float128>(std::nextafter(magnitude, static_cast<T>(INFINITY))) - magnitude;
+        __float128 const difference = static_cast<__float128>(value) - reference;
+        return static_cast<double>((difference < 0 ? -difference : difference) / ulp);
+    }
+
+    // The library's long double functions expect 80 bits
+    double error_of(long double const value, __float128 const reference)
+    {
+        return error_of(static_cast<double>(value), reference);
+    }
+
+    struct order_totals
+    {
+        char const* name;
+        long        inputs;
+        long        differ;
+        long long   max_apart;
+        double      max_error;          // Estrin order, where the orders differ
+        double      max_error_horner;
+
+        template <class T, class Reference>
+        void add(T const estrin, T const horner, Reference const reference, double const argument)
+        {
+            ++inputs;
+            long long const apart = ulps_apart(estrin, horner);
+            if (apart == 0)
+            {
+                return;
+            }
+
+            ++differ;
+            max_apart = apart > max_apart ? apart : max_apart;
+            if (apart > 1 && failures++ < 20)
+            {
+                printf("%s(%a): Estrin %a, Horner %a, %lld ulp apart\n", name, argument,
+                    static_cast<double>(estrin), static_cast<double>(horner), apart);
+            }
+
+            __float128 const exact = reference(argument);
+            double const error = error_of(estrin, exact);
+            double const error_horner = error_of(horner, exact);
+            max_error = error > max_error ? error : max_error;
+            max_error_horner = error_horner > max_error_horner ? error_horner : max_error_horner;
+        }
+
+        void print() const
+        {
+            printf("%-7s %10ld inputs, %9ld differ, at most %lld ulp apart; where they differ, max error %.3f ulp, %.3f with Horner\n",
+                name, inputs, differ, max_apart, max_error, max_error_horner);
+        }
+    };
+
+    // |x| < 1, where _Sinh and _LSinh evaluate their polynomial
+    void sweep_sinh(long const count, std::mt19937_64& random)
+    {
+        order_totals sinh_totals{"_Sinh"};
+        order_totals lsinh_totals{"_LSinh"};
+
+        std::uniform_real_distribution<double> unit(-1.0, 1.0);
+        for (long i = 0; i != count; ++i)
+        {
+            double x = unit(random);
+            if (i % 4 == 0)
+            {
+                x = std::ldexp(x, -static_cast<int>(random() % 27)); // down to where x is tiny
+            }
+
+            sinh_totals.add(_Sinh(x, 1.0), horner_sinh::_Sinh_horner(x, 1.0), sinhq, x);
+            lsinh_totals.add(_LSinh(x, 1.0L), horner_lsinh::_LSinh_horner(x, 1.0L), sinhq, x);
+        }
+
+        sinh_totals.print();
+        lsinh_totals.print();
+    }
+
+    // Every float in [0, 1)
+    void sweep_fsinh()
+    {
+        order_totals totals{"_FSinh"};
+
+        using float_sinh::p;
+        for (unsigned bits = 0; bits != 0x3f800000u; ++bits)
+        {
+            float x;
+            memcpy(&x, &bits, sizeof(x));
+
+            float horner = x;
+            if (x >= _FRteps._Float)
+            {
+                float const w = x * x;
+                horner += ((p[0] * w + p[1]) * w + p[2]) * w * x;
+            }
+
+            totals.add(_FSinh(x, 1.0F), horner, sinhq, x);
+        }
+
+        totals.print();
+    }
+
+    double exp_scalar(double x)
+    {
+        switch (_Dtest(&x))
+        {
+        case _NANCODE: return x;
+        case _INFCODE: return DSIGN(x) ? 0.0 : x;
+        case 0:        return 1.0;
+        default:       _Exp(&x, 1.0, 0); return x;
+        }
+    }
+
+    double sinh_scalar(double const x) { return _Sinh(x, 1.0); }
+    double cosh_scalar(double const x) { return _Cosh(x, 1.0); }
+
+    struct batch_function
+    {
+        char const* name;
+        void (__stdcall* batch)(double const*, double const*, double*) noexcept;
+        double (*scalar)(double);
+        __float128 (*reference)(__float128);
+        double low;
+        double high;
+    };
+
+    batch_function const batch_functions[] = {
+        {"exp",  __std_exp_array,  exp_scalar,  expq,  -745.0, 710.0},
+        {"sinh", __std_sinh_array, sinh_scalar, sinhq, -25.0,  25.0},
+        {"cosh", __std_cosh_array, cosh_scalar, coshq, -25.0,  25.0},
+    };
+
+    struct isa_tier
+    {
+        char const* name;
+        long        enabled;
+    };
+
+    isa_tier const isa_tiers[] = {
+        {"AVX2",   (1 << __ISA_AVAILABLE_AVX2) | (1 << __ISA_AVAILABLE_SSE2)},
+        {"SSE2",   1 << __ISA_AVAILABLE_SSE2},
+        {"scalar", 0},
+    };
+
+    double random_argument(batch_function const& function, std::mt19937_64& random)
+    {
+        static double const specials[] = {
+            0.0, -0.0, 1.0, -1.0, NAN, -NAN, INFINITY, -INFINITY, 700.0, -700.0, 700.0000001, -700.0000001,
+            709.78, -708.4, -745.2, 5e-324, -5e-324, 1e-300, 0x1p-26, -0x1p-26, 19.08, 19.1, -19.1, 1e-9,
+        };
+
+        switch (random() % 10)
+        {
+        case 0:
+            return specials[random() % std::size(specials)];
+        case 1:
+        case 2:
+        case 3:
+            return std::uniform_real_distribution<double>(-1.5, 1.5)(random);
+        case 4:
+            return std::ldexp(std::uniform_real_distribution<double>(-1.0, 1.0)(random), -static_cast<int>(random() % 60));
+        default:
+            return std::uniform_real_distribution<double>(function.low, function.high)(random);
+        }
+    }
+
+    void sweep_batch(long const count, std::mt19937_64& random)
+    {
+        size_t const size = 1 << 16;
+        std::vector<double> in(size);
+        std::vector<double> out(size);
+
+        for (batch_function const& function : batch_functions)
+        {
+            for (isa_tier const& tier : isa_tiers)
+            {
+                __isa_enabled = tier.enabled;
+
+                long inputs = 0;
+                long mismatches = 0;
+                double max_error = 0;
+                for (long done = 0; done < count; done += size)
+                {
+                    for (double& x : in)
+                    {
+                        x = random_argument(function, random);
+                    }
+
+                    size_t const offset = random() % 3;
+                    bool const in_place = random() % 4 == 0;
+                    double* const dest = in_place ? in.data() : out.data();
+                    std::vector<double> const arguments(in);
+
+                    function.batch(in.data() + offset, in.data() + size, dest + offset);
+
+                    for (size_t i = offset; i != size; ++i)
+                    {
+                        double const x = arguments[i];
+                        double const expected = function.scalar(x);
+                        ++inputs;
+                        if (memcmp(&expected, &dest[i], sizeof(double)) != 0 && !(std::isnan(expected) && std::isnan(dest[i])))
+                        {
+                            ++mismatches;
+                            if (failures++ < 20)
+                            {
+                                printf("%s, %s: f(%a) is %a, the scalar helper gives %a\n",
+                                    function.name, tier.name, x, dest[i], expected);
+                            }
+                        }
+
+                        if (std::isfinite(x) && std::isfinite(dest[i]) && std::fabs(dest[i]) > 0x1p-1022)
+                        {
+                            double const error = error_of(dest[i], function.reference(x));
+                            max_error = error > max_error ? error : max_error;
+                        }
+                    }
+                }
+
+                printf("%-4s %-6s %10ld inputs, %ld differ from the scalar helper; max error %.3f ulp\n",
+                    function.name, tier.name, inputs, mismatches, max_error);
+            }
+        }
+    }
+
+    double nanoseconds_since(std::chrono::steady_clock::time_point const start, double const count)
+    {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    }
+
+    void bench()
+    {
+        int const chain = 20000000;
+        double estrin = 0.3;
+        double horner = 0.3;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i != chain; ++i)
+        {
+            estrin = _Poly(estrin, horner_sinh::p, 5) * 0.5;
+        }
+
+        double const estrin_ns = nanoseconds_since(start, chain);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i != chain; ++i)
+        {
+            horner = _Poly_horner(horner, horner_sinh::p, 5) * 0.5;
+        }
+
+        double const horner_ns = nanoseconds_since(start, chain);
+        printf("_Poly, degree 5, dependent calls: Estrin %.2f ns, Horner %.2f ns (%g)\n", estrin_ns, horner_ns, estrin + horner);
+
+        std::mt19937_64 random(1);
+        std::vector<double> in(4096);
+        std::vector<double> out(in.size());
+        for (double& x : in)
+        {
+            x = std::uniform_real_distribution<double>(-5.0, 5.0)(random);
+        }
+
+        int const rounds = 2000;
+        double const elements = static_cast<double>(rounds) * in.size();
+        printf("ns per element, |x| <= 5       AVX2   SSE2  scalar helper\n");
+        for (batch_function const& function : batch_functions)
+        {
+            double tier_ns[2];
+            for (int t = 0; t != 2; ++t)
+            {
+                __isa_enabled = isa_tiers[t].enabled;
+                start = std::chrono::steady_clock::now();
+                for (int r = 0; r != rounds; ++r)
+                {
+                    function.batch(in.data(), in.data() + in.size(), out.data());
+                }
+
+                tier_ns[t] = nanoseconds_since(start, elements);
+            }
+
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r != rounds; ++r)
+            {
+                for (size_t i = 0; i != in.size(); ++i)
+                {
+                    out[i] = function.scalar(in[i]);
+                }
+            }
+
+            printf("%-4s %30.2f %6.2f %14.2f\n", function.name, tier_ns[0], tier_ns[1], nanoseconds_since(start, elements));
+        }
+    }
+}
+
+int main(int const argc, char** const argv)
+{
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        bench();
+        return 0;
+    }
+
+    long const               count = argc > 1 ? atol(argv[1]) : 4000000;
+    unsigned long long const seed  = argc > 2 ? strtoull(argv[2], nullptr, 0) : 11;
+
+    std::mt19937_64 random(seed);
+    sweep_sinh(count, random);
+    sweep_fsinh();
+    sweep_batch(count, random);
+
+    printf("%ld failures\n", failures);
+    return failures != 0;
+}
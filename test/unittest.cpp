@@ -1,14 +1,31 @@
 #include <Veil/Veil.h>
 #include <kext/kallocator.h>
+#include <kext/kehcache.h>
+#include <kext/kehtelemetry.h>
+#include <kext/kcharconv.h>
+#include <kext/kmath.h>
+#include <kext/kstatic.h>
+#include <kext/kinitializer.h>
+#include <kext/kstartup.h>
+#include <kext/klockit.h>
 
 #include <string>
 #include <random>
 #include <vector>
+#include <memory>
 #include <functional>
 #include <mutex>
 #include <unordered_map>
 #include <system_error>
 #include <thread>
+#include <typeinfo>
+#include <algorithm>
+#include <limits>
+#include <ymath.h>
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <isa_availability.h>
+#endif
 
 #ifndef ASSERT
 #  define ASSERT assert
@@ -63,6 +80,277 @@ namespace UnitTest
     }
 
 
+    extern "C" double __cdecl _Stodx(const char*, char**, long, int*);
+    extern "C" float  __cdecl _Stofx(const char*, char**, long, int*);
+
+    void TEST(StringToFloat)()
+    {
+        const struct { const char* Text; uint64_t Double; uint32_t Float; } Cases[] = {
+            {"0.1", 0x3FB999999999999A, 0x3DCCCCCD},
+            {"1e23", 0x44B52D02C7E14AF6, 0x65A96816},
+            {"9007199254740993", 0x4340000000000000, 0x5A000000},           // halfway, ties to even
+            {"2.2250738585072011e-308", 0x000FFFFFFFFFFFFF, 0x00000000},    // largest subnormal
+            {"4.9406564584124654e-324", 0x0000000000000001, 0x00000000},
+            {"2.4703282292062327e-324", 0x0000000000000000, 0x00000000},    // just below half of the smallest subnormal
+            {"1.7976931348623157e308", 0x7FEFFFFFFFFFFFFF, 0x7F800000},
+            {"1.7976931348623159e308", 0x7FF0000000000000, 0x7F800000},
+            {"1e-400", 0x0000000000000000, 0x00000000},
+            {"123456789012345678", 0x437B69B4BA630F35, 0x5BDB4DA6},
+            {"-3.14159", 0xC00921F9F01B866E, 0xC0490FD0},
+            {"1234.567", 0x40934A449BA5E354, 0x449A5225},
+            {"3.14159265358979323846264338327950288", 0x400921FB54442D18, 0x40490FDB},  // more than 18 digits
+        };
+
+        for (const auto& Case : Cases) {
+            char* End = nullptr;
+            int   Err = 0;
+
+            const auto Double = _Stodx(Case.Text, &End, 0, &Err);
+            const auto Float  = _Stofx(Case.Text, nullptr, 0, nullptr);
+
+            ASSERT(*End == '\0');
+            ASSERT(memcmp(&Double, &Case.Double, sizeof(Double)) == 0);
+            ASSERT(memcmp(&Float, &Case.Float, sizeof(Float)) == 0);
+            ASSERT((Err != 0) == (Case.Double == 0 || Case.Double == 0x7FF0000000000000));
+        }
+
+        // Benchmark: short config style values
+        const char* const Text[] = { "0.5", "1234.567", "-17.25", "3.0e-3", "86400", "0.001", "65.536", "1e6" };
+
+        auto Freq  = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        auto Sum   = 0.0;
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Sum += _Stodx(Text[Idx % _countof(Text)], nullptr, 0, nullptr);
+        }
+
+        const auto Ns = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+        LOG("_Stodx: %lld ns per value (checksum %lld)", Ns, static_cast<long long>(Sum));
+    }
+
+
+    extern "C" unsigned long long __cdecl _Stoullx(const char*, char**, int, int*);
+    extern "C" unsigned long      __cdecl _Stoulx(const char*, char**, int, int*);
+
+    void TEST(StringToInteger)()
+    {
+        const struct { const char* Text; unsigned long long Value; size_t End; int Err; } Cases[] = {
+            {"0", 0, 1, 0},
+            {"  +42,", 42, 5, 0},
+            {"-7", 0ull - 7, 2, 0},
+            {"00000000000000000000123", 123, 23, 0},
+            {"1234567890123456", 1234567890123456, 16, 0},
+            {"12345678901234567;", 12345678901234567, 17, 0},
+            {"18446744073709551615", 18446744073709551615ull, 20, 0},
+            {"18446744073709551616", 18446744073709551615ull, 20, 1},   // 20 digits, overflows on the last one
+            {"99999999999999999999", 18446744073709551615ull, 20, 1},
+            {"184467440737095516150", 18446744073709551615ull, 21, 1},
+            {"x1", 0, 0, 0},
+        };
+
+        for (const auto& Case : Cases) {
+            char* End = nullptr;
+            int   Err = -1;
+
+            ASSERT(_Stoullx(Case.Text, &End, 10, &Err) == Case.Value);
+            ASSERT(static_cast<size_t>(End - Case.Text) == Case.End && Err == Case.Err);
+        }
+
+        char* End = nullptr;
+        int   Err = -1;
+        ASSERT(_Stoulx("4294967295", &End, 10, &Err) == 4294967295ul && *End == '\0' && Err == 0);
+        ASSERT(_Stoulx("4294967296", &End, 10, &Err) == 4294967295ul && *End == '\0' && Err == 1);
+        ASSERT(_Stoulx("9999999999 ", &End, 10, &Err) == 4294967295ul && *End == ' ' && Err == 1);
+        ASSERT(_Stoulx("0x1F", &End, 0, &Err) == 31 && *End == '\0' && Err == 0);
+
+        // Benchmark: policy style values
+        const char* const Text[] = { "0", "17", "443", "65535", "86400", "1048576", "3000000000", "600000000000" };
+
+        auto Freq  = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        auto Sum   = 0ull;
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Sum += _Stoullx(Text[Idx % _countof(Text)], nullptr, 10, nullptr);
+        }
+
+        const auto Ns = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+        LOG("_Stoullx: %lld ns per value (checksum %llu)", Ns, Sum);
+    }
+
+
+    void TEST(FloatToChars)()
+    {
+        const struct { double Value; std::chars_format Fmt; int Precision; const char* Text; } Cases[] = {
+            {0.1, {}, -1, "0.1"},
+            {-0.0, {}, -1, "-0"},
+            {1e23, {}, -1, "1e+23"},
+            {1e23, std::chars_format::fixed, -1, "99999999999999991611392"},   // exact digits above 2^53
+            {1152921504606846976.0, {}, -1, "1152921504606846976"},
+            {5e-324, std::chars_format::scientific, -1, "5e-324"},
+            {1.7976931348623157e308, {}, -1, "1.7976931348623157e+308"},
+            {123456.0, std::chars_format::general, -1, "123456"},
+            {1234567.0, std::chars_format::general, -1, "1.234567e+06"},
+            {0.5, std::chars_format::fixed, 0, "0"},                            // ties to even
+            {2.5, std::chars_format::fixed, 0, "2"},
+            {9.995, std::chars_format::fixed, 2, "9.99"},                       // 9.99499999...
+            {99.96, std::chars_format::fixed, 1, "100.0"},
+            {0.1, std::chars_format::fixed, 20, "0.10000000000000000555"},
+            {9.9999, std::chars_format::general, 3, "10"},
+            {0.0001234, std::chars_format::general, -1, "0.0001234"},
+            {1e100, std::chars_format::general, 3, "1e+100"},
+            {3.14159, std::chars_format::scientific, 3, "3.142e+00"},
+            {1.5, std::chars_format::hex, -1, "1.8p+0"},
+            {1.5, std::chars_format::hex, 0, "2p+0"},
+            {5e-324, std::chars_format::hex, -1, "0.0000000000001p-1022"},
+            {-std::numeric_limits<double>::infinity(), {}, -1, "-inf"},
+            {-std::numeric_limits<double>::quiet_NaN(), {}, -1, "-nan(ind)"},
+        };
+
+        char Buffer[64];
+        for (const auto& Case : Cases) {
+            const auto Result = Case.Fmt == std::chars_format{} ? std::kto_chars(Buffer, Buffer + sizeof(Buffer), Case.Value)
+                              : Case.Precision < 0 ? std::kto_chars(Buffer, Buffer + sizeof(Buffer), Case.Value, Case.Fmt)
+                              : std::kto_chars(Buffer, Buffer + sizeof(Buffer), Case.Value, Case.Fmt, Case.Precision);
+            ASSERT(Result.ec == std::errc{});
+            ASSERT(static_cast<size_t>(Result.ptr - Buffer) == strlen(Case.Text) && memcmp(Buffer, Case.Text, strlen(Case.Text)) == 0);
+
+            // the exact size is enough, one less is not
+            const auto Length = static_cast<size_t>(Result.ptr - Buffer);
+            const auto Short  = Case.Fmt == std::chars_format{} ? std::kto_chars(Buffer, Buffer + Length - 1, Case.Value)
+                              : Case.Precision < 0 ? std::kto_chars(Buffer, Buffer + Length - 1, Case.Value, Case.Fmt)
+                              : std::kto_chars(Buffer, Buffer + Length - 1, Case.Value, Case.Fmt, Case.Precision);
+            ASSERT(Short.ec == std::errc::value_too_large && Short.ptr == Buffer + Length - 1);
+        }
+
+        auto Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), 1e20f, std::chars_format::fixed);
+        ASSERT(Result.ec == std::errc{} && std::string(Buffer, Result.ptr) == "100000002004087734272");
+        Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), 1e-45f, std::chars_format::hex);
+        ASSERT(Result.ec == std::errc{} && std::string(Buffer, Result.ptr) == "0.000002p-126");
+
+        // Shortest output reads back to the same bits
+        auto Rand = std::mt19937_64(0x5EED);
+        for (auto Idx = 0; Idx < 10000; ++Idx) {
+            auto Bits  = Rand();
+            auto Value = 0.0;
+            if ((Bits >> 52 & 0x7FF) == 0x7FF) {
+                continue; // inf or nan
+            }
+
+            memcpy(&Value, &Bits, sizeof(Value));
+
+            Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer) - 1, Value);
+            ASSERT(Result.ec == std::errc{});
+            *Result.ptr = '\0';
+
+            const auto Back = _Stodx(Buffer, nullptr, 0, nullptr);
+            ASSERT(memcmp(&Back, &Value, sizeof(Value)) == 0);
+        }
+
+        // Benchmark: telemetry style values
+        const double Values[] = { 0.5, 1234.567, -17.25, 3.0e-3, 86400.0, 0.1, 65.536, 6.02214076e23 };
+
+        auto Freq   = LARGE_INTEGER();
+        auto Begin  = KeQueryPerformanceCounter(&Freq);
+        auto Length = 0ll;
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Length += std::kto_chars(Buffer, Buffer + sizeof(Buffer), Values[Idx % _countof(Values)]).ptr - Buffer;
+        }
+
+        const auto Ns = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+        LOG("kto_chars: %lld ns per value (checksum %lld)", Ns, Length);
+    }
+
+    int FormatV(char* Buffer, size_t Size, const char* Format, ...)
+    {
+        va_list Args;
+        va_start(Args, Format);
+        const auto Length = _vsnprintf(Buffer, Size, Format, Args);
+        va_end(Args);
+        return Length;
+    }
+
+    void TEST(IntegerToChars)()
+    {
+        const struct { long long Value; int Base; const char* Text; } Cases[] = {
+            {0, 10, "0"},
+            {7, 10, "7"},
+            {-1, 10, "-1"},
+            {99, 10, "99"},
+            {100, 10, "100"},
+            {99999999, 10, "99999999"},
+            {100000000, 10, "100000000"},
+            {4294967295, 10, "4294967295"},
+            {4294967296, 10, "4294967296"},
+            {LLONG_MAX, 10, "9223372036854775807"},
+            {LLONG_MIN, 10, "-9223372036854775808"},
+            {255, 16, "ff"},
+            {-255, 16, "-ff"},
+            {5, 2, "101"},
+            {LLONG_MIN, 2, "-1000000000000000000000000000000000000000000000000000000000000000"},
+            {35, 36, "z"},
+            {1295, 36, "zz"},
+            {511, 8, "777"},
+        };
+
+        char Buffer[80];
+        for (const auto& Case : Cases) {
+            const auto Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), Case.Value, Case.Base);
+            ASSERT(Result.ec == std::errc{});
+            ASSERT(static_cast<size_t>(Result.ptr - Buffer) == strlen(Case.Text) && memcmp(Buffer, Case.Text, strlen(Case.Text)) == 0);
+
+            // the exact size is enough, one less is not
+            const auto Length = static_cast<size_t>(Result.ptr - Buffer);
+            ASSERT(std::kto_chars(Buffer, Buffer + Length, Case.Value, Case.Base).ptr == Buffer + Length);
+
+            const auto Short = std::kto_chars(Buffer, Buffer + Length - 1, Case.Value, Case.Base);
+            ASSERT(Short.ec == std::errc::value_too_large && Short.ptr == Buffer + Length - 1);
+        }
+
+        auto Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), ULLONG_MAX);
+        ASSERT(Result.ec == std::errc{} && std::string(Buffer, Result.ptr) == "18446744073709551615");
+        Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), static_cast<signed char>(-128));
+        ASSERT(Result.ec == std::errc{} && std::string(Buffer, Result.ptr) == "-128");
+        ASSERT(std::kto_string(-42) == "-42" && std::kto_string(0u) == "0");
+        ASSERT(std::kto_string(1.5) == "1.500000");
+
+        // Every length from 1 to 20 digits agrees with the CRT
+        char Expect[32];
+        auto Rand = std::mt19937_64(0x5EED);
+        for (auto Idx = 0; Idx < 10000; ++Idx) {
+            const auto Value = Rand() >> (Idx % 64);
+
+            Result = std::kto_chars(Buffer, Buffer + sizeof(Buffer), Value);
+            ASSERT(Result.ec == std::errc{});
+
+            const auto Length = FormatV(Expect, sizeof(Expect), "%llu", Value);
+            ASSERT(Result.ptr - Buffer == Length && memcmp(Buffer, Expect, Length) == 0);
+        }
+
+        // Benchmark: counters and sizes, as they show up in logs
+        unsigned long long Values[256];
+        for (auto& Value : Values) {
+            Value = Rand() >> (Rand() % 64);
+        }
+
+        auto Freq   = LARGE_INTEGER();
+        auto Begin  = KeQueryPerformanceCounter(&Freq);
+        auto Length = 0ll;
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Length += std::kto_chars(Buffer, Buffer + sizeof(Buffer), Values[Idx % _countof(Values)]).ptr - Buffer;
+        }
+
+        auto Middle = KeQueryPerformanceCounter(nullptr);
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Length += FormatV(Buffer, sizeof(Buffer), "%llu", Values[Idx % _countof(Values)]);
+        }
+
+        const auto End = KeQueryPerformanceCounter(nullptr);
+        LOG("kto_chars: %lld ns per value, _vsnprintf: %lld ns per value (checksum %lld)",
+            (Middle.QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000,
+            (End.QuadPart - Middle.QuadPart) * 1000000000 / Freq.QuadPart / 100000, Length);
+    }
+
+
     void TEST(ThrowInt)()
     {
         try {
@@ -131,6 +419,963 @@ namespace UnitTest
         }
     }
 
+    void TEST(EHCache)()
+    {
+        constexpr auto Count = 1000;
+
+        auto Begin = LARGE_INTEGER();
+        auto End   = LARGE_INTEGER();
+        auto Freq  = LARGE_INTEGER();
+
+        Begin = KeQueryPerformanceCounter(&Freq);
+        for (auto Idx = 0; Idx < Count; ++Idx) {
+            try {
+                throw Idx;
+            }
+            catch (const int& Exception) {
+                ASSERT(Exception == Idx);
+            }
+        }
+        End = KeQueryPerformanceCounter(nullptr);
+
+        LOG("%d throws took %lld us", Count, (End.QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart);
+
+        auto Stats = __ucxxrt_eh_cache_stats();
+        if (__ucxxrt_query_eh_cache_stats(&Stats)) {
+            LOG("function entry: %llu hits, %llu misses; image base: %llu hits, %llu misses; %llu flushes",
+                Stats.function_entry_hits, Stats.function_entry_misses,
+                Stats.image_base_hits, Stats.image_base_misses, Stats.flushes);
+
+            ASSERT(Stats.image_base_hits >= Stats.image_base_misses);
+        }
+    }
+
+    void TEST(ExceptionPtr)()
+    {
+        std::exception_ptr Exception;
+
+        auto Worker = std::thread([&Exception]
+        {
+            try {
+                throw std::string(__FUNCTION__);
+            }
+            catch (...) {
+                Exception = std::current_exception();
+            }
+        });
+        Worker.join();
+
+        ASSERT(Exception != nullptr);
+
+        try {
+            std::rethrow_exception(std::move(Exception));
+        }
+        catch (const std::string& Value) {
+            LOG("rethrown from worker: %s", Value.c_str());
+        }
+        catch (...) {
+            ASSERT(false);
+        }
+    }
+
+    long volatile TEST(EHTelemetryLeft) = 0;
+
+    __declspec(noinline) void TEST(EHTelemetryThrow)()
+    {
+        throw 1;
+    }
+
+    void TEST(EHTelemetry)()
+    {
+        struct Guard
+        {
+            int& mCount;
+            ~Guard() { ++mCount; }
+        };
+
+        const bool Enabled = __ucxxrt_eh_telemetry_enable(true);
+        ASSERT(Enabled);
+
+        int Destructed = 0;
+        for (auto Idx = 0; Idx < 10; ++Idx) {
+            try {
+                Guard Object{ Destructed };
+                throw Idx;
+            }
+            catch (int) {
+            }
+        }
+        ASSERT(Destructed == 10);
+
+        // Throws that end in an __except handler leave their slots claimed.  More
+        // threads than there are slots, all alive at once, must not keep the
+        // next throw from being timed.
+        constexpr auto Leakers = 128;
+        TEST(EHTelemetryLeft) = Leakers;
+
+        auto Workers = std::vector<std::thread>();
+        for (auto Idx = 0; Idx < Leakers; ++Idx) {
+            Workers.emplace_back([]
+            {
+                __try {
+                    TEST(EHTelemetryThrow)();
+                }
+                __except (EXCEPTION_EXECUTE_HANDLER) {
+                }
+
+                InterlockedDecrement(&TEST(EHTelemetryLeft));
+                while (TEST(EHTelemetryLeft) != 0) {
+                    auto Interval = LARGE_INTEGER();
+                    Interval.QuadPart = -10 * 1000; // 1 ms
+                    KeDelayExecutionThread(KernelMode, FALSE, &Interval);
+                }
+            });
+        }
+
+        for (auto& Worker : Workers) {
+            Worker.join();
+        }
+
+        auto Before = __ucxxrt_eh_telemetry();
+        const bool SnapshotBefore = __ucxxrt_eh_telemetry_snapshot(&Before, nullptr, 0, nullptr);
+        ASSERT(SnapshotBefore);
+
+        try {
+            TEST(EHTelemetryThrow)();
+        }
+        catch (int) {
+        }
+
+        __ucxxrt_eh_telemetry_enable(false);
+
+        __ucxxrt_eh_throw_site Sites[4]{};
+        size_t Count = 0;
+        auto Telemetry = __ucxxrt_eh_telemetry();
+        const bool Snapshot = __ucxxrt_eh_telemetry_snapshot(&Telemetry, Sites, _countof(Sites), &Count);
+        ASSERT(Snapshot);
+
+        LOG("throws %llu, catches %llu, frames %llu, destructors %llu, search %llu ticks, unwind %llu ticks",
+            Telemetry.throws, Telemetry.catches, Telemetry.frames_unwound, Telemetry.destructors_run,
+            Telemetry.search_ticks, Telemetry.unwind_ticks);
+
+        ASSERT(Telemetry.throws >= 10 + Leakers + 1);
+        ASSERT(Telemetry.catches == Before.catches + 1);
+        ASSERT(Count >= 1 && Sites[0].count >= 10);
+
+        for (size_t Idx = 0; Idx < Count; ++Idx) {
+            LOG("site %p (ThrowInfo %p): %llu", Sites[Idx].return_address, Sites[Idx].throw_info, Sites[Idx].count);
+        }
+    }
+
+    namespace CastHierarchy
+    {
+        struct SIBase    { virtual ~SIBase() = default; };
+        struct SIMiddle  : SIBase   {};
+        struct SIDerived : SIMiddle {};
+
+        struct MILeft    { virtual ~MILeft() = default; };
+        struct MIRight   { virtual ~MIRight() = default; };
+        struct MIDerived : MILeft, MIRight {};
+
+        struct VIBase    { virtual ~VIBase() = default; };
+        struct VILeft    : virtual VIBase {};
+        struct VIRight   : virtual VIBase {};
+        struct VIDerived : VILeft, VIRight {};
+    }
+
+    void TEST(DynamicCast)()
+    {
+        using namespace CastHierarchy;
+
+        constexpr auto Count = 100000;
+
+        SIDerived SI;
+        MIDerived MI;
+        VIDerived VI;
+        MILeft    Unrelated;
+
+        SIBase*  SISource        = &SI;
+        MILeft*  MISource        = &MI;
+        VIBase*  VISource        = &VI;
+        MILeft*  UnrelatedSource = &Unrelated;
+
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&Freq](auto&& Cast)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < Count; ++Idx) {
+                Cast();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart;
+        };
+
+        // The results go to volatile locals, so that free builds run the casts too
+        SIDerived* volatile SIResult = nullptr;
+        MIRight*   volatile MIResult = nullptr;
+        VIRight*   volatile VIResult = nullptr;
+        MIRight*   volatile NoResult = &MI;
+
+        const auto SITime = Time([&] { SIResult = dynamic_cast<SIDerived*>(SISource); });
+        const auto MITime = Time([&] { MIResult = dynamic_cast<MIRight*>(MISource); });
+        const auto VITime = Time([&] { VIResult = dynamic_cast<VIRight*>(VISource); });
+        const auto NoTime = Time([&] { NoResult = dynamic_cast<MIRight*>(UnrelatedSource); });
+
+        ASSERT(SIResult == &SI);
+        ASSERT(MIResult == static_cast<MIRight*>(&MI));
+        ASSERT(VIResult == static_cast<VIRight*>(&VI));
+        ASSERT(NoResult == nullptr);
+
+        LOG("%d casts: SI %lld us, MI %lld us, VI %lld us, failing %lld us", Count, SITime, MITime, VITime, NoTime);
+
+        auto Stats = __ucxxrt_eh_cache_stats();
+        if (__ucxxrt_query_eh_cache_stats(&Stats)) {
+            LOG("cast: %llu hits, %llu misses", Stats.cast_hits, Stats.cast_misses);
+
+            ASSERT(Stats.cast_hits >= Stats.cast_misses);
+        }
+    }
+
+    namespace TypeNameHierarchy
+    {
+        template<typename T, int N> struct Payload { virtual ~Payload() = default; };
+    }
+
+    // Decorated type name equality behind catch matching and dynamic_cast (ehcache.cpp)
+    extern "C" bool __cdecl __vcrt_type_names_equal(const char* Lhs, const char* Rhs);
+
+    void TEST(TypeidCompare)()
+    {
+        using namespace TypeNameHierarchy;
+
+        constexpr auto Count = 100000;
+
+        // Same long prefix, differ only in the last template argument
+        const std::type_info& Lhs = typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 1>);
+        const std::type_info& Rhs = typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 2>);
+
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&Freq](auto&& Compare)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < Count; ++Idx) {
+                Compare();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart;
+        };
+
+        volatile bool Equal   = false;
+        volatile bool Unequal = false;
+        volatile bool Ordered = false;
+
+        const auto EqualTime   = Time([&] { Equal = Lhs == Lhs; });
+        const auto UnequalTime = Time([&] { Unequal = Lhs != Rhs; });
+        const auto BeforeTime  = Time([&] { Ordered = Lhs.before(Rhs) != Rhs.before(Lhs); });
+
+        ASSERT(Equal && Unequal && Ordered);
+
+        // before() orders by the decorated names
+        const std::type_info* Types[] = { &Lhs, &Rhs, &typeid(int), &typeid(long), &typeid(std::string) };
+        for (const auto Left : Types) {
+            for (const auto Right : Types) {
+                ASSERT(Left->before(*Right) == (strcmp(Left->raw_name() + 1, Right->raw_name() + 1) < 0));
+            }
+        }
+
+        LOG("%d compares: equal %lld us, unequal same prefix %lld us, before %lld us",
+            Count, EqualTime, UnequalTime, BeforeTime);
+
+        // Another image's descriptors lie outside this one, where the name memo does not keep them
+        // unless images are tracked; a copy of the name in pool stands in for one
+        const auto LhsName = Lhs.raw_name();
+        const auto RhsName = Rhs.raw_name();
+        auto Foreign = Vector<char>(LhsName, LhsName + strlen(LhsName) + 1);
+
+        volatile bool ForeignEqual   = false;
+        volatile bool ForeignUnequal = true;
+        volatile int  ForeignOrder   = 0;
+
+        const auto ForeignEqualTime   = Time([&] { ForeignEqual = __vcrt_type_names_equal(LhsName, Foreign.data()); });
+        const auto ForeignUnequalTime = Time([&] { ForeignUnequal = __vcrt_type_names_equal(RhsName, Foreign.data()); });
+        const auto StrcmpTime         = Time([&] { ForeignOrder = strcmp(RhsName, Foreign.data()); });
+
+        ASSERT(ForeignEqual && !ForeignUnequal && ForeignOrder != 0);
+
+        LOG("%d compares across images: equal %lld us, unequal same prefix %lld us (strcmp %lld us)",
+            Count, ForeignEqualTime, ForeignUnequalTime, StrcmpTime);
+
+        auto Stats = __ucxxrt_eh_cache_stats();
+        if (__ucxxrt_query_eh_cache_stats(&Stats)) {
+            LOG("type name: %llu hits, %llu misses", Stats.type_name_hits, Stats.type_name_misses);
+        }
+    }
+
+    void TEST(TypeidHash)()
+    {
+        using namespace TypeNameHierarchy;
+
+        constexpr auto Count = 100000;
+
+        // Names of 4..300 bytes, many sharing long prefixes
+        const std::type_info* Types[] = {
+            &typeid(int), &typeid(char), &typeid(long), &typeid(short),
+            &typeid(Payload<int, 1>), &typeid(Payload<int, 2>), &typeid(Payload<int, 3>),
+            &typeid(Payload<char, 1>), &typeid(Payload<long, 1>),
+            &typeid(Payload<std::vector<int>, 1>), &typeid(Payload<std::vector<int>, 2>),
+            &typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 1>),
+            &typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 2>),
+            &typeid(Payload<std::unordered_map<std::string, std::vector<long>>, 1>),
+            &typeid(Payload<std::function<void(int, std::string)>, 1>),
+            &typeid(Payload<std::function<void(int, std::wstring)>, 1>),
+        };
+
+        for (size_t Idx = 0; Idx < _countof(Types); ++Idx) {
+            ASSERT(Types[Idx]->hash_code() == Types[Idx]->hash_code());
+
+            for (size_t Other = Idx + 1; Other < _countof(Types); ++Other) {
+                ASSERT(Types[Idx]->hash_code() != Types[Other]->hash_code());
+            }
+        }
+
+        const auto& Longest = typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 1>);
+
+        auto Freq = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        auto Sum = size_t();
+        for (auto Idx = 0; Idx < Count; ++Idx) {
+            Sum += Longest.hash_code();
+        }
+        auto End = KeQueryPerformanceCounter(nullptr);
+
+        LOG("%d hashes of a %zu byte name took %lld us (%zx)", Count, strlen(Longest.raw_name()),
+            (End.QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart, Sum);
+    }
+
+    void TEST(TypeidName)()
+    {
+        using namespace TypeNameHierarchy;
+
+        ASSERT(strcmp(typeid(int).name(), "int") == 0);
+        ASSERT(strcmp(typeid(Payload<int, 1>).name(), "struct UnitTest::TypeNameHierarchy::Payload<int,1>") == 0);
+
+        const auto& Longest = typeid(Payload<std::unordered_map<std::string, std::vector<int>>, 1>);
+
+        auto Freq  = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        const auto Name = Longest.name();
+        auto Middle = KeQueryPerformanceCounter(nullptr);
+        auto Cached = true;
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            Cached &= Longest.name() == Name;
+        }
+        auto End = KeQueryPerformanceCounter(nullptr);
+        ASSERT(Cached);
+
+        LOG("%s: first name() %lld us, 100000 cached %lld us", Name,
+            (Middle.QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart,
+            (End.QuadPart - Middle.QuadPart) * 1000000 / Freq.QuadPart);
+    }
+
+#if defined(_M_IX86) || defined(_M_X64)
+    extern "C" {
+        const void* __stdcall __std_search_1(const void*, const void*, const void*, size_t) noexcept;
+        const void* __stdcall __std_search_2(const void*, const void*, const void*, size_t) noexcept;
+        const void* __stdcall __std_find_end_1(const void*, const void*, const void*, size_t) noexcept;
+        const void* __stdcall __std_find_first_of_trivial_1(
+            const void*, const void*, const void*, const void*) noexcept;
+        const void* __stdcall __std_find_first_of_trivial_2(
+            const void*, const void*, const void*, const void*) noexcept;
+
+        size_t __stdcall __std_mismatch_1(const void*, const void*, size_t) noexcept;
+        size_t __stdcall __std_mismatch_2(const void*, const void*, size_t) noexcept;
+        size_t __stdcall __std_mismatch_4(const void*, const void*, size_t) noexcept;
+        size_t __stdcall __std_mismatch_8(const void*, const void*, size_t) noexcept;
+
+        void* __stdcall __std_remove_1(void*, void*, uint8_t) noexcept;
+        void* __stdcall __std_remove_2(void*, void*, uint16_t) noexcept;
+        void* __stdcall __std_remove_4(void*, void*, uint32_t) noexcept;
+        void* __stdcall __std_remove_8(void*, void*, uint64_t) noexcept;
+        void* __stdcall __std_unique_1(void*, void*) noexcept;
+        void* __stdcall __std_unique_2(void*, void*) noexcept;
+        void* __stdcall __std_unique_4(void*, void*) noexcept;
+        void* __stdcall __std_unique_8(void*, void*) noexcept;
+        void __stdcall __std_replace_1(void*, void*, uint8_t, uint8_t) noexcept;
+        void __stdcall __std_replace_2(void*, void*, uint16_t, uint16_t) noexcept;
+        void __stdcall __std_replace_4(void*, void*, uint32_t, uint32_t) noexcept;
+        void __stdcall __std_replace_8(void*, void*, uint64_t, uint64_t) noexcept;
+
+        struct MinMaxElement { const void* Min; const void* Max; };
+
+        const void* __stdcall __std_min_element_f(const void*, const void*, bool) noexcept;
+        const void* __stdcall __std_min_element_d(const void*, const void*, bool) noexcept;
+        const void* __stdcall __std_max_element_f(const void*, const void*, bool) noexcept;
+        const void* __stdcall __std_max_element_d(const void*, const void*, bool) noexcept;
+        MinMaxElement __stdcall __std_minmax_element_f(const void*, const void*, bool) noexcept;
+        MinMaxElement __stdcall __std_minmax_element_d(const void*, const void*, bool) noexcept;
+    }
+
+    void TEST(VectorSearch)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+        auto Same = [](auto Lhs, auto Rhs) { return Lhs == Rhs; }; // a predicate keeps the STL on the scalar path
+
+        // Differential check against the scalar algorithms, small alphabets to get many partial matches
+        for (auto Idx = 0; Idx < 20000; ++Idx) {
+            const auto Alphabet = 1 + Rand() % (Idx % 2 ? 3 : 256);
+
+            auto Haystack = Vector<unsigned char>(Rand() % 160);
+            auto Needle   = Vector<unsigned char>(Rand() % (Idx % 3 ? 10 : 40));
+            for (auto& Ch : Haystack) Ch = static_cast<unsigned char>(Rand() % Alphabet);
+            for (auto& Ch : Needle)   Ch = static_cast<unsigned char>(Rand() % Alphabet);
+
+            if (Haystack.size() > Needle.size() && Rand() % 2) {
+                const auto At = Rand() % (Haystack.size() - Needle.size() + 1);
+                std::copy(Needle.begin(), Needle.end(), Haystack.begin() + At);
+            }
+
+            const auto First1 = Haystack.data(), Last1 = First1 + Haystack.size();
+            const auto First2 = Needle.data(),   Last2 = First2 + Needle.size();
+
+            ASSERT(__std_search_1(First1, Last1, First2, Needle.size())
+                == std::search(First1, Last1, First2, Last2, Same));
+            ASSERT(__std_find_end_1(First1, Last1, First2, Needle.size())
+                == std::find_end(First1, Last1, First2, Last2, Same));
+            ASSERT(__std_find_first_of_trivial_1(First1, Last1, First2, Last2)
+                == std::find_first_of(First1, Last1, First2, Last2, Same));
+
+            auto Wide       = Vector<wchar_t>(Haystack.begin(), Haystack.end());
+            auto WideNeedle = Vector<wchar_t>(Needle.begin(), Needle.end());
+            for (auto& Ch : Wide) Ch |= (Rand() % 2) << 8; // differ only in the high byte
+
+            const auto WFirst1 = Wide.data(),       WLast1 = WFirst1 + Wide.size();
+            const auto WFirst2 = WideNeedle.data(), WLast2 = WFirst2 + WideNeedle.size();
+
+            ASSERT(__std_search_2(WFirst1, WLast1, WFirst2, WideNeedle.size())
+                == std::search(WFirst1, WLast1, WFirst2, WLast2, Same));
+            ASSERT(__std_find_first_of_trivial_2(WFirst1, WLast1, WFirst2, WLast2)
+                == std::find_first_of(WFirst1, WLast1, WFirst2, WLast2, Same));
+        }
+
+        // A 1 MB payload with the pattern at its very end
+        auto Payload = Vector<unsigned char>(1024 * 1024);
+        for (size_t Idx = 0; Idx < Payload.size(); ++Idx) {
+            Payload[Idx] = static_cast<unsigned char>('a' + Idx % 23);
+        }
+
+        constexpr unsigned char Pattern[] = "GET /index";
+        constexpr unsigned char Special[] = "<>&\"'";
+        std::copy(Pattern, Pattern + sizeof(Pattern) - 1, Payload.end() - (sizeof(Pattern) - 1));
+
+        const auto First = Payload.data(), Last = First + Payload.size();
+
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&Freq](auto&& Search)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < 100; ++Idx) {
+                Search();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart;
+        };
+
+        const auto PatternEnd = Pattern + sizeof(Pattern) - 1;
+        const auto SpecialEnd = Special + sizeof(Special) - 1;
+        const auto Expected   = Last - (sizeof(Pattern) - 1);
+
+        const void* volatile Found[4] = {};
+
+        const auto SearchTime   = Time([&] { Found[0] = __std_search_1(First, Last, Pattern, PatternEnd - Pattern); });
+        const auto ScalarTime   = Time([&] { Found[1] = std::search(First, Last, Pattern, PatternEnd, Same); });
+        const auto FirstOfTime  = Time([&] { Found[2] = __std_find_first_of_trivial_1(First, Last, Special, SpecialEnd); });
+        const auto ScalarOfTime = Time([&] { Found[3] = std::find_first_of(First, Last, Special, SpecialEnd, Same); });
+
+        ASSERT(Found[0] == Expected && Found[1] == Expected);
+        ASSERT(Found[2] == Last && Found[3] == Last);
+
+        LOG("100 scans of 1 MB: search %lld us (scalar %lld us), find_first_of %lld us (scalar %lld us)",
+            SearchTime, ScalarTime, FirstOfTime, ScalarOfTime);
+    }
+
+    template<typename T>
+    void VectorMismatchCheck(std::mt19937& Rand, size_t (__stdcall* Mismatch)(const void*, const void*, size_t))
+    {
+        auto Same = [](auto Lhs, auto Rhs) { return Lhs == Rhs; };
+
+        for (auto Idx = 0; Idx < 5000; ++Idx) {
+            auto Lhs = Vector<T>(Rand() % (Idx % 10 ? 80 : 600));
+            for (auto& Value : Lhs) Value = static_cast<T>(Rand());
+
+            // Differ in a single random byte of a random element, or not at all
+            auto Rhs = Lhs;
+            if (!Rhs.empty() && Rand() % 4) {
+                reinterpret_cast<unsigned char*>(&Rhs[Rand() % Rhs.size()])[Rand() % sizeof(T)] ^= 1 + Rand() % 255;
+            }
+
+            const auto Expected = std::mismatch(Lhs.begin(), Lhs.end(), Rhs.begin(), Same).first - Lhs.begin();
+            ASSERT(Mismatch(Lhs.data(), Rhs.data(), Lhs.size()) == static_cast<size_t>(Expected));
+        }
+    }
+
+    void TEST(VectorMismatch)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+
+        VectorMismatchCheck<unsigned char>(Rand, __std_mismatch_1);
+        VectorMismatchCheck<unsigned short>(Rand, __std_mismatch_2);
+        VectorMismatchCheck<unsigned long>(Rand, __std_mismatch_4);
+        VectorMismatchCheck<unsigned long long>(Rand, __std_mismatch_8);
+
+        // Flow table style keys: 40 bytes, equal but for the last one
+        constexpr auto Count = 1000000;
+
+        unsigned long Key1[10] = { 0x0A000001, 0x0A000002, 0x1F90C350, 6 };
+        unsigned long Key2[10] = { 0x0A000001, 0x0A000002, 0x1F90C350, 6 };
+        Key2[9] = 1;
+
+        auto Same = [](auto Lhs, auto Rhs) { return Lhs == Rhs; };
+
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&Freq](auto&& Compare)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < Count; ++Idx) {
+                Compare();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000 / Freq.QuadPart;
+        };
+
+        volatile size_t VectorPos = 0;
+        volatile size_t ScalarPos = 0;
+
+        const auto VectorTime = Time([&] { VectorPos = __std_mismatch_4(Key1, Key2, _countof(Key1)); });
+        const auto ScalarTime = Time([&] { ScalarPos = std::mismatch(Key1, Key1 + 10, Key2, Same).first - Key1; });
+
+        ASSERT(VectorPos == 9 && ScalarPos == 9);
+
+        LOG("%d mismatches of 40 byte keys: %lld us (scalar %lld us)", Count, VectorTime, ScalarTime);
+    }
+
+    template<typename T>
+    void VectorRemoveCheck(std::mt19937& Rand,
+        void* (__stdcall* Remove)(void*, void*, T), void* (__stdcall* Unique)(void*, void*),
+        void (__stdcall* Replace)(void*, void*, T, T))
+    {
+        const auto Equal = [](T Lhs, T Rhs) { return Lhs == Rhs; };
+
+        // Differential check against the scalar algorithms; predicates keep the STL off the kernels
+        for (auto Idx = 0; Idx < 3000; ++Idx) {
+            auto Data = Vector<T>(Rand() % (Idx % 10 ? 100 : 1000));
+            for (auto& Value : Data) Value = static_cast<T>(Rand() % (Idx % 2 ? 3 : 1000));
+
+            const auto Value = static_cast<T>(Rand() % 3);
+
+            auto Expected = Data;
+            auto Actual   = Data;
+            const auto RemoveEnd = std::remove_if(Expected.begin(), Expected.end(), [=](T V) { return V == Value; });
+            const auto RemoveSize = static_cast<T*>(Remove(Actual.data(), Actual.data() + Actual.size(), Value)) - Actual.data();
+            ASSERT(RemoveSize == RemoveEnd - Expected.begin() && std::equal(Expected.begin(), RemoveEnd, Actual.begin()));
+
+            Expected = Data;
+            Actual   = Data;
+            const auto UniqueEnd = std::unique(Expected.begin(), Expected.end(), Equal);
+            const auto UniqueSize = static_cast<T*>(Unique(Actual.data(), Actual.data() + Actual.size())) - Actual.data();
+            ASSERT(UniqueSize == UniqueEnd - Expected.begin() && std::equal(Expected.begin(), UniqueEnd, Actual.begin()));
+
+            Expected = Data;
+            Actual   = Data;
+            std::replace_if(Expected.begin(), Expected.end(), [=](T V) { return V == Value; }, static_cast<T>(7));
+            Replace(Actual.data(), Actual.data() + Actual.size(), Value, static_cast<T>(7));
+            ASSERT(Expected == Actual);
+        }
+
+        // Benchmark: a quarter of the elements match; the copy that restores the input is subtracted
+        auto Data   = Vector<T>(65536 / sizeof(T));
+        auto Source = Data;
+        for (auto& Value : Source) Value = static_cast<T>(Rand() % 4);
+
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&](auto&& Kernel)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < 100; ++Idx) {
+                Data = Source;
+                Kernel();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100;
+        };
+
+        const auto First = Data.data(), Last = First + Data.size();
+        const auto CopyTime = Time([] {});
+        const auto Elements = static_cast<long long>(Data.size());
+        const auto PerElement = [&](long long Ns) { return (Ns - CopyTime) * 1000 / Elements; };
+
+        LOG("%zu byte: remove %lld ps/element (scalar %lld), unique %lld (scalar %lld), replace %lld (scalar %lld)", sizeof(T),
+            PerElement(Time([&] { Remove(First, Last, 1); })),
+            PerElement(Time([&] { std::remove_if(First, Last, [](T V) { return V == 1; }); })),
+            PerElement(Time([&] { Unique(First, Last); })),
+            PerElement(Time([&] { std::unique(First, Last, Equal); })),
+            PerElement(Time([&] { Replace(First, Last, 1, 9); })),
+            PerElement(Time([&] { std::replace_if(First, Last, [](T V) { return V == 1; }, static_cast<T>(9)); })));
+    }
+
+    void TEST(VectorRemove)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+
+        VectorRemoveCheck<uint8_t>(Rand, __std_remove_1, __std_unique_1, __std_replace_1);
+        VectorRemoveCheck<uint16_t>(Rand, __std_remove_2, __std_unique_2, __std_replace_2);
+        VectorRemoveCheck<uint32_t>(Rand, __std_remove_4, __std_unique_4, __std_replace_4);
+        VectorRemoveCheck<uint64_t>(Rand, __std_remove_8, __std_unique_8, __std_replace_8);
+    }
+
+    template<typename T>
+    void VectorMinmaxFloatCheck(std::mt19937& Rand,
+        const void* (__stdcall* Min)(const void*, const void*, bool), const void* (__stdcall* Max)(const void*, const void*, bool),
+        MinMaxElement (__stdcall* MinMax)(const void*, const void*, bool))
+    {
+        const T Special[] = {
+            T(0), -T(0), T(1), -T(1), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+            std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN(),
+            std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(),
+            std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest() };
+
+        // Sequential < as min_element and max_element use it: a leading NaN is the result, later ones are skipped,
+        // -0.0 and +0.0 are equal. minmax_element takes the last maximum.
+        for (auto Idx = 0; Idx < 3000; ++Idx) {
+            auto Data = Vector<T>(Rand() % (Idx % 10 ? 100 : 2000));
+            for (auto& Value : Data) {
+                Value = Idx % 2 ? Special[Rand() % _countof(Special)] : static_cast<T>(static_cast<int>(Rand() % 7) - 3);
+            }
+
+            size_t ExpectedMin = 0, ExpectedMax = 0, ExpectedLastMax = 0;
+            for (size_t Pos = 1; Pos < Data.size(); ++Pos) {
+                if (Data[Pos] < Data[ExpectedMin])     ExpectedMin = Pos;
+                if (Data[ExpectedMax] < Data[Pos])     ExpectedMax = Pos;
+                if (Data[ExpectedLastMax] <= Data[Pos]) ExpectedLastMax = Pos;
+            }
+
+            const auto First = Data.data(), Last = First + Data.size();
+            const auto Both  = MinMax(First, Last, false);
+            ASSERT(Min(First, Last, false) == First + ExpectedMin);
+            ASSERT(Max(First, Last, false) == First + ExpectedMax);
+            ASSERT(Both.Min == First + ExpectedMin && Both.Max == First + ExpectedLastMax);
+        }
+
+        // Benchmark: latency sample style data, 16 to 1M elements
+        auto Freq = LARGE_INTEGER();
+        for (size_t Size = 16; Size <= 1024 * 1024; Size *= 4) {
+            auto Data = Vector<T>(Size);
+            for (auto& Value : Data) Value = static_cast<T>(Rand() % 100000) / 10;
+
+            const auto First = Data.data(), Last = First + Data.size();
+            const auto Repeat = static_cast<int>(16 * 1024 * 1024 / Size);
+            auto Time = [&](auto&& Kernel)
+            {
+                const auto Begin = KeQueryPerformanceCounter(&Freq);
+                for (auto Idx = 0; Idx < Repeat; ++Idx) {
+                    Kernel();
+                }
+                return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000000 / Freq.QuadPart / Repeat / static_cast<long long>(Size);
+            };
+
+            const void* volatile VectorMin = nullptr;
+            const void* volatile ScalarMin = nullptr;
+
+            const auto VectorTime = Time([&] { VectorMin = MinMax(First, Last, false).Min; });
+            const auto ScalarTime = Time([&] { ScalarMin = std::minmax_element(First, Last, [](T L, T R) { return L < R; }).first; });
+
+            ASSERT(VectorMin == ScalarMin);
+
+            LOG("%zu byte floating minmax_element over %7zu: %lld ps/element (scalar %lld)", sizeof(T), Size, VectorTime, ScalarTime);
+        }
+    }
+
+    void TEST(VectorMinmaxFloat)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+
+        VectorMinmaxFloatCheck<float>(Rand, __std_min_element_f, __std_max_element_f, __std_minmax_element_f);
+        VectorMinmaxFloatCheck<double>(Rand, __std_min_element_d, __std_max_element_d, __std_minmax_element_d);
+    }
+
+    extern "C" unsigned int __isa_enabled;
+#endif // defined(_M_IX86) || defined(_M_X64)
+
+#define VECTOR_KERNELS(Size, Type)                                                                          \
+    extern "C" void __cdecl __std_reverse_trivially_swappable_ ## Size(void*, void*) noexcept;              \
+    extern "C" const void* __stdcall __std_find_trivial_ ## Size(const void*, const void*, Type) noexcept;  \
+    extern "C" const void* __stdcall __std_find_trivial_unsized_ ## Size(const void*, Type) noexcept;       \
+    extern "C" size_t __stdcall __std_count_trivial_ ## Size(const void*, const void*, Type) noexcept;      \
+    extern "C" const void* __stdcall __std_min_element_ ## Size(const void*, const void*, bool) noexcept;   \
+    extern "C" const void* __stdcall __std_max_element_ ## Size(const void*, const void*, bool) noexcept;   \
+    template<> struct VectorKernels<Type>                                                                   \
+    {                                                                                                       \
+        static constexpr auto Reverse = __std_reverse_trivially_swappable_ ## Size;                         \
+        static constexpr auto Find    = __std_find_trivial_ ## Size;                                        \
+        static constexpr auto Unsized = __std_find_trivial_unsized_ ## Size;                                \
+        static constexpr auto Count   = __std_count_trivial_ ## Size;                                       \
+        static constexpr auto Min     = __std_min_element_ ## Size;                                         \
+        static constexpr auto Max     = __std_max_element_ ## Size;                                         \
+    }
+
+    template<typename T> struct VectorKernels;
+
+    VECTOR_KERNELS(1, uint8_t);
+    VECTOR_KERNELS(2, uint16_t);
+    VECTOR_KERNELS(4, uint32_t);
+    VECTOR_KERNELS(8, uint64_t);
+
+#undef VECTOR_KERNELS
+
+    extern "C" void __cdecl __std_swap_ranges_trivially_swappable_noalias(void*, void*, void*) noexcept;
+
+    template<typename T>
+    void VectorTierCheck(std::mt19937& Rand, const char* Tier)
+    {
+        using Kernels = VectorKernels<T>;
+        using Signed  = std::make_signed_t<T>;
+
+        // Differential check against the scalar algorithms; predicates keep the STL off the kernels
+        for (auto Idx = 0; Idx < 2000; ++Idx) {
+            auto Data = Vector<T>(Rand() % 300);
+            for (auto& Value : Data) Value = static_cast<T>(Rand() % (Idx % 2 ? 4 : 1000) - (Idx % 3 ? 0 : 2));
+
+            const auto Value = static_cast<T>(Rand() % 4);
+            const auto First = Data.data(), Last = First + Data.size();
+            const auto SFirst = reinterpret_cast<Signed*>(First), SLast = reinterpret_cast<Signed*>(Last);
+
+            ASSERT(Kernels::Find(First, Last, Value) == std::find_if(First, Last, [=](T V) { return V == Value; }));
+            ASSERT(Kernels::Count(First, Last, Value) ==
+                static_cast<size_t>(std::count_if(First, Last, [=](T V) { return V == Value; })));
+
+            if (!Data.empty()) {
+                const auto Less = [](auto L, auto R) { return L < R; };
+                ASSERT(Kernels::Min(First, Last, false) == std::min_element(First, Last, Less));
+                ASSERT(Kernels::Max(First, Last, false) == std::max_element(First, Last, Less));
+                ASSERT(Kernels::Min(First, Last, true) == std::min_element(SFirst, SLast, Less));
+                ASSERT(Kernels::Max(First, Last, true) == std::max_element(SFirst, SLast, Less));
+            }
+
+            const auto Low  = Data.empty() ? 0 : Rand() % Data.size();
+            const auto High = Low + (Data.size() > Low ? Rand() % (Data.size() - Low + 1) : 0);
+
+            auto Reversed = Data;
+            Kernels::Reverse(Reversed.data() + Low, Reversed.data() + High);
+            for (size_t Pos = 0; Pos < Data.size(); ++Pos) {
+                ASSERT(Reversed[Pos] == (Pos < Low || Pos >= High ? Data[Pos] : Data[Low + High - 1 - Pos]));
+            }
+
+            auto Swapped = Data;
+            __std_swap_ranges_trivially_swappable_noalias(
+                Swapped.data() + Low, Swapped.data() + High, Reversed.data() + Low);
+            for (size_t Pos = Low; Pos < High; ++Pos) {
+                ASSERT(Reversed[Pos] == Data[Pos] && Swapped[Pos] == Data[Low + High - 1 - Pos]);
+            }
+        }
+
+        // The unsized find masks off the elements of its first aligned piece that come before _First;
+        // with the value in all of them it must still return the first match at or after _First
+        {
+            constexpr auto Piece = 64 / sizeof(T); // the widest tier's piece, in elements
+
+            auto Data = Vector<T>(Piece * 4, static_cast<T>(1));
+            for (size_t Start = 1; Start <= Piece; ++Start) {
+                const auto Target = Start + Rand() % (Piece * 2);
+
+                std::fill(Data.begin(), Data.end(), static_cast<T>(1));
+                std::fill(Data.begin(), Data.begin() + Start, static_cast<T>(0));
+                Data[Target] = 0;
+
+                ASSERT(Kernels::Unsized(Data.data() + Start, static_cast<T>(0)) == Data.data() + Target);
+            }
+        }
+
+        // Benchmark: searched value absent, so every kernel walks the whole range
+        auto Freq = LARGE_INTEGER();
+        auto Time = [&Freq](auto&& Kernel)
+        {
+            const auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Idx = 0; Idx < 1000; ++Idx) {
+                Kernel();
+            }
+            return (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 1000;
+        };
+
+        for (const auto Bytes : { 40u, 1000u, 65536u }) {
+            auto Data  = Vector<T>(Bytes / sizeof(T), static_cast<T>(1));
+            auto Other = Data;
+            const auto First = Data.data(), Last = First + Data.size();
+
+            const void* volatile Found = nullptr;
+            volatile size_t      Matches = 1;
+            const void* volatile Least = nullptr;
+
+            const auto FindTime    = Time([&] { Found = Kernels::Find(First, Last, 0); });
+            const auto CountTime   = Time([&] { Matches = Kernels::Count(First, Last, 0); });
+            const auto MinTime     = Time([&] { Least = Kernels::Min(First, Last, true); });
+            const auto ReverseTime = Time([&] { Kernels::Reverse(First, Last); });
+            const auto SwapTime    = Time([&] { __std_swap_ranges_trivially_swappable_noalias(First, Last, Other.data()); });
+
+            ASSERT(Found == Last && Matches == 0 && Least == First);
+
+            LOG("%-6s %zu byte x %5u bytes: find %lld ns, count %lld ns, min %lld ns, reverse %lld ns, swap %lld ns",
+                Tier, sizeof(T), Bytes, FindTime, CountTime, MinTime, ReverseTime, SwapTime);
+        }
+    }
+
+    void TEST(VectorTiers)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+
+#if defined(_M_IX86) || defined(_M_X64)
+        // Each tier is forced by hiding the ones above it from the dispatch
+        const struct { const char* Name; unsigned int Hidden; } Tiers[] = {
+            { "sse2",   (1u << __ISA_AVAILABLE_SSE42) | (1u << __ISA_AVAILABLE_AVX2) | (1u << __ISA_AVAILABLE_AVX512) },
+            { "sse4.2", (1u << __ISA_AVAILABLE_AVX2) | (1u << __ISA_AVAILABLE_AVX512) },
+            { "avx2",   (1u << __ISA_AVAILABLE_AVX512) },
+            { "avx512", 0 },
+        };
+
+        const auto Enabled = __isa_enabled;
+        auto Previous = 0u;
+
+        for (const auto& Tier : Tiers) {
+            __isa_enabled = Enabled & ~Tier.Hidden;
+            if (__isa_enabled == Previous) {
+                continue; // not supported here
+            }
+            Previous = __isa_enabled;
+
+            VectorTierCheck<uint8_t>(Rand, Tier.Name);
+            VectorTierCheck<uint16_t>(Rand, Tier.Name);
+            VectorTierCheck<uint32_t>(Rand, Tier.Name);
+            VectorTierCheck<uint64_t>(Rand, Tier.Name);
+        }
+
+        __isa_enabled = Enabled;
+#else
+        // ARM64 has the one NEON tier
+        VectorTierCheck<uint8_t>(Rand, "neon");
+        VectorTierCheck<uint16_t>(Rand, "neon");
+        VectorTierCheck<uint32_t>(Rand, "neon");
+        VectorTierCheck<uint64_t>(Rand, "neon");
+#endif
+    }
+
+    double ScalarExp(double Value)
+    {
+        if (Value != Value || Value == std::numeric_limits<double>::infinity()) {
+            return Value;
+        }
+        if (Value == -std::numeric_limits<double>::infinity()) {
+            return 0.0;
+        }
+        if (Value == 0.0) {
+            return 1.0;
+        }
+
+        _Exp(&Value, 1.0, 0);
+        return Value;
+    }
+
+    void VectorMathCheck(std::mt19937& Rand, const char* Tier)
+    {
+        constexpr auto Count = 4099; // a scalar tail for every vector width
+
+        static const double Specials[] = { 0.0, -0.0, 1.0, -1.0, 1e-300, -5e-324, 0.5, 19.0, -19.5, 700.0, -700.5, 709.7, -745.0,
+            std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN() };
+
+        auto Input  = Vector<double>(Count);
+        auto Output = Vector<double>(Count);
+        for (auto& Value : Input) {
+            switch (Rand() % 4) {
+            case 0:  Value = Specials[Rand() % _countof(Specials)]; break;
+            case 1:  Value = static_cast<double>(static_cast<int>(Rand() % 2000001) - 1000000) / 1000000; break;
+            default: Value = static_cast<double>(static_cast<int>(Rand() % 1440001) - 720000) / 1000; break;
+            }
+        }
+
+        const struct {
+            const char* Name;
+            void (__stdcall* Array)(const double*, const double*, double*) noexcept;
+            double (*Scalar)(double);
+        } Functions[] = {
+            { "exp",  __std_exp_array,  ScalarExp },
+            { "sinh", __std_sinh_array, [](double Value) { return _Sinh(Value, 1.0); } },
+            { "cosh", __std_cosh_array, [](double Value) { return _Cosh(Value, 1.0); } },
+        };
+
+        auto Freq = LARGE_INTEGER();
+        for (const auto& Function : Functions) {
+            // bit-identical to the scalar helpers, in place too
+            Function.Array(Input.data(), Input.data() + Count, Output.data());
+            for (auto Idx = 0; Idx < Count; ++Idx) {
+                const auto Expect = Function.Scalar(Input[Idx]);
+                ASSERT(memcmp(&Expect, &Output[Idx], sizeof(Expect)) == 0 || (Expect != Expect && Output[Idx] != Output[Idx]));
+            }
+
+            Output = Input;
+            Function.Array(Output.data(), Output.data() + Count, Output.data());
+            for (auto Idx = 0; Idx < Count; ++Idx) {
+                const auto Expect = Function.Scalar(Input[Idx]);
+                ASSERT(memcmp(&Expect, &Output[Idx], sizeof(Expect)) == 0 || (Expect != Expect && Output[Idx] != Output[Idx]));
+            }
+
+            auto Begin = KeQueryPerformanceCounter(&Freq);
+            for (auto Repeat = 0; Repeat < 100; ++Repeat) {
+                Function.Array(Input.data(), Input.data() + Count, Output.data());
+            }
+
+            auto Middle = KeQueryPerformanceCounter(nullptr);
+            for (auto Repeat = 0; Repeat < 100; ++Repeat) {
+                for (auto Idx = 0; Idx < Count; ++Idx) {
+                    Output[Idx] = Function.Scalar(Input[Idx]);
+                }
+            }
+
+            const auto End = KeQueryPerformanceCounter(nullptr);
+            LOG("%-6s %s: %lld ps/element (scalar %lld)", Tier, Function.Name,
+                (Middle.QuadPart - Begin.QuadPart) * 1000000000000 / Freq.QuadPart / 100 / Count,
+                (End.QuadPart - Middle.QuadPart) * 1000000000000 / Freq.QuadPart / 100 / Count);
+        }
+    }
+
+    void TEST(VectorMath)()
+    {
+        auto Sand = LARGE_INTEGER();
+        KeQueryTickCount(&Sand);
+
+        auto Rand = std::mt19937(Sand.LowPart);
+
+#if defined(_M_IX86) || defined(_M_X64)
+        const auto Enabled = __isa_enabled;
+
+        __isa_enabled = Enabled & ~(1u << __ISA_AVAILABLE_AVX2);
+        VectorMathCheck(Rand, "sse2");
+
+        __isa_enabled = Enabled;
+        if (Enabled & (1u << __ISA_AVAILABLE_AVX2)) {
+            VectorMathCheck(Rand, "avx2");
+        }
+#else
+        VectorMathCheck(Rand, "scalar");
+#endif
+    }
+
     void TEST(Map)()
     {
         auto Sand = LARGE_INTEGER();
@@ -290,6 +1535,264 @@ namespace UnitTest
         }
     }
 
+    constexpr long TEST(AtexitThreads)   = 4;
+    constexpr long TEST(AtexitPerThread) = 2000;
+    volatile long  TEST(AtexitCalls)     = 0;
+
+    void TEST(AtexitConcurrent)()
+    {
+        // Registered first, so called last, after every registration below
+        const auto First = atexit([] { ASSERT(TEST(AtexitCalls) == TEST(AtexitThreads) * TEST(AtexitPerThread) + 1); });
+        ASSERT(First == 0);
+
+        auto Freq    = LARGE_INTEGER();
+        auto Begin   = KeQueryPerformanceCounter(&Freq);
+        auto Workers = std::vector<std::thread>();
+        for (auto Idx = 0; Idx < TEST(AtexitThreads); ++Idx) {
+            Workers.emplace_back([]
+            {
+                for (auto Count = 0; Count < TEST(AtexitPerThread); ++Count) {
+                    const auto Result = atexit([] { InterlockedIncrement(&TEST(AtexitCalls)); });
+                    ASSERT(Result == 0);
+                }
+            });
+        }
+
+        for (auto& Worker : Workers) {
+            Worker.join();
+        }
+
+        const auto Ns = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart;
+        LOG("%ld threads x %ld atexit registrations: %lld ns per registration",
+            TEST(AtexitThreads), TEST(AtexitPerThread), Ns / (TEST(AtexitThreads) * TEST(AtexitPerThread)));
+
+        // Registered last, so called first
+        const auto Last = atexit([] { ASSERT(TEST(AtexitCalls) == 0); InterlockedIncrement(&TEST(AtexitCalls)); });
+        ASSERT(Last == 0);
+    }
+
+    long volatile TEST(StaticConstructs)  = 0;
+    long volatile TEST(StaticThrows)      = 0;
+
+    class TEST(LazyObject)
+    {
+        ULONG mValue = 0;
+
+    public:
+
+        explicit TEST(LazyObject)(const ULONG Value)
+        {
+            // Keep the other threads waiting on the guard for a while
+            auto Interval = LARGE_INTEGER();
+            Interval.QuadPart = -10 * 1000; // 1 ms
+            KeDelayExecutionThread(KernelMode, FALSE, &Interval);
+
+            if (InterlockedIncrement(&TEST(StaticThrows)) == 1) {
+                throw std::runtime_error("first construction fails");
+            }
+
+            InterlockedIncrement(&TEST(StaticConstructs));
+            mValue = Value;
+        }
+
+        ULONG Value() const noexcept
+        {
+            return mValue;
+        }
+    };
+
+    static std::kstatic<TEST(LazyObject)> LazyObject;
+
+    void TEST(ThreadSafeStatic)()
+    {
+        auto Workers = std::vector<std::thread>();
+        for (auto Idx = 0; Idx < 8; ++Idx) {
+            Workers.emplace_back([]
+            {
+                for (;;) {
+                    try {
+                        const auto Value = LazyObject.get(42ul).Value();
+                        ASSERT(Value == 42);
+                        break;
+                    }
+                    catch (const std::runtime_error&) {
+                        // Whoever ran the failed constructor tries again
+                    }
+                }
+            });
+        }
+
+        for (auto& Worker : Workers) {
+            Worker.join();
+        }
+
+        ASSERT(TEST(StaticConstructs) == 1);
+        ASSERT(TEST(StaticThrows) == 2);
+
+        auto Freq  = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        auto Sum   = 0ull;
+        for (auto Count = 0; Count < 1000000; ++Count) {
+            Sum += LazyObject.get(42ul).Value();
+        }
+        const auto Ns = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart;
+        ASSERT(Sum == 42000000ull);
+        LOG("initialized kstatic: %lld ps per get()", Ns / 1000);
+    }
+
+    // Built by parallel initializers before DriverMain
+    static std::kstatic<std::vector<ULONG>> Squares;
+    static std::kstatic<std::vector<ULONG>> SquareSums;
+    long volatile TEST(ParallelOrder) = 0;
+
+    UCXXRT_PARALLEL_INITIALIZER(SquaresInit, []
+    {
+        auto& Table = Squares.get(1000ul);
+        for (auto Idx = 0ul; Idx < Table.size(); ++Idx) {
+            Table[Idx] = Idx * Idx;
+        }
+        InterlockedCompareExchange(&TEST(ParallelOrder), 1, 0);
+    });
+
+    UCXXRT_PARALLEL_INITIALIZER(SquareSumsInit, []
+    {
+        // Squares is complete by now
+        const auto& Source = Squares.get(0ul);
+        auto& Table = SquareSums.get(Source.size());
+        for (auto Idx = 0ul, Sum = 0ul; Idx < Table.size(); ++Idx) {
+            Table[Idx] = Sum += Source[Idx];
+        }
+        InterlockedCompareExchange(&TEST(ParallelOrder), 2, 1);
+    }, &SquaresInit);
+
+    void TEST(ParallelInitializer)()
+    {
+        ASSERT(TEST(ParallelOrder) == 2);
+        ASSERT(Squares.get(0ul)[999] == 999ul * 999ul);
+        ASSERT(SquareSums.get(0ul)[999] == 999ul * 1000ul * 1999ul / 6);
+    }
+
+    // Replaces the runtime's default of UCXXRT_STARTUP_TIMING_OFF
+    EXTERN_C int __cdecl __ucxxrt_startup_timing_mode()
+    {
+        return UCXXRT_STARTUP_TIMING_PRINT;
+    }
+
+    void TEST(StartupTiming)()
+    {
+        __ucxxrt_startup_timing Timing{};
+        const bool Queried = __ucxxrt_query_startup_timing(&Timing);
+        ASSERT(Queried);
+        ASSERT(Timing.frequency != 0);
+
+        // Everything before DriverMain has been timed, nothing after it
+        ASSERT(Timing.ticks[__ucxxrt_phase_initialize_crt] >= Timing.ticks[__ucxxrt_phase_initialize_acrt]);
+        ASSERT(Timing.ticks[__ucxxrt_phase_cpp_initializers] != 0);
+        ASSERT(Timing.ticks[__ucxxrt_phase_driver_main] == 0);
+        ASSERT(Timing.ticks[__ucxxrt_phase_cexit] == 0);
+
+        // TEST(StaticObject), SquaresInit and SquareSumsInit at least
+        ASSERT(Timing.initializers >= 3);
+
+        __ucxxrt_initializer_timing Records[4]{};
+        const auto Count = __ucxxrt_query_initializer_timing(Records, _countof(Records));
+        ASSERT(Count == __min(Timing.initializers, _countof(Records)));
+        for (auto Idx = 0u; Idx < Count; ++Idx) {
+            ASSERT(Records[Idx].function != nullptr);
+        }
+
+        if (Timing.frequency != 0) {
+            LOG("_initterm took %llu us",
+                Timing.ticks[__ucxxrt_phase_cpp_initializers] * 1000000 / Timing.frequency);
+        }
+    }
+
+    void TEST(Lockit)()
+    {
+        auto Before = __ucxxrt_lockit_statistics();
+        const bool Queried = __ucxxrt_query_lockit_statistics(_LOCK_DEBUG, &Before);
+        ASSERT(Queried);
+        const bool QueriedLocale = __ucxxrt_query_lockit_statistics(_LOCK_LOCALE, &Before);
+        ASSERT(!QueriedLocale);
+
+        {
+            // Recursive, and shared inside exclusive
+            std::_Lockit Outer(_LOCK_DEBUG);
+            std::_Lockit Inner(_LOCK_DEBUG);
+            std::kshared_lockit Shared(_LOCK_DEBUG);
+        }
+
+        {
+            // Shared inside exclusive, the exclusive released first
+            auto Outer = std::make_unique<std::_Lockit>(_LOCK_DEBUG);
+            std::kshared_lockit Shared(_LOCK_DEBUG);
+            Outer.reset();
+        }
+
+        auto After = __ucxxrt_lockit_statistics();
+        const bool QueriedAfter = __ucxxrt_query_lockit_statistics(_LOCK_DEBUG, &After);
+        ASSERT(QueriedAfter);
+        ASSERT(After.exclusive >= Before.exclusive + 2);
+        ASSERT(After.shared >= Before.shared + 1);
+
+        // Readers and writers mixed; the writers keep the two halves equal
+        static long Data[2] = {};
+        auto Workers = std::vector<std::thread>();
+        for (auto Idx = 0; Idx < 4; ++Idx) {
+            Workers.emplace_back([Idx]
+            {
+                for (auto Count = 0; Count < 10000; ++Count) {
+                    if (Idx == 0 || Count % 8 == 0) {
+                        std::_Lockit Lock(_LOCK_DEBUG);
+                        ++Data[0];
+                        ++Data[1];
+                    }
+                    else {
+                        std::kshared_lockit Lock(_LOCK_DEBUG);
+                        ASSERT(Data[0] == Data[1]);
+                    }
+                }
+            });
+        }
+
+        for (auto& Worker : Workers) {
+            Worker.join();
+        }
+
+        ASSERT(Data[0] == 10000 + 3 * 1250);
+        const bool QueriedMixed = __ucxxrt_query_lockit_statistics(_LOCK_DEBUG, &After);
+        ASSERT(QueriedMixed);
+        LOG("_LOCK_DEBUG: %llu exclusive, %llu shared, %llu contended, %llu sleeps",
+            After.exclusive, After.shared, After.contended, After.sleeps);
+
+        // Benchmark: uncontended, against the ERESOURCE the locks used to be
+        auto Freq  = LARGE_INTEGER();
+        auto Begin = KeQueryPerformanceCounter(&Freq);
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            std::_Lockit Lock(_LOCK_DEBUG);
+        }
+        const auto LockitNs = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+
+        Begin = KeQueryPerformanceCounter(nullptr);
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            std::kshared_lockit Lock(_LOCK_DEBUG);
+        }
+        const auto SharedNs = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+
+        auto Resource = ERESOURCE();
+        const auto Status = ExInitializeResourceLite(&Resource);
+        ASSERT(NT_SUCCESS(Status));
+        Begin = KeQueryPerformanceCounter(nullptr);
+        for (auto Idx = 0; Idx < 100000; ++Idx) {
+            ExEnterCriticalRegionAndAcquireResourceExclusive(&Resource);
+            ExReleaseResourceAndLeaveCriticalRegion(&Resource);
+        }
+        const auto ResourceNs = (KeQueryPerformanceCounter(nullptr).QuadPart - Begin.QuadPart) * 1000000000 / Freq.QuadPart / 100000;
+        ExDeleteResourceLite(&Resource);
+
+        LOG("_Lockit: %lld ns, kshared_lockit: %lld ns, ERESOURCE: %lld ns", LockitNs, SharedNs, ResourceNs);
+    }
+
     std::mutex              TEST(Mutex);
     std::condition_variable TEST(ConditionVariable);
     std::string             TEST(ThreadData);
@@ -342,9 +1845,28 @@ namespace Main
         LOG("entry.");
 
         TEST_PUSH(Float2Int);
+        TEST_PUSH(StringToFloat);
+        TEST_PUSH(StringToInteger);
+        TEST_PUSH(FloatToChars);
+        TEST_PUSH(IntegerToChars);
         TEST_PUSH(ThrowInt);
         TEST_PUSH(ThrowObject);
         TEST_PUSH(ThrowUnknow);
+        TEST_PUSH(EHCache);
+        TEST_PUSH(ExceptionPtr);
+        TEST_PUSH(EHTelemetry);
+        TEST_PUSH(DynamicCast);
+        TEST_PUSH(TypeidCompare);
+        TEST_PUSH(TypeidHash);
+        TEST_PUSH(TypeidName);
+#if defined(_M_IX86) || defined(_M_X64)
+        TEST_PUSH(VectorSearch);
+        TEST_PUSH(VectorMismatch);
+        TEST_PUSH(VectorRemove);
+        TEST_PUSH(VectorMinmaxFloat);
+#endif
+        TEST_PUSH(VectorTiers);
+        TEST_PUSH(VectorMath);
         TEST_PUSH(Map);
         TEST_PUSH(InitializerList);
         TEST_PUSH(SystemErrorCode);
@@ -352,6 +1874,11 @@ namespace Main
         TEST_PUSH(SEH);
         TEST_PUSH(SETranslate);
         TEST_PUSH(Thread);
+        TEST_PUSH(AtexitConcurrent);
+        TEST_PUSH(ThreadSafeStatic);
+        TEST_PUSH(ParallelInitializer);
+        TEST_PUSH(StartupTiming);
+        TEST_PUSH(Lockit);
 
         for (const auto& Test : TestVec) {
             Test();